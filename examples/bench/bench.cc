@@ -0,0 +1,2335 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     bench.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Micro-benchmarks for the ncurses_cpp library hot paths.
+ *
+ * @section  DESCRIPTION
+ *
+ * Measures the cost of ncurses_cpp operations without a user at a terminal.
+ *  The threshold benchmark times the classification of a field value into a
+ *  threshold color on its own, comparing the indexed lookup used by
+ *  ncurses_field against the linear scan it replaced. The field update
+ *  benchmarks drive an ncurses_ui and its windows against a pseudo-terminal
+ *  whose output is drained and counted by a background thread. They report
+ *  update throughput, the cost of each update, the bytes sent to the terminal
+ *  per frame and the heap allocations per update for windows with 10, 1k and
+ *  100k fields. Every case is repeated with the diff renderer, which writes
+ *  its own terminal output, and on the in-memory backend, where the output is
+ *  counted in changed screen cells, to separate the cost of the library from
+ *  the cost of the terminal. The string benchmark updates string fields by
+ *  name, by moving values in and by posting text from a character buffer, with
+ *  names and values too long for the std::string inline buffer. The schema
+ *  benchmark compares updating the fields of a compile-time schema window by
+ *  name, through handles and through the schema. None of the field update,
+ *  string or schema cases should allocate in the steady state; any that does
+ *  is flagged and makes the benchmark exit with a nonzero status. The update
+ *  log benchmark times the same handle updates with and without recording
+ *  them, and how fast a recorded log decodes again. The sparkline benchmark
+ *  feeds samples into a sparkline one at a time and in blocks, for short and
+ *  long histories downsampled onto the same chart width. The table benchmark
+ *  times random row updates and page scrolling in table windows with 100k and
+ *  1M rows, of which only a page is visible. The shared-memory telemetry
+ *  benchmark times a producer publishing into a segment and the frames that
+ *  poll the bound slots with and without new values. The socket benchmark
+ *  sends batches from 1 and 256 clients to a listening user interface and
+ *  times the whole path from encoding to the frame. The layout benchmark times
+ *  parsing a layout file with 5k banded fields, building its windows at
+ *  startup and reloading it after one window changed. The resize benchmark
+ *  times the relayout of a window with 1000 fields that follows the width of
+ *  the screen, and of one that does not move. The scheduler benchmark reports
+ *  how late 64 periodic tasks start on the worker pool, with and without a
+ *  task that takes longer than its period. The color benchmark compares fields
+ *  colored by threshold bands with fields shaded along a gradient, and times
+ *  color pair lookups with fewer distinct colors than the terminal has pairs
+ *  and with more. Finally, the cost of one sample of the status_monitor system
+ *  collector is measured. Pass --json for machine-readable output that can be
+ *  compared between releases.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <ncurses.h>
+
+#include "ncurses_color_gradient.h"
+#include "ncurses_colors.h"
+#include "ncurses_diff_backend.h"
+#include "ncurses_field.h"
+#include "ncurses_layout.h"
+#include "ncurses_memory_backend.h"
+#include "ncurses_schema_window.h"
+#include "ncurses_shm_reader.h"
+#include "ncurses_shm_writer.h"
+#include "ncurses_socket_client.h"
+#include "ncurses_table_window.h"
+#include "ncurses_task_scheduler.h"
+#include "ncurses_ui.h"
+#include "ncurses_update_log.h"
+#include "ncurses_update_recorder.h"
+#include "ncurses_window.h"
+#include "system_collector.h"
+
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const size_t NUM_CLASSIFY_SAMPLES = 1 << 16;
+const size_t NUM_CLASSIFY_PASSES = 64;
+const uint32_t BAND_COUNTS[] = { 3, 8, 20, 50 };
+
+const uint32_t FIELD_COUNTS[] = { 10, 1000, 100000 };
+
+/* each case runs whole frames until at least this many updates were made */
+const uint64_t MIN_UPDATES_PER_CASE = 1000000;
+const uint64_t MIN_FRAMES_PER_CASE = 5;
+
+/* fields are laid out in a grid inside an outlined window */
+const uint32_t FIELD_WIDTH = 10;
+const uint32_t FIELDS_PER_ROW = 100;
+const char * FIELD_FORMAT = "%8u";
+
+const std::chrono::milliseconds TERMINAL_DRAIN_POLL_INTERVAL(5);
+
+/* the string benchmark uses names and values longer than a std::string holds
+ *  without allocating, so any copy into a temporary would show up */
+const uint32_t STRING_FIELD_COUNT = 64;
+const uint64_t STRING_UPDATES_PER_CASE = 1 << 20;
+const char * STRING_WINDOW_NAME = "string_benchmark_window";
+const char * STRING_VALUES[] = { "the quick brown fox jumps over", "the lazy dog, again and again" };
+
+/* the schema benchmark updates a window of eight fields declared at compile time */
+const uint32_t SCHEMA_FIELD_COUNT = 8;
+const uint64_t SCHEMA_UPDATES_PER_CASE = 1 << 22;
+const char * SCHEMA_WINDOW_NAME = "schema_benchmark_window";
+
+/* the update log benchmark commits a frame after every few passes over its fields,
+ *  which is when the recorder hands its records to the writer */
+const uint32_t UPDATE_LOG_FIELD_COUNT = 8;
+const uint64_t UPDATE_LOG_UPDATES_PER_CASE = 1 << 22;
+const uint32_t UPDATE_LOG_PASSES_PER_FRAME = 128;
+
+/* the sparkline benchmark keeps each history length on a chart of the same width */
+const size_t SPARKLINE_HISTORY_LENS[] = { 1024, 65536, 1048576 };
+const uint32_t SPARKLINE_WIDTH = 64;
+const size_t SPARKLINE_BLOCK_LEN = 4096;
+const uint64_t SPARKLINE_SAMPLES_PER_CASE = 1 << 24;
+
+/* the table benchmark updates rows across the whole table and pages through it */
+const size_t TABLE_ROW_COUNTS[] = { 100000, 1000000 };
+const uint32_t TABLE_VISIBLE_ROWS = 40;
+const uint64_t TABLE_UPDATES_PER_CASE = 1 << 22;
+const uint64_t TABLE_SCROLLS_PER_CASE = 1 << 14;
+
+/* the shared-memory benchmark binds one field per slot and polls once per frame */
+const uint32_t SHM_SLOT_COUNT = 64;
+const uint64_t SHM_PUBLISHES_PER_CASE = 1 << 24;
+const uint64_t SHM_FRAMES_PER_CASE = 1 << 14;
+
+/* every socket client sends one batch with an update for each field per frame */
+const uint32_t SOCKET_CLIENT_COUNTS[] = { 1, 256 };
+const uint32_t SOCKET_FIELD_COUNT = 64;
+const uint64_t SOCKET_RECORDS_PER_CASE = 1 << 21;
+
+/* the layout benchmark describes a grid of windows, each with a grid of banded fields */
+const uint32_t LAYOUT_WINDOW_COUNT = 50;
+const uint32_t LAYOUT_WINDOWS_PER_ROW = 5;
+const uint32_t LAYOUT_FIELDS_PER_WINDOW = 100;
+const uint32_t LAYOUT_FIELDS_PER_ROW = 10;
+const uint64_t LAYOUT_ITERATIONS = 20;
+
+/* the resize benchmark alternates the screen between two sizes under a window of
+ *  1000 fields that either follows the width of the screen or stays where it is */
+const uint32_t RESIZE_FIELD_COUNT = 1000;
+const uint32_t RESIZE_FIELDS_PER_ROW = 10;
+const uint32_t RESIZE_SCREEN_COLS[] = { 120, 160 };
+const uint64_t RESIZE_ITERATIONS = 1000;
+
+/* the scheduler benchmark runs many short tasks on the default worker pool, alone
+ *  and next to a task that takes longer than its period */
+const uint32_t SCHEDULER_TASK_COUNT = 64;
+const std::chrono::milliseconds SCHEDULER_TASK_PERIOD(10);
+const std::chrono::milliseconds SCHEDULER_SLOW_TASK_RUN_TIME(25);
+const std::chrono::seconds SCHEDULER_CASE_DURATION(2);
+
+/* the color benchmark compares banded and gradient fields, then looks pairs up in a
+ *  cache sized like a 256-color terminal with few and with too many distinct colors */
+const uint32_t COLOR_FIELD_COUNT = 1000;
+const uint64_t COLOR_FRAMES_PER_CASE = 1000;
+const uint32_t COLOR_VALUE_RANGE = 101;
+const uint32_t COLOR_LOOKUP_COUNTS[] = { 64, 512 };
+const uint64_t COLOR_LOOKUPS_PER_CASE = 1 << 22;
+
+const uint64_t COLLECTOR_SAMPLES = 10000;
+
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+    BENCH_UPDATE_BY_NAME = 0,
+    BENCH_UPDATE_BY_HANDLE,
+    BENCH_POST_UPDATE
+} bench_update_method_e;
+
+typedef enum {
+    BENCH_BACKEND_TERMINAL = 0,
+    BENCH_BACKEND_DIFF,
+    BENCH_BACKEND_MEMORY
+} bench_backend_e;
+
+struct threshold_result_t
+{
+    uint32_t                                                  num_bands;
+    double                                                    indexed_ns_per_op;
+    double                                                    linear_ns_per_op;
+    bool                                                      mismatch;
+};
+
+struct field_update_result_t
+{
+    const char *                                              scenario;
+    bench_backend_e                                           backend;
+    uint32_t                                                  num_fields;
+    uint64_t                                                  num_updates;
+    uint64_t                                                  num_frames;
+    double                                                    elapsed_sec;
+    /* terminal bytes or, for the memory backend, changed screen cells */
+    uint64_t                                                  output_written;
+    uint64_t                                                  num_allocations;
+};
+
+struct table_result_t
+{
+    const char *                                              scenario;
+    size_t                                                    num_rows;
+    uint64_t                                                  num_ops;
+    double                                                    elapsed_sec;
+    uint64_t                                                  cells_written;
+    uint64_t                                                  num_allocations;
+};
+
+struct shm_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_ops;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+};
+
+struct socket_result_t
+{
+    uint32_t                                                  num_clients;
+    uint64_t                                                  num_records;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+};
+
+struct layout_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_ops;
+    double                                                    elapsed_sec;
+};
+
+struct resize_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_resizes;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_relayouts;
+    uint64_t                                                  cells_written;
+};
+
+struct scheduler_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_runs;
+    double                                                    elapsed_sec;
+    double                                                    start_delay_avg_us;
+    double                                                    start_delay_max_us;
+    uint64_t                                                  late_count;
+    uint64_t                                                  overrun_count;
+};
+
+struct color_result_t
+{
+    const char *                                              scenario;
+    uint32_t                                                  num_colors;
+    uint64_t                                                  num_ops;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_evictions;
+    uint64_t                                                  num_allocations;
+};
+
+struct collector_result_t
+{
+    bool                                                      available;
+    uint64_t                                                  num_samples;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+};
+
+typedef enum {
+    BENCH_STRING_BY_NAME = 0,
+    BENCH_STRING_MOVED,
+    BENCH_STRING_POSTED
+} bench_string_method_e;
+
+struct string_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_updates;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+};
+
+typedef enum {
+    BENCH_SCHEMA_BY_NAME = 0,
+    BENCH_SCHEMA_BY_HANDLE,
+    BENCH_SCHEMA_UPDATE
+} bench_schema_method_e;
+
+struct schema_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_updates;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+};
+
+typedef enum {
+    BENCH_UPDATE_LOG_OFF = 0,
+    BENCH_UPDATE_LOG_RECORDED,
+    BENCH_UPDATE_LOG_DECODE
+} bench_update_log_method_e;
+
+struct update_log_result_t
+{
+    const char *                                              scenario;
+    uint64_t                                                  num_updates;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+    uint64_t                                                  num_dropped;
+    uint64_t                                                  log_len;
+};
+
+NCURSES_CPP_SCHEMA_FIELD(schema_field_0, uint32_t, 1, 1, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_1, uint32_t, 1, 2, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_2, uint32_t, 1, 3, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_3, uint32_t, 1, 4, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_4, uint32_t, 1, 5, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_5, uint32_t, 1, 6, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_6, uint32_t, 1, 7, "%8u", 0);
+NCURSES_CPP_SCHEMA_FIELD(schema_field_7, uint32_t, 1, 8, "%8u", 0);
+
+typedef ncurses_cpp::ncurses_schema_window<schema_field_0, schema_field_1, schema_field_2, schema_field_3,
+                                           schema_field_4, schema_field_5, schema_field_6, schema_field_7> bench_schema_window_t;
+
+struct sparkline_result_t
+{
+    const char *                                              scenario;
+    size_t                                                    history_len;
+    uint64_t                                                  num_samples;
+    double                                                    elapsed_sec;
+    uint64_t                                                  num_allocations;
+};
+
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/* every heap allocation in the process goes through these replacements; they
+ *  are kept out of line because GCC reports the malloc/free pair as mismatched
+ *  once it inlines them into the standard containers */
+static std::atomic<uint64_t> s_allocation_count(0);
+
+__attribute__((noinline)) void * operator new(size_t size)
+{
+    s_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    void * ptr = malloc(0 == size ? 1 : size);
+    if (nullptr == ptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+__attribute__((noinline)) void operator delete(void * ptr) noexcept
+{
+    free(ptr);
+}
+
+/* the first-match linear scan that ncurses_field used before the interval index */
+static ncurses_cpp::ncurses_cpp_text_colors_e linear_classify(const std::vector<ncurses_cpp::ncurses_field<float>::threshold_band_t>& bands, float field_val)
+{
+    for (auto iter = bands.begin(); iter != bands.end(); ++iter)
+    {
+        if (iter->first.first <= field_val &&
+            field_val <= iter->first.second)
+        {
+            return iter->second;
+        }
+    }
+
+    return ncurses_cpp::NCURSES_CPP_TXT_COLOR_DEFAULT;
+}
+
+static void run_threshold_benchmark(std::vector<threshold_result_t>& results)
+{
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> distribution(-5.0, 105.0);
+
+    std::vector<float> samples(NUM_CLASSIFY_SAMPLES);
+    for (auto iter = samples.begin(); iter != samples.end(); ++iter)
+    {
+        *iter = distribution(generator);
+    }
+
+    for (size_t i = 0; i < sizeof(BAND_COUNTS) / sizeof(BAND_COUNTS[0]); ++i)
+    {
+        /* heat-map style bands that evenly split [0, 100] */
+        std::vector<ncurses_cpp::ncurses_field<float>::threshold_band_t> bands;
+        float band_width = 100.0 / BAND_COUNTS[i];
+        for (uint32_t band = 0; band < BAND_COUNTS[i]; ++band)
+        {
+            ncurses_cpp::ncurses_cpp_text_colors_e color = static_cast<ncurses_cpp::ncurses_cpp_text_colors_e>(1 + band % ncurses_cpp::NCURSES_CPP_TXT_COLOR_WHITE);
+            bands.push_back(std::make_pair(std::make_pair(band * band_width, (band + 1) * band_width), color));
+        }
+
+        ncurses_cpp::ncurses_field<float> field;
+        field.set_field_thresholds(bands);
+
+        uint64_t checksum = 0;
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < NUM_CLASSIFY_PASSES; ++pass)
+        {
+            for (auto iter = samples.begin(); iter != samples.end(); ++iter)
+            {
+                checksum += field.get_color_based_on_thresholds(*iter);
+            }
+        }
+        auto indexed_time = std::chrono::steady_clock::now() - start_time;
+
+        start_time = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < NUM_CLASSIFY_PASSES; ++pass)
+        {
+            for (auto iter = samples.begin(); iter != samples.end(); ++iter)
+            {
+                checksum -= linear_classify(bands, *iter);
+            }
+        }
+        auto linear_time = std::chrono::steady_clock::now() - start_time;
+
+        double num_lookups = static_cast<double>(NUM_CLASSIFY_SAMPLES * NUM_CLASSIFY_PASSES);
+
+        threshold_result_t result;
+        result.num_bands = BAND_COUNTS[i];
+        result.indexed_ns_per_op = std::chrono::duration_cast<std::chrono::nanoseconds>(indexed_time).count() / num_lookups;
+        result.linear_ns_per_op = std::chrono::duration_cast<std::chrono::nanoseconds>(linear_time).count() / num_lookups;
+        result.mismatch = (0 != checksum);
+        results.push_back(result);
+    }
+}
+
+static const char * get_scenario_name(bench_update_method_e update_method)
+{
+    switch (update_method)
+    {
+    case BENCH_UPDATE_BY_NAME:   return "window_update_by_name";
+    case BENCH_UPDATE_BY_HANDLE: return "window_update_by_handle";
+    case BENCH_POST_UPDATE:      return "ui_post_update";
+    }
+
+    return "unknown";
+}
+
+static const char * get_backend_name(bench_backend_e backend)
+{
+    switch (backend)
+    {
+    case BENCH_BACKEND_TERMINAL: return "terminal";
+    case BENCH_BACKEND_DIFF:     return "diff";
+    case BENCH_BACKEND_MEMORY:   return "memory";
+    }
+
+    return "unknown";
+}
+
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+/* a pseudo-terminal for ncurses to draw on; everything written to it is read back
+ *  and counted by a drain thread so that the writer never blocks on a full pty */
+class bench_terminal
+{
+public:
+
+    bench_terminal(void)
+      : m_master_fd(-1),
+        m_term_out(nullptr),
+        m_term_in(nullptr),
+        m_bytes_read(0)
+    { }
+
+    virtual ~bench_terminal(void)
+    {
+        close_terminal();
+    }
+
+    bool open_terminal(uint16_t num_rows, uint16_t num_cols)
+    {
+        m_master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (m_master_fd < 0 ||
+            0 != grantpt(m_master_fd) ||
+            0 != unlockpt(m_master_fd))
+        {
+            return false;
+        }
+
+        int slave_fd = open(ptsname(m_master_fd), O_RDWR | O_NOCTTY);
+        if (slave_fd < 0)
+        {
+            return false;
+        }
+
+        /* count exactly what ncurses writes, without any output post-processing */
+        struct termios term_settings;
+        tcgetattr(slave_fd, &term_settings);
+        cfmakeraw(&term_settings);
+        tcsetattr(slave_fd, TCSANOW, &term_settings);
+
+        struct winsize term_size = {};
+        term_size.ws_row = num_rows;
+        term_size.ws_col = num_cols;
+        ioctl(m_master_fd, TIOCSWINSZ, &term_size);
+
+        m_term_out = fdopen(slave_fd, "w");
+        m_term_in = fdopen(dup(slave_fd), "r");
+
+        m_drain_thread = std::thread(&bench_terminal::drain, this);
+
+        return nullptr != m_term_out && nullptr != m_term_in;
+    }
+
+    void close_terminal(void)
+    {
+        /* the drain thread stops once the last slave descriptor is closed */
+        if (nullptr != m_term_out)
+        {
+            fclose(m_term_out);
+            m_term_out = nullptr;
+        }
+
+        if (nullptr != m_term_in)
+        {
+            fclose(m_term_in);
+            m_term_in = nullptr;
+        }
+
+        if (m_drain_thread.joinable())
+        {
+            m_drain_thread.join();
+        }
+
+        if (m_master_fd >= 0)
+        {
+            close(m_master_fd);
+            m_master_fd = -1;
+        }
+    }
+
+    FILE * get_term_out(void) const { return m_term_out; }
+    FILE * get_term_in(void) const { return m_term_in; }
+
+    /* waits until the drain thread has consumed everything written so far */
+    uint64_t get_bytes_written(void)
+    {
+        while (true)
+        {
+            uint64_t bytes_before = m_bytes_read.load();
+            std::this_thread::sleep_for(TERMINAL_DRAIN_POLL_INTERVAL);
+
+            int bytes_pending = 0;
+            if (0 != ioctl(m_master_fd, FIONREAD, &bytes_pending) ||
+                (0 == bytes_pending && bytes_before == m_bytes_read.load()))
+            {
+                break;
+            }
+        }
+
+        return m_bytes_read.load();
+    }
+
+private:
+
+    void drain(void)
+    {
+        char buf[65536];
+        while (true)
+        {
+            ssize_t num_bytes = read(m_master_fd, buf, sizeof(buf));
+            if (num_bytes > 0)
+            {
+                m_bytes_read.fetch_add(num_bytes);
+            }
+            else if (num_bytes < 0 && EINTR == errno)
+            {
+                continue;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    int                                                       m_master_fd;
+    FILE *                                                    m_term_out;
+    FILE *                                                    m_term_in;
+    std::atomic<uint64_t>                                     m_bytes_read;
+    std::thread                                               m_drain_thread;
+};
+
+/* exposes the window management of the ncurses_ui to the benchmark */
+class bench_ui : public ncurses_cpp::ncurses_ui
+{
+public:
+
+    bench_ui(FILE * term_out, FILE * term_in)
+      : ncurses_ui(KEY_F(1), 1000, term_out, term_in)
+    { }
+
+    bench_ui(std::unique_ptr<ncurses_cpp::ncurses_backend> backend)
+      : ncurses_ui(KEY_F(1), 1000, std::move(backend))
+    { }
+
+    using ncurses_ui::add_window;
+    using ncurses_ui::update_field;
+};
+
+static bool run_field_update_benchmark(uint32_t num_fields, bench_update_method_e update_method, bench_backend_e backend, field_update_result_t& result)
+{
+    uint32_t num_field_rows = (num_fields + FIELDS_PER_ROW - 1) / FIELDS_PER_ROW;
+    uint32_t num_field_cols = num_fields < FIELDS_PER_ROW ? num_fields : FIELDS_PER_ROW;
+
+    /* room for the outline and the ncurses_ui status line */
+    uint32_t window_height = num_field_rows + 2;
+    uint32_t window_width = num_field_cols * FIELD_WIDTH + 2;
+
+    bench_terminal terminal;
+    if (BENCH_BACKEND_MEMORY != backend &&
+        !terminal.open_terminal(window_height + 1, window_width))
+    {
+        return false;
+    }
+
+    uint64_t num_frames = MIN_UPDATES_PER_CASE / num_fields;
+    if (num_frames < MIN_FRAMES_PER_CASE)
+    {
+        num_frames = MIN_FRAMES_PER_CASE;
+    }
+
+    {
+        /* the ui owns the memory backend; keep a pointer to read its statistics */
+        ncurses_cpp::ncurses_memory_backend * memory_backend = nullptr;
+        std::unique_ptr<bench_ui> ui_ptr;
+        if (BENCH_BACKEND_MEMORY == backend)
+        {
+            memory_backend = new ncurses_cpp::ncurses_memory_backend(window_height + 1, window_width);
+            ui_ptr.reset(new bench_ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(memory_backend)));
+        }
+        else if (BENCH_BACKEND_DIFF == backend)
+        {
+            ncurses_cpp::ncurses_backend * diff_backend = new ncurses_cpp::ncurses_diff_backend(terminal.get_term_out(), terminal.get_term_in());
+            ui_ptr.reset(new bench_ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(diff_backend)));
+        }
+        else
+        {
+            ui_ptr.reset(new bench_ui(terminal.get_term_out(), terminal.get_term_in()));
+        }
+
+        bench_ui& ui = *ui_ptr;
+        ui.set_frame_commit_mode(true);
+        ui.configure_update_queue(num_fields, ncurses_cpp::NCURSES_CPP_OVERFLOW_DROP_OLDEST);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("bench"));
+        window->create_window(window_height, window_width, 1, 0);
+        ui.add_window(window);
+
+        std::vector<std::string> field_names(num_fields);
+        std::vector<ncurses_cpp::ncurses_field_handle<uint32_t>> field_handles(num_fields);
+        for (uint32_t i = 0; i < num_fields; ++i)
+        {
+            field_names[i] = "field_" + std::to_string(i);
+            field_handles[i] = window->add_field<uint32_t>(1 + (i % FIELDS_PER_ROW) * FIELD_WIDTH, 1 + i / FIELDS_PER_ROW, field_names[i], FIELD_FORMAT, 0);
+            if (!field_handles[i])
+            {
+                return false;
+            }
+        }
+
+        /* every field changes in every frame */
+        auto update_frame = [&](uint32_t frame_val)
+        {
+            for (uint32_t i = 0; i < num_fields; ++i)
+            {
+                switch (update_method)
+                {
+                case BENCH_UPDATE_BY_NAME:
+                    window->update_field<uint32_t>(field_names[i], frame_val + i);
+                    break;
+
+                case BENCH_UPDATE_BY_HANDLE:
+                    field_handles[i].update_field(frame_val + i);
+                    break;
+
+                case BENCH_POST_UPDATE:
+                    ui.post_update(field_handles[i], frame_val + i);
+                    break;
+                }
+            }
+
+            ui.flush_updates();
+        };
+
+        /* put the initial screen out, and a frame of the widest values to size the
+         *  queues and output buffers, so that only the steady state is measured */
+        ui.flush_updates();
+        update_frame(UINT32_MAX - num_fields);
+        uint64_t output_before = nullptr != memory_backend ? memory_backend->get_cells_written() : terminal.get_bytes_written();
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t frame = 0; frame < num_frames; ++frame)
+        {
+            update_frame(static_cast<uint32_t>(frame + 1) * 7919);
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.output_written = (nullptr != memory_backend ? memory_backend->get_cells_written() : terminal.get_bytes_written()) - output_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    }
+
+    result.scenario = get_scenario_name(update_method);
+    result.backend = backend;
+    result.num_fields = num_fields;
+    result.num_updates = num_frames * num_fields;
+    result.num_frames = num_frames;
+
+    return true;
+}
+
+static bool run_string_benchmark(bench_string_method_e string_method, string_result_t& result)
+{
+    {
+        bench_ui ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(STRING_FIELD_COUNT + 3, 80)));
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window(STRING_WINDOW_NAME));
+        window->create_window(STRING_FIELD_COUNT + 2, 80, 1, 0);
+        ui.add_window(window);
+
+        std::vector<std::string> field_names;
+        std::vector<ncurses_cpp::ncurses_field_handle<std::string>> fields;
+        for (uint32_t i = 0; i < STRING_FIELD_COUNT; ++i)
+        {
+            field_names.push_back("string_benchmark_field_" + std::to_string(i));
+            fields.push_back(window->add_field<std::string>(1, 1 + i, field_names.back(), "%s", STRING_VALUES[0]));
+            if (!fields.back())
+            {
+                return false;
+            }
+        }
+
+        /* the moved values trade storage with the fields, so each needs its own */
+        std::vector<std::string> moved_values(STRING_FIELD_COUNT);
+        const std::string values[2] = { STRING_VALUES[0], STRING_VALUES[1] };
+
+        auto update_string_field = [&](uint64_t update_idx)
+        {
+            uint32_t field_idx = update_idx % STRING_FIELD_COUNT;
+            const std::string& value = values[(update_idx / STRING_FIELD_COUNT) % 2];
+
+            switch (string_method)
+            {
+            case BENCH_STRING_BY_NAME:
+                ui.update_field<std::string>(STRING_WINDOW_NAME, field_names[field_idx].c_str(), value);
+                break;
+
+            case BENCH_STRING_MOVED:
+                moved_values[field_idx].assign(value.data(), value.size());
+                fields[field_idx].update_field(std::move(moved_values[field_idx]));
+                break;
+
+            case BENCH_STRING_POSTED:
+                ui.post_update(fields[field_idx], ncurses_cpp::ncurses_string_ref(value.data(), value.size()));
+                break;
+            }
+
+            if (STRING_FIELD_COUNT - 1 == field_idx)
+            {
+                ui.flush_updates();
+            }
+        };
+
+        /* one pass over both values grows the storage that later updates reuse */
+        for (uint64_t i = 0; i < 2 * STRING_FIELD_COUNT; ++i)
+        {
+            update_string_field(i);
+        }
+
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < STRING_UPDATES_PER_CASE; ++i)
+        {
+            update_string_field(i);
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    }
+
+    switch (string_method)
+    {
+    case BENCH_STRING_BY_NAME:
+        result.scenario = "string_update_by_name";
+        break;
+
+    case BENCH_STRING_MOVED:
+        result.scenario = "string_update_moved";
+        break;
+
+    case BENCH_STRING_POSTED:
+        result.scenario = "string_post_update";
+        break;
+    }
+    result.num_updates = STRING_UPDATES_PER_CASE;
+
+    return true;
+}
+
+static bool run_schema_benchmark(bench_schema_method_e schema_method, schema_result_t& result)
+{
+    static_assert(bench_schema_window_t::get_schema_field_count() == SCHEMA_FIELD_COUNT, "the schema benchmark window changed");
+
+    {
+        bench_ui ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(SCHEMA_FIELD_COUNT + 3, 80)));
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<bench_schema_window_t> window(new bench_schema_window_t(SCHEMA_WINDOW_NAME));
+        if (!window->create_window(SCHEMA_FIELD_COUNT + 2, 80, 1, 0))
+        {
+            return false;
+        }
+        ui.add_window(window);
+
+        const char * field_names[SCHEMA_FIELD_COUNT] = { schema_field_0::name(), schema_field_1::name(), schema_field_2::name(), schema_field_3::name(),
+                                                         schema_field_4::name(), schema_field_5::name(), schema_field_6::name(), schema_field_7::name() };
+        ncurses_cpp::ncurses_field_handle<uint32_t> fields[SCHEMA_FIELD_COUNT] = { window->get_handle<schema_field_0>(), window->get_handle<schema_field_1>(),
+                                                                                   window->get_handle<schema_field_2>(), window->get_handle<schema_field_3>(),
+                                                                                   window->get_handle<schema_field_4>(), window->get_handle<schema_field_5>(),
+                                                                                   window->get_handle<schema_field_6>(), window->get_handle<schema_field_7>() };
+
+        /* each pass gives every field a new value, so every update is drawn */
+        uint64_t num_passes = SCHEMA_UPDATES_PER_CASE / SCHEMA_FIELD_COUNT;
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint32_t pass = 1; pass <= num_passes; ++pass)
+        {
+            switch (schema_method)
+            {
+            case BENCH_SCHEMA_BY_NAME:
+                for (uint32_t i = 0; i < SCHEMA_FIELD_COUNT; ++i)
+                {
+                    ui.update_field<uint32_t>(SCHEMA_WINDOW_NAME, field_names[i], pass);
+                }
+                break;
+
+            case BENCH_SCHEMA_BY_HANDLE:
+                for (uint32_t i = 0; i < SCHEMA_FIELD_COUNT; ++i)
+                {
+                    fields[i].update_field(pass);
+                }
+                break;
+
+            case BENCH_SCHEMA_UPDATE:
+                window->update<schema_field_0>(pass);
+                window->update<schema_field_1>(pass);
+                window->update<schema_field_2>(pass);
+                window->update<schema_field_3>(pass);
+                window->update<schema_field_4>(pass);
+                window->update<schema_field_5>(pass);
+                window->update<schema_field_6>(pass);
+                window->update<schema_field_7>(pass);
+                break;
+            }
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        result.num_updates = num_passes * SCHEMA_FIELD_COUNT;
+    }
+
+    switch (schema_method)
+    {
+    case BENCH_SCHEMA_BY_NAME:
+        result.scenario = "schema_update_by_name";
+        break;
+
+    case BENCH_SCHEMA_BY_HANDLE:
+        result.scenario = "schema_update_by_handle";
+        break;
+
+    case BENCH_SCHEMA_UPDATE:
+        result.scenario = "schema_update";
+        break;
+    }
+
+    return true;
+}
+
+static bool run_update_log_benchmark(bench_update_log_method_e log_method, update_log_result_t& result)
+{
+    std::string log_path = "/tmp/ncurses_bench_" + std::to_string(getpid()) + ".log";
+
+    result.num_dropped = 0;
+    result.log_len = 0;
+
+    {
+        bench_ui ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(UPDATE_LOG_FIELD_COUNT + 3, 80)));
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("update_log_benchmark_window"));
+        if (!window->create_window(UPDATE_LOG_FIELD_COUNT + 2, 80, 1, 0))
+        {
+            return false;
+        }
+        ui.add_window(window);
+
+        std::vector<ncurses_cpp::ncurses_field_handle<uint32_t>> fields;
+        for (uint32_t i = 0; i < UPDATE_LOG_FIELD_COUNT; ++i)
+        {
+            fields.push_back(window->add_field<uint32_t>(1, i + 1, "field_" + std::to_string(i), "%8u", 0));
+        }
+
+        /* the decode case times reading back the log of a recorded run */
+        if (BENCH_UPDATE_LOG_OFF != log_method &&
+            !ui.start_recording(log_path))
+        {
+            return false;
+        }
+
+        uint64_t num_passes = UPDATE_LOG_UPDATES_PER_CASE / UPDATE_LOG_FIELD_COUNT;
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint32_t pass = 1; pass <= num_passes; ++pass)
+        {
+            for (uint32_t i = 0; i < UPDATE_LOG_FIELD_COUNT; ++i)
+            {
+                fields[i].update_field(pass);
+            }
+
+            if (0 == pass % UPDATE_LOG_PASSES_PER_FRAME)
+            {
+                ui.flush_updates();
+            }
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        result.num_updates = num_passes * UPDATE_LOG_FIELD_COUNT;
+
+        if (ui.is_recording())
+        {
+            result.num_dropped = ui.get_update_recorder()->get_stats().dropped_update_count;
+            ui.stop_recording();
+        }
+    }
+
+    if (BENCH_UPDATE_LOG_DECODE == log_method)
+    {
+        ncurses_cpp::ncurses_update_log_reader reader;
+        if (!reader.open_log(log_path))
+        {
+            unlink(log_path.c_str());
+            return false;
+        }
+
+        uint64_t num_records = 0;
+        ncurses_cpp::ncurses_update_log_record_t record;
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        while (reader.read_update(record))
+        {
+            num_records++;
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        result.num_updates = num_records;
+        result.log_len = reader.get_log_len();
+    }
+    else if (BENCH_UPDATE_LOG_RECORDED == log_method)
+    {
+        struct stat log_stat;
+        if (0 == stat(log_path.c_str(), &log_stat))
+        {
+            result.log_len = static_cast<uint64_t>(log_stat.st_size);
+        }
+    }
+    unlink(log_path.c_str());
+
+    switch (log_method)
+    {
+    case BENCH_UPDATE_LOG_OFF:
+        result.scenario = "update_not_recorded";
+        break;
+
+    case BENCH_UPDATE_LOG_RECORDED:
+        result.scenario = "update_recorded";
+        break;
+
+    case BENCH_UPDATE_LOG_DECODE:
+        result.scenario = "log_decode";
+        break;
+    }
+
+    return true;
+}
+
+static bool run_sparkline_benchmark(size_t history_len, bool add_in_blocks, sparkline_result_t& result)
+{
+    std::mt19937 generator(4321);
+    std::normal_distribution<float> distribution(50.0, 15.0);
+
+    std::vector<float> samples(SPARKLINE_BLOCK_LEN);
+    for (auto iter = samples.begin(); iter != samples.end(); ++iter)
+    {
+        *iter = distribution(generator);
+    }
+
+    {
+        bench_ui ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(4, SPARKLINE_WIDTH + 2)));
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("bench"));
+        window->create_window(3, SPARKLINE_WIDTH + 2, 1, 0);
+        ui.add_window(window);
+
+        auto sparkline = window->add_sparkline<float>(1, 1, "sparkline", SPARKLINE_WIDTH, history_len);
+        if (!sparkline)
+        {
+            return false;
+        }
+
+        /* fill the history so that every case downsamples a full ring */
+        for (size_t i = 0; i < sparkline.get_field()->get_history_len(); i += SPARKLINE_BLOCK_LEN)
+        {
+            sparkline.add_samples(samples.data(), samples.size());
+        }
+        ui.flush_updates();
+
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t num_added = 0; num_added < SPARKLINE_SAMPLES_PER_CASE; num_added += SPARKLINE_BLOCK_LEN)
+        {
+            if (add_in_blocks)
+            {
+                sparkline.add_samples(samples.data(), samples.size());
+            }
+            else
+            {
+                for (auto iter = samples.begin(); iter != samples.end(); ++iter)
+                {
+                    sparkline.add_sample(*iter);
+                }
+            }
+
+            ui.flush_updates();
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    }
+
+    result.scenario = add_in_blocks ? "sparkline_add_samples" : "sparkline_add_sample";
+    result.history_len = history_len;
+    result.num_samples = SPARKLINE_SAMPLES_PER_CASE;
+
+    return true;
+}
+
+static bool run_table_benchmark(size_t num_rows, bool scroll_table, table_result_t& result)
+{
+    ncurses_cpp::ncurses_memory_backend * memory_backend = new ncurses_cpp::ncurses_memory_backend(TABLE_VISIBLE_ROWS + 4, 80);
+
+    {
+        bench_ui ui{std::unique_ptr<ncurses_cpp::ncurses_backend>(memory_backend)};
+        ui.set_frame_commit_mode(true);
+
+        /* the outline and the header line take three lines of the window */
+        std::shared_ptr<ncurses_cpp::ncurses_table_window> table(new ncurses_cpp::ncurses_table_window("bench"));
+        if (!table->add_column<uint32_t>("id", 10, "%10u") ||
+            !table->add_column<std::string>("name", 20, "%s") ||
+            !table->add_column<double>("rate", 12, "%12.3f") ||
+            !table->add_column<uint64_t>("bytes", 16, "%16lu"))
+        {
+            return false;
+        }
+
+        table->set_row_count(num_rows);
+        for (size_t row = 0; row < num_rows; ++row)
+        {
+            table->set_cell<uint32_t>(row, 0, static_cast<uint32_t>(row));
+            table->set_cell<std::string>(row, 1, "entry");
+        }
+
+        table->create_window(TABLE_VISIBLE_ROWS + 3, 80, 1, 0);
+        ui.add_window(table);
+        ui.flush_updates();
+
+        std::mt19937 generator(5678);
+        std::uniform_int_distribution<size_t> row_distribution(0, num_rows - 1);
+
+        uint64_t cells_before = memory_backend->get_cells_written();
+        uint64_t allocations_before = s_allocation_count.load();
+        uint64_t num_ops = scroll_table ? TABLE_SCROLLS_PER_CASE : TABLE_UPDATES_PER_CASE;
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t op = 0; op < num_ops; ++op)
+        {
+            if (scroll_table)
+            {
+                /* page down through the table and start over at the end */
+                if (!table->handle_scroll_key(KEY_NPAGE) ||
+                    table->get_first_visible_row() + table->get_visible_row_count() >= num_rows)
+                {
+                    table->scroll_to(0);
+                }
+            }
+            else
+            {
+                table->set_cell<double>(row_distribution(generator), 2, static_cast<double>(op));
+            }
+
+            /* a frame per page, or per 1k updates, keeps the frame cost visible */
+            if (scroll_table || 0 == (op & 1023))
+            {
+                ui.flush_updates();
+            }
+        }
+        ui.flush_updates();
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.cells_written = memory_backend->get_cells_written() - cells_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        result.num_ops = num_ops;
+    }
+
+    result.scenario = scroll_table ? "table_scroll_page" : "table_update_random_row";
+    result.num_rows = num_rows;
+
+    return true;
+}
+
+static bool run_shm_benchmark(std::vector<shm_result_t>& results)
+{
+    std::string segment_name = "ncurses_bench_" + std::to_string(getpid());
+    ncurses_cpp::ncurses_memory_backend * memory_backend = new ncurses_cpp::ncurses_memory_backend(SHM_SLOT_COUNT / 4 + 2, 80);
+
+    {
+        bench_ui ui{std::unique_ptr<ncurses_cpp::ncurses_backend>(memory_backend)};
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("bench"));
+        window->create_window(SHM_SLOT_COUNT / 4 + 2, 80, 0, 0);
+        ui.add_window(window);
+
+        auto reader = std::make_shared<ncurses_cpp::ncurses_shm_reader>();
+        ncurses_cpp::ncurses_shm_writer writer;
+        std::vector<ncurses_cpp::ncurses_shm_slot_handle<uint32_t>> slots;
+        bool segment_open = reader->open_segment(segment_name, SHM_SLOT_COUNT) &&
+                            writer.open_segment(segment_name, SHM_SLOT_COUNT);
+
+        /* both sides keep their mapping, so the name is not needed any more */
+        ncurses_cpp::ncurses_shm_segment::remove_segment(segment_name);
+        if (!segment_open)
+        {
+            return false;
+        }
+
+        for (uint32_t slot_idx = 0; slot_idx < SHM_SLOT_COUNT; ++slot_idx)
+        {
+            std::string slot_name = "slot_" + std::to_string(slot_idx);
+            auto field = window->add_field<uint32_t>(1 + (slot_idx % 4) * FIELD_WIDTH * 2, 1 + slot_idx / 4, slot_name, FIELD_FORMAT, 0);
+            slots.push_back(writer.claim_slot<uint32_t>(slot_name));
+            if (!slots.back() ||
+                !reader->bind_field(slot_name, field))
+            {
+                return false;
+            }
+        }
+        ui.set_shm_reader(reader);
+        ui.flush_updates();
+
+        /* the producer side on its own */
+        uint64_t allocations_before = s_allocation_count.load();
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t op = 0; op < SHM_PUBLISHES_PER_CASE; ++op)
+        {
+            writer.publish(slots[op % SHM_SLOT_COUNT], static_cast<uint32_t>(op));
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        shm_result_t result;
+        result.scenario = "shm_publish";
+        result.num_ops = SHM_PUBLISHES_PER_CASE;
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        results.push_back(result);
+
+        /* frames in which every slot has a new value, then frames with nothing new */
+        for (int slots_changed = 1; slots_changed >= 0; --slots_changed)
+        {
+            ui.flush_updates();
+
+            allocations_before = s_allocation_count.load();
+            start_time = std::chrono::steady_clock::now();
+            for (uint64_t frame = 0; frame < SHM_FRAMES_PER_CASE; ++frame)
+            {
+                if (slots_changed)
+                {
+                    for (uint32_t slot_idx = 0; slot_idx < SHM_SLOT_COUNT; ++slot_idx)
+                    {
+                        writer.publish(slots[slot_idx], static_cast<uint32_t>(frame * SHM_SLOT_COUNT + slot_idx));
+                    }
+                }
+                ui.flush_updates();
+            }
+            elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+            result.scenario = slots_changed ? "shm_frame_all_changed" : "shm_frame_unchanged";
+            result.num_ops = SHM_FRAMES_PER_CASE;
+            result.num_allocations = s_allocation_count.load() - allocations_before;
+            result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+            results.push_back(result);
+        }
+    }
+
+    return true;
+}
+
+static bool run_socket_benchmark(uint32_t num_clients, socket_result_t& result)
+{
+    std::string socket_path = "/tmp/ncurses_bench_" + std::to_string(getpid()) + ".sock";
+    ncurses_cpp::ncurses_memory_backend * memory_backend = new ncurses_cpp::ncurses_memory_backend(SOCKET_FIELD_COUNT / 4 + 2, 80);
+
+    {
+        bench_ui ui{std::unique_ptr<ncurses_cpp::ncurses_backend>(memory_backend)};
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("bench"));
+        window->create_window(SOCKET_FIELD_COUNT / 4 + 2, 80, 0, 0);
+        ui.add_window(window);
+
+        std::vector<std::string> field_names;
+        for (uint32_t field_idx = 0; field_idx < SOCKET_FIELD_COUNT; ++field_idx)
+        {
+            field_names.push_back("field_" + std::to_string(field_idx));
+            if (!window->add_field<uint32_t>(1 + (field_idx % 4) * FIELD_WIDTH * 2, 1 + field_idx / 4, field_names.back(), FIELD_FORMAT, 0))
+            {
+                return false;
+            }
+        }
+
+        if (!ui.listen_on_socket(socket_path))
+        {
+            return false;
+        }
+
+        std::vector<std::unique_ptr<ncurses_cpp::ncurses_socket_client>> clients;
+        for (uint32_t client_idx = 0; client_idx < num_clients; ++client_idx)
+        {
+            clients.emplace_back(new ncurses_cpp::ncurses_socket_client());
+            if (!clients.back()->connect_socket(socket_path))
+            {
+                return false;
+            }
+        }
+        ui.flush_updates();
+
+        const std::string window_name = "bench";
+        uint64_t num_records = 0;
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        while (num_records < SOCKET_RECORDS_PER_CASE)
+        {
+            for (uint32_t client_idx = 0; client_idx < num_clients; ++client_idx)
+            {
+                for (uint32_t field_idx = 0; field_idx < SOCKET_FIELD_COUNT; ++field_idx)
+                {
+                    clients[client_idx]->add_update<uint32_t>(window_name, field_names[field_idx], static_cast<uint32_t>(num_records + field_idx));
+                }
+                clients[client_idx]->flush();
+                num_records += SOCKET_FIELD_COUNT;
+            }
+            ui.flush_updates();
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        result.num_records = num_records;
+
+        if (ui.get_socket_server().get_record_count() != num_records)
+        {
+            return false;
+        }
+    }
+
+    result.num_clients = num_clients;
+
+    return true;
+}
+
+static std::string make_layout_text(const std::string& first_title)
+{
+    uint32_t window_height = LAYOUT_FIELDS_PER_WINDOW / LAYOUT_FIELDS_PER_ROW + 2;
+    uint32_t window_width = LAYOUT_FIELDS_PER_ROW * FIELD_WIDTH + 2;
+
+    std::string layout_text;
+    for (uint32_t window_idx = 0; window_idx < LAYOUT_WINDOW_COUNT; ++window_idx)
+    {
+        layout_text += "window w" + std::to_string(window_idx) + " " +
+                       std::to_string(window_height) + " " + std::to_string(window_width) + " " +
+                       std::to_string((window_idx / LAYOUT_WINDOWS_PER_ROW) * window_height) + " " +
+                       std::to_string((window_idx % LAYOUT_WINDOWS_PER_ROW) * window_width) + "\n";
+        layout_text += "    title \"" + (0 == window_idx ? first_title : "w" + std::to_string(window_idx)) + "\"\n";
+
+        for (uint32_t field_idx = 0; field_idx < LAYOUT_FIELDS_PER_WINDOW; ++field_idx)
+        {
+            layout_text += "    field uint32 f" + std::to_string(field_idx) + " " +
+                           std::to_string(1 + (field_idx % LAYOUT_FIELDS_PER_ROW) * FIELD_WIDTH) + " " +
+                           std::to_string(1 + field_idx / LAYOUT_FIELDS_PER_ROW) + " \"" + FIELD_FORMAT + "\" 0\n";
+            layout_text += "        band 0 99 green\n";
+            layout_text += "        band 100 4294967295 red\n";
+        }
+        layout_text += "end\n";
+    }
+
+    return layout_text;
+}
+
+static bool write_layout_file(const std::string& layout_path, const std::string& layout_text)
+{
+    FILE * layout_file = fopen(layout_path.c_str(), "w");
+    if (nullptr == layout_file)
+    {
+        return false;
+    }
+
+    size_t bytes_written = fwrite(layout_text.data(), 1, layout_text.size(), layout_file);
+    return 0 == fclose(layout_file) && layout_text.size() == bytes_written;
+}
+
+static bool run_layout_benchmark(std::vector<layout_result_t>& results)
+{
+    std::string layout_path = "/tmp/ncurses_bench_" + std::to_string(getpid()) + ".layout";
+    std::string layout_text = make_layout_text("w0");
+    std::string changed_layout_text = make_layout_text("w0 changed");
+    uint32_t screen_rows = (LAYOUT_WINDOW_COUNT + LAYOUT_WINDOWS_PER_ROW - 1) / LAYOUT_WINDOWS_PER_ROW * (LAYOUT_FIELDS_PER_WINDOW / LAYOUT_FIELDS_PER_ROW + 2);
+    uint32_t screen_cols = LAYOUT_WINDOWS_PER_ROW * (LAYOUT_FIELDS_PER_ROW * FIELD_WIDTH + 2);
+
+    if (!write_layout_file(layout_path, layout_text))
+    {
+        return false;
+    }
+
+    /* parsing alone */
+    layout_result_t parse_result = { "layout_parse", LAYOUT_ITERATIONS, 0.0 };
+    ncurses_cpp::ncurses_layout layout;
+    auto start_time = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < LAYOUT_ITERATIONS; ++i)
+    {
+        if (!layout.parse_file(layout_path))
+        {
+            unlink(layout_path.c_str());
+            return false;
+        }
+    }
+    parse_result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start_time).count();
+    results.push_back(parse_result);
+
+    /* startup: parse, build every window and draw the first frame */
+    layout_result_t load_result = { "layout_load", LAYOUT_ITERATIONS, 0.0 };
+    for (uint64_t i = 0; i < LAYOUT_ITERATIONS; ++i)
+    {
+        bench_ui ui{std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(screen_rows, screen_cols))};
+
+        start_time = std::chrono::steady_clock::now();
+        bool loaded = ui.load_layout(layout_path, false);
+        load_result.elapsed_sec += std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start_time).count();
+
+        if (!loaded)
+        {
+            unlink(layout_path.c_str());
+            return false;
+        }
+    }
+    results.push_back(load_result);
+
+    /* hot reload after a change to one window */
+    layout_result_t reload_result = { "layout_reload_1_window", LAYOUT_ITERATIONS, 0.0 };
+    {
+        bench_ui ui{std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(screen_rows, screen_cols))};
+        if (!ui.load_layout(layout_path, false))
+        {
+            unlink(layout_path.c_str());
+            return false;
+        }
+
+        for (uint64_t i = 0; i < LAYOUT_ITERATIONS; ++i)
+        {
+            if (!write_layout_file(layout_path, 0 == i % 2 ? changed_layout_text : layout_text))
+            {
+                unlink(layout_path.c_str());
+                return false;
+            }
+
+            start_time = std::chrono::steady_clock::now();
+            bool reloaded = ui.reload_layout();
+            reload_result.elapsed_sec += std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start_time).count();
+
+            if (!reloaded)
+            {
+                unlink(layout_path.c_str());
+                return false;
+            }
+        }
+    }
+    results.push_back(reload_result);
+
+    unlink(layout_path.c_str());
+    return true;
+}
+
+static bool run_resize_benchmark(bool anchored_window, resize_result_t& result)
+{
+    uint32_t num_field_rows = RESIZE_FIELD_COUNT / RESIZE_FIELDS_PER_ROW;
+    uint32_t screen_rows = num_field_rows + 3;
+
+    ncurses_cpp::ncurses_memory_backend * memory_backend = new ncurses_cpp::ncurses_memory_backend(screen_rows, RESIZE_SCREEN_COLS[0]);
+    bench_ui ui{std::unique_ptr<ncurses_cpp::ncurses_backend>(memory_backend)};
+    ui.set_frame_commit_mode(true);
+
+    /* the anchored window spans the screen; the other one keeps the width of the
+     *  narrower screen and is left alone by every resize */
+    const ncurses_cpp::ncurses_window_geometry_t anchored_geometry = { { 0.0, static_cast<int32_t>(num_field_rows + 2) }, { 1.0, 0 }, { 0.0, 1 }, { 0.0, 0 } };
+    const ncurses_cpp::ncurses_window_geometry_t fixed_geometry = { { 0.0, static_cast<int32_t>(num_field_rows + 2) }, { 0.0, static_cast<int32_t>(RESIZE_SCREEN_COLS[0]) }, { 0.0, 1 }, { 0.0, 0 } };
+
+    std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("bench"));
+    if (!window->create_window(anchored_window ? anchored_geometry : fixed_geometry))
+    {
+        return false;
+    }
+    ui.add_window(window);
+
+    for (uint32_t i = 0; i < RESIZE_FIELD_COUNT; ++i)
+    {
+        if (!window->add_field<uint32_t>(1 + (i % RESIZE_FIELDS_PER_ROW) * FIELD_WIDTH, 1 + i / RESIZE_FIELDS_PER_ROW, "field_" + std::to_string(i), FIELD_FORMAT, i))
+        {
+            return false;
+        }
+    }
+
+    ui.flush_updates();
+    uint64_t cells_before = memory_backend->get_cells_written();
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < RESIZE_ITERATIONS; ++i)
+    {
+        /* the memory backend also queues a KEY_RESIZE; the benchmark never reads it */
+        memory_backend->set_screen_size(screen_rows, RESIZE_SCREEN_COLS[(i + 1) % 2]);
+        ui.handle_resize();
+    }
+    auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+    result.scenario = anchored_window ? "resize_anchored_window" : "resize_fixed_window";
+    result.num_resizes = RESIZE_ITERATIONS;
+    result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    result.num_relayouts = ui.get_relayout_count();
+    result.cells_written = memory_backend->get_cells_written() - cells_before;
+
+    return true;
+}
+
+static void run_scheduler_benchmark(bool with_slow_task, scheduler_result_t& result)
+{
+    ncurses_cpp::ncurses_task_scheduler scheduler;
+    for (uint32_t i = 0; i < SCHEDULER_TASK_COUNT; ++i)
+    {
+        scheduler.add_task("task_" + std::to_string(i), SCHEDULER_TASK_PERIOD, [](void) { });
+    }
+
+    if (with_slow_task)
+    {
+        scheduler.add_task("slow", SCHEDULER_TASK_PERIOD, [](void) { std::this_thread::sleep_for(SCHEDULER_SLOW_TASK_RUN_TIME); });
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    scheduler.start(ncurses_cpp::NCURSES_TASK_DEFAULT_WORKER_COUNT);
+    std::this_thread::sleep_for(SCHEDULER_CASE_DURATION);
+    scheduler.stop();
+    auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+    /* the start delays are those of the short tasks */
+    std::chrono::steady_clock::duration start_delay_total(0);
+    std::chrono::steady_clock::duration start_delay_max(0);
+    uint64_t num_short_runs = 0;
+    for (uint32_t i = 0; i < SCHEDULER_TASK_COUNT; ++i)
+    {
+        ncurses_cpp::ncurses_task_stats_t stats;
+        scheduler.get_task_stats(i, stats);
+        start_delay_total += stats.start_delay_total;
+        start_delay_max = std::max(start_delay_max, stats.start_delay_max);
+        num_short_runs += stats.run_count;
+    }
+
+    result.scenario = with_slow_task ? "tasks_with_slow_task" : "tasks";
+    result.num_runs = scheduler.get_run_count();
+    result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    result.start_delay_avg_us = num_short_runs > 0 ? std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(start_delay_total).count() / num_short_runs : 0.0;
+    result.start_delay_max_us = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(start_delay_max).count();
+    result.late_count = scheduler.get_late_count();
+    result.overrun_count = scheduler.get_overrun_count();
+}
+
+static bool run_color_field_benchmark(bool use_gradient, color_result_t& result)
+{
+    uint32_t num_field_rows = COLOR_FIELD_COUNT / FIELDS_PER_ROW;
+    ncurses_cpp::ncurses_color_pair_cache& pair_cache = ncurses_cpp::get_color_pair_cache();
+
+    {
+        bench_ui ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(new ncurses_cpp::ncurses_memory_backend(num_field_rows + 3, FIELDS_PER_ROW * FIELD_WIDTH + 2)));
+        ui.set_frame_commit_mode(true);
+
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window("bench"));
+        window->create_window(num_field_rows + 2, FIELDS_PER_ROW * FIELD_WIDTH + 2, 1, 0);
+        ui.add_window(window);
+
+        auto gradient = std::make_shared<ncurses_cpp::ncurses_color_gradient>();
+        if (!gradient->create_gradient(0.0, COLOR_VALUE_RANGE - 1, { ncurses_cpp::ncurses_rgb(0, 205, 0), ncurses_cpp::ncurses_rgb(205, 205, 0), ncurses_cpp::ncurses_rgb(255, 0, 0) }, COLOR_BLACK))
+        {
+            return false;
+        }
+
+        std::vector<ncurses_cpp::ncurses_field_handle<float>> fields;
+        for (uint32_t i = 0; i < COLOR_FIELD_COUNT; ++i)
+        {
+            std::string field_name = "field_" + std::to_string(i);
+            auto field = window->add_field<float>(1 + (i % FIELDS_PER_ROW) * FIELD_WIDTH, 1 + i / FIELDS_PER_ROW, field_name, "%8.1f", 0.0);
+            if (!field)
+            {
+                return false;
+            }
+
+            if (use_gradient)
+            {
+                field.get_field()->set_color_gradient(gradient);
+            }
+            else
+            {
+                window->add_field_thresholds<float>(field_name, std::make_pair<float, float>(0.0, 75.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_GREEN);
+                window->add_field_thresholds<float>(field_name, std::make_pair<float, float>(75.0, 90.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_YELLOW);
+                window->add_field_thresholds<float>(field_name, std::make_pair<float, float>(90.0, 100.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_RED);
+            }
+            fields.push_back(field);
+        }
+
+        /* the threshold index of each field is built on its first update */
+        for (uint32_t i = 0; i < COLOR_FIELD_COUNT; ++i)
+        {
+            fields[i].update_field(static_cast<float>(COLOR_VALUE_RANGE - 1));
+        }
+        ui.flush_updates();
+
+        uint64_t evictions_before = pair_cache.get_stats().eviction_count;
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t frame = 0; frame < COLOR_FRAMES_PER_CASE; ++frame)
+        {
+            for (uint32_t i = 0; i < COLOR_FIELD_COUNT; ++i)
+            {
+                fields[i].update_field(static_cast<float>((frame * 7 + i) % COLOR_VALUE_RANGE));
+            }
+
+            ui.flush_updates();
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.num_evictions = pair_cache.get_stats().eviction_count - evictions_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    }
+
+    result.scenario = use_gradient ? "field_update_gradient" : "field_update_bands";
+    result.num_colors = use_gradient ? static_cast<uint32_t>(ncurses_cpp::NCURSES_CPP_GRADIENT_DEFAULT_STEPS) : 3;
+    result.num_ops = COLOR_FRAMES_PER_CASE * COLOR_FIELD_COUNT;
+
+    return true;
+}
+
+static void run_color_lookup_benchmark(uint32_t num_colors, color_result_t& result)
+{
+    ncurses_cpp::ncurses_color_pair_cache& pair_cache = ncurses_cpp::get_color_pair_cache();
+
+    /* distinct foreground/background combinations from the 256-color palette */
+    std::vector<std::pair<ncurses_cpp::ncurses_color_t, ncurses_cpp::ncurses_color_t>> colors;
+    for (uint32_t i = 0; i < num_colors; ++i)
+    {
+        colors.push_back(std::make_pair(static_cast<ncurses_cpp::ncurses_color_t>(16 + i % 216), static_cast<ncurses_cpp::ncurses_color_t>(232 + i / 216)));
+    }
+
+    uint64_t evictions_before = pair_cache.get_stats().eviction_count;
+    uint64_t allocations_before = s_allocation_count.load();
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < COLOR_LOOKUPS_PER_CASE; ++i)
+    {
+        const std::pair<ncurses_cpp::ncurses_color_t, ncurses_cpp::ncurses_color_t>& color = colors[i % num_colors];
+        pair_cache.get_pair(color.first, color.second);
+    }
+    auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+    result.scenario = num_colors <= pair_cache.get_capacity() ? "pair_lookup_fits" : "pair_lookup_churn";
+    result.num_colors = num_colors;
+    result.num_ops = COLOR_LOOKUPS_PER_CASE;
+    result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+    result.num_evictions = pair_cache.get_stats().eviction_count - evictions_before;
+    result.num_allocations = s_allocation_count.load() - allocations_before;
+}
+
+static void run_collector_benchmark(collector_result_t& result)
+{
+    ncurses_cpp::system_collector collector;
+    result.available = collector.open_sources() && collector.sample();
+    result.num_samples = 0;
+    result.elapsed_sec = 0.0;
+    result.num_allocations = 0;
+
+    if (result.available)
+    {
+        uint64_t allocations_before = s_allocation_count.load();
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < COLLECTOR_SAMPLES; ++i)
+        {
+            collector.sample();
+        }
+        auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        result.num_allocations = s_allocation_count.load() - allocations_before;
+        result.elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count();
+        result.num_samples = COLLECTOR_SAMPLES;
+    }
+}
+
+/* update paths must not allocate in the steady state; any case that does fails
+ *  the run */
+template <typename T>
+static uint32_t count_allocating_results(const std::vector<T>& results)
+{
+    uint32_t ret = 0;
+    for (auto iter = results.begin(); iter != results.end(); ++iter)
+    {
+        if (0 != iter->num_allocations)
+        {
+            ret++;
+        }
+    }
+
+    return ret;
+}
+
+static void print_text_results(FILE * out, const std::vector<threshold_result_t>& threshold_results, const std::vector<field_update_result_t>& field_update_results, const std::vector<string_result_t>& string_results, const std::vector<schema_result_t>& schema_results, const std::vector<update_log_result_t>& update_log_results, const std::vector<sparkline_result_t>& sparkline_results, const std::vector<table_result_t>& table_results, const std::vector<shm_result_t>& shm_results, const std::vector<socket_result_t>& socket_results, const std::vector<layout_result_t>& layout_results, const std::vector<resize_result_t>& resize_results, const std::vector<scheduler_result_t>& scheduler_results, const std::vector<color_result_t>& color_results, const collector_result_t& collector_result)
+{
+    fprintf(out, "threshold classification (%zu lookups per case)\n", NUM_CLASSIFY_SAMPLES * NUM_CLASSIFY_PASSES);
+    fprintf(out, "  %-6s %14s %14s\n", "bands", "indexed ns/op", "linear ns/op");
+    for (auto iter = threshold_results.begin(); iter != threshold_results.end(); ++iter)
+    {
+        fprintf(out, "  %-6u %14.2f %14.2f%s\n",
+                iter->num_bands,
+                iter->indexed_ns_per_op,
+                iter->linear_ns_per_op,
+                iter->mismatch ? "  (MISMATCH)" : "");
+    }
+
+    fprintf(out, "\nfield updates (frame commit mode, every field changes every frame)\n");
+    fprintf(out, "  %-24s %-8s %7s %12s %10s %14s %12s\n", "scenario", "backend", "fields", "updates/s", "ns/update", "output/frame", "allocs/upd");
+    for (auto iter = field_update_results.begin(); iter != field_update_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %-8s %7u %12.0f %10.1f %8.0f %5s %12.3f%s\n",
+                iter->scenario,
+                get_backend_name(iter->backend),
+                iter->num_fields,
+                iter->num_updates / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_updates,
+                static_cast<double>(iter->output_written) / iter->num_frames,
+                BENCH_BACKEND_MEMORY == iter->backend ? "cells" : "bytes",
+                static_cast<double>(iter->num_allocations) / iter->num_updates,
+                0 != iter->num_allocations ? "  (ALLOCATED)" : "");
+    }
+
+    fprintf(out, "\nstring fields (memory backend, %u fields, names and values longer than the std::string inline buffer)\n", STRING_FIELD_COUNT);
+    fprintf(out, "  %-24s %12s %10s %12s\n", "scenario", "updates/s", "ns/update", "allocs/upd");
+    for (auto iter = string_results.begin(); iter != string_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %12.0f %10.1f %12.3f%s\n",
+                iter->scenario,
+                iter->num_updates / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_updates,
+                static_cast<double>(iter->num_allocations) / iter->num_updates,
+                0 != iter->num_allocations ? "  (ALLOCATED)" : "");
+    }
+
+    fprintf(out, "\nschema fields (memory backend, %u uint32_t fields declared at compile time)\n", SCHEMA_FIELD_COUNT);
+    fprintf(out, "  %-24s %12s %10s %12s\n", "scenario", "updates/s", "ns/update", "allocs/upd");
+    for (auto iter = schema_results.begin(); iter != schema_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %12.0f %10.1f %12.3f%s\n",
+                iter->scenario,
+                iter->num_updates / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_updates,
+                static_cast<double>(iter->num_allocations) / iter->num_updates,
+                0 != iter->num_allocations ? "  (ALLOCATED)" : "");
+    }
+
+    fprintf(out, "\nupdate log (memory backend, %u uint32_t fields, a frame every %u passes)\n", UPDATE_LOG_FIELD_COUNT, UPDATE_LOG_PASSES_PER_FRAME);
+    fprintf(out, "  %-24s %12s %10s %12s %10s %12s\n", "scenario", "updates/s", "ns/update", "allocs/upd", "dropped", "log bytes");
+    for (auto iter = update_log_results.begin(); iter != update_log_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %12.0f %10.1f %12.3f %10lu %12lu\n",
+                iter->scenario,
+                iter->num_updates / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_updates,
+                static_cast<double>(iter->num_allocations) / iter->num_updates,
+                static_cast<unsigned long>(iter->num_dropped),
+                static_cast<unsigned long>(iter->log_len));
+    }
+
+    fprintf(out, "\nsparkline samples (memory backend, %u columns, %zu samples per block)\n", SPARKLINE_WIDTH, SPARKLINE_BLOCK_LEN);
+    fprintf(out, "  %-24s %8s %12s %10s %12s\n", "scenario", "history", "samples/s", "ns/sample", "allocs/smp");
+    for (auto iter = sparkline_results.begin(); iter != sparkline_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %8zu %12.0f %10.2f %12.3f\n",
+                iter->scenario,
+                iter->history_len,
+                iter->num_samples / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_samples,
+                static_cast<double>(iter->num_allocations) / iter->num_samples);
+    }
+
+    fprintf(out, "\ntable window (memory backend, %u visible rows)\n", TABLE_VISIBLE_ROWS);
+    fprintf(out, "  %-24s %8s %12s %10s %12s %12s\n", "scenario", "rows", "ops/s", "ns/op", "cells/op", "allocs/op");
+    for (auto iter = table_results.begin(); iter != table_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %8zu %12.0f %10.1f %12.2f %12.3f\n",
+                iter->scenario,
+                iter->num_rows,
+                iter->num_ops / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_ops,
+                static_cast<double>(iter->cells_written) / iter->num_ops,
+                static_cast<double>(iter->num_allocations) / iter->num_ops);
+    }
+
+    fprintf(out, "\nshared-memory telemetry (memory backend, %u bound slots, frames include the publishes)\n", SHM_SLOT_COUNT);
+    fprintf(out, "  %-24s %12s %10s %12s\n", "scenario", "ops/s", "ns/op", "allocs/op");
+    for (auto iter = shm_results.begin(); iter != shm_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %12.0f %10.1f %12.3f\n",
+                iter->scenario,
+                iter->num_ops / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_ops,
+                static_cast<double>(iter->num_allocations) / iter->num_ops);
+    }
+
+    fprintf(out, "\nupdate socket (memory backend, %u fields, one batch per client per frame)\n", SOCKET_FIELD_COUNT);
+    fprintf(out, "  %-8s %12s %10s %12s\n", "clients", "records/s", "ns/record", "allocs/rec");
+    for (auto iter = socket_results.begin(); iter != socket_results.end(); ++iter)
+    {
+        fprintf(out, "  %-8u %12.0f %10.1f %12.3f\n",
+                iter->num_clients,
+                iter->num_records / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_records,
+                static_cast<double>(iter->num_allocations) / iter->num_records);
+    }
+
+    fprintf(out, "\nlayout file (memory backend, %u windows, %u banded fields)\n", LAYOUT_WINDOW_COUNT, LAYOUT_WINDOW_COUNT * LAYOUT_FIELDS_PER_WINDOW);
+    fprintf(out, "  %-24s %10s\n", "scenario", "ms/op");
+    for (auto iter = layout_results.begin(); iter != layout_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %10.2f\n",
+                iter->scenario,
+                iter->elapsed_sec * 1.0e3 / iter->num_ops);
+    }
+
+    fprintf(out, "\nterminal resize (memory backend, %u fields, %u and %u columns)\n", RESIZE_FIELD_COUNT, RESIZE_SCREEN_COLS[0], RESIZE_SCREEN_COLS[1]);
+    fprintf(out, "  %-24s %10s %12s %12s\n", "scenario", "ms/resize", "relayouts", "cells/resize");
+    for (auto iter = resize_results.begin(); iter != resize_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %10.3f %12lu %12.0f\n",
+                iter->scenario,
+                iter->elapsed_sec * 1.0e3 / iter->num_resizes,
+                static_cast<unsigned long>(iter->num_relayouts),
+                static_cast<double>(iter->cells_written) / iter->num_resizes);
+    }
+
+    fprintf(out, "\ntask scheduler (%u tasks every %ld ms, %zu workers, %ld ms slow task)\n",
+            SCHEDULER_TASK_COUNT,
+            static_cast<long>(SCHEDULER_TASK_PERIOD.count()),
+            ncurses_cpp::NCURSES_TASK_DEFAULT_WORKER_COUNT,
+            static_cast<long>(SCHEDULER_SLOW_TASK_RUN_TIME.count()));
+    fprintf(out, "  %-24s %10s %12s %12s %10s %10s\n", "scenario", "runs/s", "delay avg us", "delay max us", "late", "overruns");
+    for (auto iter = scheduler_results.begin(); iter != scheduler_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %10.0f %12.1f %12.1f %10lu %10lu\n",
+                iter->scenario,
+                iter->num_runs / iter->elapsed_sec,
+                iter->start_delay_avg_us,
+                iter->start_delay_max_us,
+                static_cast<unsigned long>(iter->late_count),
+                static_cast<unsigned long>(iter->overrun_count));
+    }
+
+    fprintf(out, "\ncolor pairs (memory backend, %u fields, cache sized for 256 colors)\n", COLOR_FIELD_COUNT);
+    fprintf(out, "  %-24s %8s %12s %10s %12s %12s\n", "scenario", "colors", "ops/s", "ns/op", "evictions", "allocs/op");
+    for (auto iter = color_results.begin(); iter != color_results.end(); ++iter)
+    {
+        fprintf(out, "  %-24s %8u %12.0f %10.1f %12lu %12.3f\n",
+                iter->scenario,
+                iter->num_colors,
+                iter->num_ops / iter->elapsed_sec,
+                iter->elapsed_sec * 1.0e9 / iter->num_ops,
+                static_cast<unsigned long>(iter->num_evictions),
+                static_cast<double>(iter->num_allocations) / iter->num_ops);
+    }
+
+    fprintf(out, "\nsystem collector (/proc/stat, meminfo, loadavg, net/dev, diskstats)\n");
+    if (collector_result.available)
+    {
+        fprintf(out, "  %10s %12s\n", "us/sample", "allocs/smp");
+        fprintf(out, "  %10.2f %12.3f\n",
+                collector_result.elapsed_sec * 1.0e6 / collector_result.num_samples,
+                static_cast<double>(collector_result.num_allocations) / collector_result.num_samples);
+    }
+    else
+    {
+        fprintf(out, "  not available\n");
+    }
+}
+
+static void print_json_results(FILE * out, const std::vector<threshold_result_t>& threshold_results, const std::vector<field_update_result_t>& field_update_results, const std::vector<string_result_t>& string_results, const std::vector<schema_result_t>& schema_results, const std::vector<update_log_result_t>& update_log_results, const std::vector<sparkline_result_t>& sparkline_results, const std::vector<table_result_t>& table_results, const std::vector<shm_result_t>& shm_results, const std::vector<socket_result_t>& socket_results, const std::vector<layout_result_t>& layout_results, const std::vector<resize_result_t>& resize_results, const std::vector<scheduler_result_t>& scheduler_results, const std::vector<color_result_t>& color_results, const collector_result_t& collector_result)
+{
+    fprintf(out, "{\n  \"threshold_classification\": [\n");
+    for (size_t i = 0; i < threshold_results.size(); ++i)
+    {
+        const threshold_result_t& result = threshold_results[i];
+        fprintf(out, "    { \"bands\": %u, \"indexed_ns_per_op\": %.3f, \"linear_ns_per_op\": %.3f, \"mismatch\": %s }%s\n",
+                result.num_bands,
+                result.indexed_ns_per_op,
+                result.linear_ns_per_op,
+                result.mismatch ? "true" : "false",
+                i + 1 < threshold_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"field_updates\": [\n");
+    for (size_t i = 0; i < field_update_results.size(); ++i)
+    {
+        const field_update_result_t& result = field_update_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"backend\": \"%s\", \"fields\": %u, \"updates\": %lu, \"frames\": %lu, "
+                "\"updates_per_sec\": %.1f, \"ns_per_update\": %.3f, \"%s_per_frame\": %.1f, \"allocs_per_update\": %.4f }%s\n",
+                result.scenario,
+                get_backend_name(result.backend),
+                result.num_fields,
+                static_cast<unsigned long>(result.num_updates),
+                static_cast<unsigned long>(result.num_frames),
+                result.num_updates / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_updates,
+                BENCH_BACKEND_MEMORY == result.backend ? "cells" : "bytes",
+                static_cast<double>(result.output_written) / result.num_frames,
+                static_cast<double>(result.num_allocations) / result.num_updates,
+                i + 1 < field_update_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"string_fields\": [\n");
+    for (size_t i = 0; i < string_results.size(); ++i)
+    {
+        const string_result_t& result = string_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"fields\": %u, \"updates\": %lu, "
+                "\"updates_per_sec\": %.1f, \"ns_per_update\": %.3f, \"allocations\": %lu }%s\n",
+                result.scenario,
+                STRING_FIELD_COUNT,
+                static_cast<unsigned long>(result.num_updates),
+                result.num_updates / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_updates,
+                static_cast<unsigned long>(result.num_allocations),
+                i + 1 < string_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"schema_fields\": [\n");
+    for (size_t i = 0; i < schema_results.size(); ++i)
+    {
+        const schema_result_t& result = schema_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"fields\": %u, \"updates\": %lu, "
+                "\"updates_per_sec\": %.1f, \"ns_per_update\": %.3f, \"allocations\": %lu }%s\n",
+                result.scenario,
+                SCHEMA_FIELD_COUNT,
+                static_cast<unsigned long>(result.num_updates),
+                result.num_updates / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_updates,
+                static_cast<unsigned long>(result.num_allocations),
+                i + 1 < schema_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"update_log\": [\n");
+    for (size_t i = 0; i < update_log_results.size(); ++i)
+    {
+        const update_log_result_t& result = update_log_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"fields\": %u, \"updates\": %lu, "
+                "\"updates_per_sec\": %.1f, \"ns_per_update\": %.3f, \"allocations\": %lu, \"dropped\": %lu, \"log_bytes\": %lu }%s\n",
+                result.scenario,
+                UPDATE_LOG_FIELD_COUNT,
+                static_cast<unsigned long>(result.num_updates),
+                result.num_updates / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_updates,
+                static_cast<unsigned long>(result.num_allocations),
+                static_cast<unsigned long>(result.num_dropped),
+                static_cast<unsigned long>(result.log_len),
+                i + 1 < update_log_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"sparkline_samples\": [\n");
+    for (size_t i = 0; i < sparkline_results.size(); ++i)
+    {
+        const sparkline_result_t& result = sparkline_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"history\": %zu, \"samples\": %lu, "
+                "\"samples_per_sec\": %.1f, \"ns_per_sample\": %.3f, \"allocs_per_sample\": %.4f }%s\n",
+                result.scenario,
+                result.history_len,
+                static_cast<unsigned long>(result.num_samples),
+                result.num_samples / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_samples,
+                static_cast<double>(result.num_allocations) / result.num_samples,
+                i + 1 < sparkline_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"table_window\": [\n");
+    for (size_t i = 0; i < table_results.size(); ++i)
+    {
+        const table_result_t& result = table_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"rows\": %zu, \"ops\": %lu, "
+                "\"ops_per_sec\": %.1f, \"ns_per_op\": %.3f, \"cells_per_op\": %.3f, \"allocs_per_op\": %.4f }%s\n",
+                result.scenario,
+                result.num_rows,
+                static_cast<unsigned long>(result.num_ops),
+                result.num_ops / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_ops,
+                static_cast<double>(result.cells_written) / result.num_ops,
+                static_cast<double>(result.num_allocations) / result.num_ops,
+                i + 1 < table_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"shm_telemetry\": [\n");
+    for (size_t i = 0; i < shm_results.size(); ++i)
+    {
+        const shm_result_t& result = shm_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"slots\": %u, \"ops\": %lu, "
+                "\"ops_per_sec\": %.1f, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f }%s\n",
+                result.scenario,
+                SHM_SLOT_COUNT,
+                static_cast<unsigned long>(result.num_ops),
+                result.num_ops / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_ops,
+                static_cast<double>(result.num_allocations) / result.num_ops,
+                i + 1 < shm_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"update_socket\": [\n");
+    for (size_t i = 0; i < socket_results.size(); ++i)
+    {
+        const socket_result_t& result = socket_results[i];
+        fprintf(out, "    { \"clients\": %u, \"fields\": %u, \"records\": %lu, "
+                "\"records_per_sec\": %.1f, \"ns_per_record\": %.3f, \"allocs_per_record\": %.4f }%s\n",
+                result.num_clients,
+                SOCKET_FIELD_COUNT,
+                static_cast<unsigned long>(result.num_records),
+                result.num_records / result.elapsed_sec,
+                result.elapsed_sec * 1.0e9 / result.num_records,
+                static_cast<double>(result.num_allocations) / result.num_records,
+                i + 1 < socket_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"layout\": [\n");
+    for (size_t i = 0; i < layout_results.size(); ++i)
+    {
+        const layout_result_t& result = layout_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"windows\": %u, \"fields\": %u, \"ops\": %lu, \"ms_per_op\": %.3f }%s\n",
+                result.scenario,
+                LAYOUT_WINDOW_COUNT,
+                LAYOUT_WINDOW_COUNT * LAYOUT_FIELDS_PER_WINDOW,
+                static_cast<unsigned long>(result.num_ops),
+                result.elapsed_sec * 1.0e3 / result.num_ops,
+                i + 1 < layout_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"resize\": [\n");
+    for (size_t i = 0; i < resize_results.size(); ++i)
+    {
+        const resize_result_t& result = resize_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"fields\": %u, \"resizes\": %lu, \"ms_per_resize\": %.4f, \"relayouts\": %lu, \"cells_per_resize\": %.1f }%s\n",
+                result.scenario,
+                RESIZE_FIELD_COUNT,
+                static_cast<unsigned long>(result.num_resizes),
+                result.elapsed_sec * 1.0e3 / result.num_resizes,
+                static_cast<unsigned long>(result.num_relayouts),
+                static_cast<double>(result.cells_written) / result.num_resizes,
+                i + 1 < resize_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"scheduler\": [\n");
+    for (size_t i = 0; i < scheduler_results.size(); ++i)
+    {
+        const scheduler_result_t& result = scheduler_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"tasks\": %u, \"period_ms\": %ld, \"runs\": %lu, \"runs_per_sec\": %.1f, \"start_delay_avg_us\": %.2f, \"start_delay_max_us\": %.2f, \"late\": %lu, \"overruns\": %lu }%s\n",
+                result.scenario,
+                SCHEDULER_TASK_COUNT,
+                static_cast<long>(SCHEDULER_TASK_PERIOD.count()),
+                static_cast<unsigned long>(result.num_runs),
+                result.num_runs / result.elapsed_sec,
+                result.start_delay_avg_us,
+                result.start_delay_max_us,
+                static_cast<unsigned long>(result.late_count),
+                static_cast<unsigned long>(result.overrun_count),
+                i + 1 < scheduler_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"color_pairs\": [\n");
+    for (size_t i = 0; i < color_results.size(); ++i)
+    {
+        const color_result_t& result = color_results[i];
+        fprintf(out, "    { \"scenario\": \"%s\", \"colors\": %u, \"ops\": %lu, \"ns_per_op\": %.2f, \"evictions\": %lu, \"allocs_per_op\": %.4f }%s\n",
+                result.scenario,
+                result.num_colors,
+                static_cast<unsigned long>(result.num_ops),
+                result.elapsed_sec * 1.0e9 / result.num_ops,
+                static_cast<unsigned long>(result.num_evictions),
+                static_cast<double>(result.num_allocations) / result.num_ops,
+                i + 1 < color_results.size() ? "," : "");
+    }
+
+    fprintf(out, "  ],\n  \"system_collector\": { \"available\": %s, \"samples\": %lu, \"us_per_sample\": %.3f, \"allocs_per_sample\": %.4f }\n}\n",
+            collector_result.available ? "true" : "false",
+            static_cast<unsigned long>(collector_result.num_samples),
+            collector_result.available ? collector_result.elapsed_sec * 1.0e6 / collector_result.num_samples : 0.0,
+            collector_result.available ? static_cast<double>(collector_result.num_allocations) / collector_result.num_samples : 0.0);
+
+}
+
+int main(int argc, char *argv[])
+{
+    bool json_output = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strcmp(argv[i], "--json"))
+        {
+            json_output = true;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    /* results go to the original stdout; anything the library prints while the
+     *  benchmarks run is sent to stderr so that it cannot corrupt the results */
+    fflush(stdout);
+    FILE * results_out = fdopen(dup(STDOUT_FILENO), "w");
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    /* the pty size has to come from the terminal, not from the environment */
+    setenv("TERM", "xterm", 0);
+    unsetenv("LINES");
+    unsetenv("COLUMNS");
+
+    std::vector<threshold_result_t> threshold_results;
+    run_threshold_benchmark(threshold_results);
+
+    std::vector<field_update_result_t> field_update_results;
+    const bench_update_method_e update_methods[] = { BENCH_UPDATE_BY_NAME, BENCH_UPDATE_BY_HANDLE, BENCH_POST_UPDATE };
+    const bench_backend_e backends[] = { BENCH_BACKEND_TERMINAL, BENCH_BACKEND_DIFF, BENCH_BACKEND_MEMORY };
+    for (size_t k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k)
+    {
+        for (size_t i = 0; i < sizeof(FIELD_COUNTS) / sizeof(FIELD_COUNTS[0]); ++i)
+        {
+            for (size_t j = 0; j < sizeof(update_methods) / sizeof(update_methods[0]); ++j)
+            {
+                field_update_result_t result;
+                if (!run_field_update_benchmark(FIELD_COUNTS[i], update_methods[j], backends[k], result))
+                {
+                    fprintf(stderr, "unable to run %s with %u fields on the %s backend\n",
+                            get_scenario_name(update_methods[j]), FIELD_COUNTS[i], get_backend_name(backends[k]));
+                    return 1;
+                }
+
+                field_update_results.push_back(result);
+            }
+        }
+    }
+
+    std::vector<string_result_t> string_results;
+    for (int string_method = BENCH_STRING_BY_NAME; string_method <= BENCH_STRING_POSTED; ++string_method)
+    {
+        string_result_t result;
+        if (!run_string_benchmark(static_cast<bench_string_method_e>(string_method), result))
+        {
+            fprintf(stderr, "unable to run the string field benchmark\n");
+            return 1;
+        }
+
+        string_results.push_back(result);
+    }
+
+    std::vector<schema_result_t> schema_results;
+    for (int schema_method = BENCH_SCHEMA_BY_NAME; schema_method <= BENCH_SCHEMA_UPDATE; ++schema_method)
+    {
+        schema_result_t result;
+        if (!run_schema_benchmark(static_cast<bench_schema_method_e>(schema_method), result))
+        {
+            fprintf(stderr, "unable to run the schema benchmark\n");
+            return 1;
+        }
+
+        schema_results.push_back(result);
+    }
+
+    std::vector<update_log_result_t> update_log_results;
+    for (int log_method = BENCH_UPDATE_LOG_OFF; log_method <= BENCH_UPDATE_LOG_DECODE; ++log_method)
+    {
+        update_log_result_t result;
+        if (!run_update_log_benchmark(static_cast<bench_update_log_method_e>(log_method), result))
+        {
+            fprintf(stderr, "unable to run the update log benchmark\n");
+            return 1;
+        }
+
+        update_log_results.push_back(result);
+    }
+
+    std::vector<sparkline_result_t> sparkline_results;
+    for (size_t i = 0; i < sizeof(SPARKLINE_HISTORY_LENS) / sizeof(SPARKLINE_HISTORY_LENS[0]); ++i)
+    {
+        for (int add_in_blocks = 0; add_in_blocks < 2; ++add_in_blocks)
+        {
+            sparkline_result_t result;
+            if (!run_sparkline_benchmark(SPARKLINE_HISTORY_LENS[i], 0 != add_in_blocks, result))
+            {
+                fprintf(stderr, "unable to run the sparkline benchmark with a history of %zu samples\n", SPARKLINE_HISTORY_LENS[i]);
+                return 1;
+            }
+
+            sparkline_results.push_back(result);
+        }
+    }
+
+    std::vector<table_result_t> table_results;
+    for (size_t i = 0; i < sizeof(TABLE_ROW_COUNTS) / sizeof(TABLE_ROW_COUNTS[0]); ++i)
+    {
+        for (int scroll_table = 0; scroll_table < 2; ++scroll_table)
+        {
+            table_result_t result;
+            if (!run_table_benchmark(TABLE_ROW_COUNTS[i], 0 != scroll_table, result))
+            {
+                fprintf(stderr, "unable to run the table benchmark with %zu rows\n", TABLE_ROW_COUNTS[i]);
+                return 1;
+            }
+
+            table_results.push_back(result);
+        }
+    }
+
+    std::vector<shm_result_t> shm_results;
+    if (!run_shm_benchmark(shm_results))
+    {
+        fprintf(stderr, "unable to run the shared-memory telemetry benchmark\n");
+        return 1;
+    }
+
+    std::vector<socket_result_t> socket_results;
+    for (size_t i = 0; i < sizeof(SOCKET_CLIENT_COUNTS) / sizeof(SOCKET_CLIENT_COUNTS[0]); ++i)
+    {
+        socket_result_t result;
+        if (!run_socket_benchmark(SOCKET_CLIENT_COUNTS[i], result))
+        {
+            fprintf(stderr, "unable to run the update socket benchmark with %u clients\n", SOCKET_CLIENT_COUNTS[i]);
+            return 1;
+        }
+
+        socket_results.push_back(result);
+    }
+
+    std::vector<layout_result_t> layout_results;
+    if (!run_layout_benchmark(layout_results))
+    {
+        fprintf(stderr, "unable to run the layout benchmark\n");
+        return 1;
+    }
+
+    std::vector<resize_result_t> resize_results;
+    for (int anchored_window = 1; anchored_window >= 0; --anchored_window)
+    {
+        resize_result_t result;
+        if (!run_resize_benchmark(0 != anchored_window, result))
+        {
+            fprintf(stderr, "unable to run the resize benchmark\n");
+            return 1;
+        }
+
+        resize_results.push_back(result);
+    }
+
+    std::vector<scheduler_result_t> scheduler_results;
+    for (int with_slow_task = 0; with_slow_task < 2; ++with_slow_task)
+    {
+        scheduler_result_t result;
+        run_scheduler_benchmark(0 != with_slow_task, result);
+        scheduler_results.push_back(result);
+    }
+
+    /* the terminal cases left the cache sized for the pseudo-terminal */
+    ncurses_cpp::get_color_pair_cache().attach_screen(256, 256, COLOR_BLACK);
+    ncurses_cpp::get_color_pair_cache().detach_screen();
+
+    std::vector<color_result_t> color_results;
+    for (int use_gradient = 0; use_gradient < 2; ++use_gradient)
+    {
+        color_result_t result;
+        if (!run_color_field_benchmark(0 != use_gradient, result))
+        {
+            fprintf(stderr, "unable to run the color benchmark\n");
+            return 1;
+        }
+
+        color_results.push_back(result);
+    }
+    for (size_t i = 0; i < sizeof(COLOR_LOOKUP_COUNTS) / sizeof(COLOR_LOOKUP_COUNTS[0]); ++i)
+    {
+        color_result_t result;
+        run_color_lookup_benchmark(COLOR_LOOKUP_COUNTS[i], result);
+        color_results.push_back(result);
+    }
+
+    collector_result_t collector_result;
+    run_collector_benchmark(collector_result);
+
+    if (json_output)
+    {
+        print_json_results(results_out, threshold_results, field_update_results, string_results, schema_results, update_log_results, sparkline_results, table_results, shm_results, socket_results, layout_results, resize_results, scheduler_results, color_results, collector_result);
+    }
+    else
+    {
+        print_text_results(results_out, threshold_results, field_update_results, string_results, schema_results, update_log_results, sparkline_results, table_results, shm_results, socket_results, layout_results, resize_results, scheduler_results, color_results, collector_result);
+    }
+
+    fclose(results_out);
+
+    uint32_t num_allocating = count_allocating_results(field_update_results) +
+                              count_allocating_results(string_results) +
+                              count_allocating_results(schema_results);
+    if (num_allocating > 0)
+    {
+        fprintf(stderr, "%u update benchmarks allocated in the steady state\n", num_allocating);
+        return 1;
+    }
+
+    return 0;
+}
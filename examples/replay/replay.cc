@@ -0,0 +1,589 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     replay.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Plays back a field update log recorded by an ncurses_ui.
+ *
+ * @section  DESCRIPTION
+ *
+ * Reads a log written by ncurses_ui::start_recording() (see
+ *  ncurses_update_log.h) and feeds every update back through the path the
+ *  update socket uses, at the recorded pace, N times faster or as fast as
+ *  possible. Frames are committed every 1/60 s of recorded time, so a replay
+ *  draws the same frames whatever its speed.
+ *
+ *  The updates go to the windows of a layout file when one is given. Otherwise
+ *  a window is built for every window in the log, with a labelled field for
+ *  each recorded field and a sparkline for each recorded sparkline. With
+ *  --socket the updates are sent to a running user interface instead, and
+ *  with --headless they are drawn on the in-memory backend, whose final screen
+ *  is printed. The number of updates replayed and the replay rate are printed
+ *  once the user interface is gone.
+ *
+ *  usage: replay <log> [--speed N | --max] [--layout <file>] [--socket <path>] [--headless]
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ncurses.h>
+
+#include "ncurses_colors.h"
+#include "ncurses_memory_backend.h"
+#include "ncurses_socket_client.h"
+#include "ncurses_ui.h"
+#include "ncurses_update_log.h"
+#include "ncurses_window.h"
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* frames are committed at this interval of recorded time */
+const uint64_t REPLAY_FRAME_INTERVAL_NS = 1000000000ULL / 60;
+
+const uint32_t REPLAY_VALUE_WIDTH = 20;
+const uint32_t REPLAY_SPARKLINE_WIDTH = 40;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct replay_options_t
+{
+    std::string                                               log_path;
+    double                                                    speed;
+    std::string                                               layout_path;
+    std::string                                               socket_path;
+    bool                                                      headless;
+};
+
+struct replay_field_t
+{
+    std::string                                               field_name;
+    ncurses_cpp::ncurses_field_type_e                         field_type;
+    uint32_t                                                  value_width;
+};
+
+struct replay_window_t
+{
+    std::string                                               window_name;
+    std::vector<replay_field_t>                               fields;
+    uint32_t                                                  label_width;
+};
+
+struct replay_result_t
+{
+    uint64_t                                                  replayed_count;
+    uint64_t                                                  skipped_count;
+
+    /* updates in a color pair the socket protocol cannot carry, sent in DEFAULT */
+    uint64_t                                                  uncolored_count;
+    uint64_t                                                  frame_count;
+    double                                                    elapsed_sec;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS DECLARATION
+ *****************************************************************************/
+
+/* exposes the window management and the update staging of the ncurses_ui */
+class replay_ui : public ncurses_cpp::ncurses_ui
+{
+public:
+
+    replay_ui(void)
+      : ncurses_ui('q', 0)
+    { }
+
+    replay_ui(std::unique_ptr<ncurses_cpp::ncurses_backend> backend)
+      : ncurses_ui('q', 0, std::move(backend))
+    { }
+
+    using ncurses_ui::add_window;
+    using ncurses_ui::stage_update;
+};
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static void print_usage(void)
+{
+    fprintf(stderr, "usage: replay <log> [--speed N | --max] [--layout <file>] [--socket <path>] [--headless]\n");
+}
+
+static bool parse_options(int argc, char *argv[], replay_options_t& options)
+{
+    options.speed = 1.0;
+    options.headless = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--speed") == 0 &&
+            i + 1 < argc)
+        {
+            options.speed = strtod(argv[++i], nullptr);
+            if (!(options.speed > 0.0))
+            {
+                return false;
+            }
+        }
+        else if (strcmp(argv[i], "--max") == 0)
+        {
+            /* zero replays without pacing */
+            options.speed = 0.0;
+        }
+        else if (strcmp(argv[i], "--layout") == 0 &&
+                 i + 1 < argc)
+        {
+            options.layout_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--socket") == 0 &&
+                 i + 1 < argc)
+        {
+            options.socket_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--headless") == 0)
+        {
+            options.headless = true;
+        }
+        else if ('-' != argv[i][0] &&
+                 options.log_path.empty())
+        {
+            options.log_path = argv[i];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return !options.log_path.empty();
+}
+
+static const char * get_value_format(ncurses_cpp::ncurses_field_type_e field_type)
+{
+    switch (field_type)
+    {
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_STRING:
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_BOOL:
+        return "%s";
+
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_UINT32:
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_UINT64:
+        return "%u";
+
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_FLOAT:
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_DOUBLE:
+        return "%.3f";
+
+    default:
+        return "%d";
+    }
+}
+
+template <typename T>
+static bool add_value_field(ncurses_cpp::ncurses_window& window, uint32_t x, uint32_t y, const replay_field_t& field)
+{
+    return window.add_field<T>(x, y, field.field_name, get_value_format(field.field_type), T()).is_valid();
+}
+
+static bool add_replay_field(ncurses_cpp::ncurses_window& window, uint32_t x, uint32_t y, const replay_field_t& field)
+{
+    switch (field.field_type)
+    {
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_STRING:         return add_value_field<std::string>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_INT32:          return add_value_field<int32_t>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_UINT32:         return add_value_field<uint32_t>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_FLOAT:          return add_value_field<float>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_DOUBLE:         return add_value_field<double>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_INT64:          return add_value_field<int64_t>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_UINT64:         return add_value_field<uint64_t>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_BOOL:           return add_value_field<bool>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_NANOSECONDS:    return add_value_field<std::chrono::nanoseconds>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_MICROSECONDS:   return add_value_field<std::chrono::microseconds>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_MILLISECONDS:   return add_value_field<std::chrono::milliseconds>(window, x, y, field);
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_SECONDS:        return add_value_field<std::chrono::seconds>(window, x, y, field);
+
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES:
+        return window.add_sparkline<float>(x, y, field.field_name, field.value_width, field.value_width).is_valid();
+
+    case ncurses_cpp::NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES:
+        return window.add_sparkline<double>(x, y, field.field_name, field.value_width, field.value_width).is_valid();
+
+    default:
+        return false;
+    }
+}
+
+/* collects the windows and fields of the log, in the order they were recorded; a
+ *  field that was registered again, e.g. after a layout reload, is kept once */
+static std::vector<replay_window_t> collect_windows(ncurses_cpp::ncurses_update_log_reader& reader)
+{
+    std::vector<replay_window_t> windows;
+    std::vector<std::pair<size_t, size_t>> field_slots;
+
+    ncurses_cpp::ncurses_update_log_record_t record;
+    while (true)
+    {
+        bool have_record = reader.read_update(record);
+
+        /* take in the definitions read so far, including the ones after the last update */
+        for (size_t field_id = field_slots.size(); field_id < reader.get_field_count(); ++field_id)
+        {
+            const ncurses_cpp::ncurses_update_log_field_t * log_field = reader.get_field(static_cast<uint32_t>(field_id));
+
+            size_t window_idx = 0;
+            while (window_idx < windows.size() &&
+                   windows[window_idx].window_name != log_field->window_name)
+            {
+                window_idx++;
+            }
+            if (window_idx == windows.size())
+            {
+                replay_window_t window;
+                window.window_name = log_field->window_name;
+                window.label_width = 0;
+                windows.push_back(window);
+            }
+
+            replay_window_t& window = windows[window_idx];
+            size_t field_idx = 0;
+            while (field_idx < window.fields.size() &&
+                   window.fields[field_idx].field_name != log_field->field_name)
+            {
+                field_idx++;
+            }
+            if (field_idx == window.fields.size() &&
+                !ncurses_cpp::ncurses_window::is_reserved_field(log_field->field_name))
+            {
+                replay_field_t field;
+                field.field_name = log_field->field_name;
+                field.field_type = log_field->field_type;
+                field.value_width = ncurses_cpp::NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES == field.field_type ||
+                                    ncurses_cpp::NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES == field.field_type ? REPLAY_SPARKLINE_WIDTH :
+                                    ncurses_cpp::NCURSES_CPP_FIELD_TYPE_STRING == field.field_type ? 1 : REPLAY_VALUE_WIDTH;
+                window.fields.push_back(field);
+                window.label_width = std::max(window.label_width, static_cast<uint32_t>(field.field_name.size()));
+            }
+
+            field_slots.push_back(std::make_pair(window_idx, field_idx));
+        }
+
+        if (!have_record)
+        {
+            break;
+        }
+
+        /* string fields are as wide as their longest value */
+        const std::pair<size_t, size_t>& slot = field_slots[record.field_id];
+        if (slot.second < windows[slot.first].fields.size() &&
+            ncurses_cpp::NCURSES_CPP_FIELD_TYPE_STRING == record.value.type)
+        {
+            replay_field_t& field = windows[slot.first].fields[slot.second];
+            field.value_width = std::max(field.value_width, static_cast<uint32_t>(record.value.str_len));
+        }
+    }
+
+    reader.rewind();
+
+    return windows;
+}
+
+static uint32_t get_window_height(const replay_window_t& window)
+{
+    return static_cast<uint32_t>(window.fields.size()) + 2;
+}
+
+static uint32_t get_window_width(const replay_window_t& window)
+{
+    uint32_t value_width = 0;
+    for (auto iter = window.fields.begin(); iter != window.fields.end(); ++iter)
+    {
+        value_width = std::max(value_width, iter->value_width);
+    }
+
+    /* the title needs room too */
+    uint32_t width = std::max(window.label_width + 1 + value_width, static_cast<uint32_t>(window.window_name.size()) + 2);
+    return width + 4;
+}
+
+/* stacks a window for each recorded window from the top of the screen; windows
+ *  that do not fit are left out */
+static void build_windows(replay_ui& ui, const std::vector<replay_window_t>& windows)
+{
+    uint32_t row = 0;
+
+    for (auto iter = windows.begin(); iter != windows.end(); ++iter)
+    {
+        std::shared_ptr<ncurses_cpp::ncurses_window> window(new ncurses_cpp::ncurses_window(iter->window_name));
+        if (!window->create_window(get_window_height(*iter), get_window_width(*iter), row, 0))
+        {
+            continue;
+        }
+        window->add_title(iter->window_name);
+
+        uint32_t value_x = 2 + iter->label_width + 1;
+        for (size_t field_idx = 0; field_idx < iter->fields.size(); ++field_idx)
+        {
+            const replay_field_t& field = iter->fields[field_idx];
+            uint32_t y = static_cast<uint32_t>(field_idx) + 1;
+
+            window->add_field<std::string>(2, y, field.field_name + ".label", "%s", field.field_name);
+            add_replay_field(*window, value_x, y, field);
+        }
+
+        ui.add_window(window);
+        row += get_window_height(*iter);
+    }
+}
+
+/* replays every update through the given function, pacing them against the recorded
+ *  times unless the speed is zero and calling frame_function at each frame boundary */
+template <typename UpdateFunction, typename FrameFunction>
+static void replay_log(ncurses_cpp::ncurses_update_log_reader& reader, double speed, UpdateFunction update_function, FrameFunction frame_function, replay_result_t& result)
+{
+    std::chrono::steady_clock::time_point replay_start = std::chrono::steady_clock::now();
+    uint64_t next_frame_ns = REPLAY_FRAME_INTERVAL_NS;
+
+    ncurses_cpp::ncurses_update_log_record_t record;
+    while (reader.read_update(record))
+    {
+        if (record.time_ns >= next_frame_ns)
+        {
+            frame_function();
+            result.frame_count++;
+            next_frame_ns = (record.time_ns / REPLAY_FRAME_INTERVAL_NS + 1) * REPLAY_FRAME_INTERVAL_NS;
+        }
+
+        if (speed > 0.0)
+        {
+            std::chrono::nanoseconds offset(static_cast<int64_t>(static_cast<double>(record.time_ns) / speed));
+            std::this_thread::sleep_until(replay_start + offset);
+        }
+
+        const ncurses_cpp::ncurses_update_log_field_t * field = reader.get_field(record.field_id);
+        if (update_function(*field, record))
+        {
+            result.replayed_count++;
+        }
+        else
+        {
+            result.skipped_count++;
+        }
+    }
+
+    frame_function();
+    result.frame_count++;
+
+    result.elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - replay_start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    replay_options_t options;
+    if (!parse_options(argc, argv, options))
+    {
+        print_usage();
+        return 1;
+    }
+
+    ncurses_cpp::ncurses_update_log_reader reader;
+    if (!reader.open_log(options.log_path))
+    {
+        fprintf(stderr, "%s: not an update log\n", options.log_path.c_str());
+        return 1;
+    }
+
+    replay_result_t result = { 0, 0, 0, 0, 0.0 };
+    std::string startup_error;
+    std::vector<std::string> final_screen;
+
+    if (!options.socket_path.empty())
+    {
+        ncurses_cpp::ncurses_socket_client client;
+        if (!client.connect_socket(options.socket_path))
+        {
+            fprintf(stderr, "%s: cannot connect\n", options.socket_path.c_str());
+            return 1;
+        }
+
+        replay_log(reader, options.speed,
+                   [&client, &result](const ncurses_cpp::ncurses_update_log_field_t& field, const ncurses_cpp::ncurses_update_log_record_t& record)
+                   {
+                       if (record.has_pair_colors)
+                       {
+                           result.uncolored_count++;
+                       }
+                       return client.add_update(field.window_name, field.field_name, record.value, record.color);
+                   },
+                   [&client](void) { client.flush(); },
+                   result);
+    }
+    else
+    {
+        std::vector<replay_window_t> windows;
+        uint32_t screen_rows = 1;
+        uint32_t screen_cols = 1;
+        if (options.layout_path.empty())
+        {
+            windows = collect_windows(reader);
+            for (auto iter = windows.begin(); iter != windows.end(); ++iter)
+            {
+                screen_rows += get_window_height(*iter);
+                screen_cols = std::max(screen_cols, get_window_width(*iter));
+            }
+        }
+        else
+        {
+            /* room for whatever the layout asks for */
+            screen_rows = 200;
+            screen_cols = 300;
+        }
+
+        /* the user interface owns the terminal, so results are printed after it is gone */
+        {
+            ncurses_cpp::ncurses_memory_backend * memory_backend = nullptr;
+            std::unique_ptr<replay_ui> ui_ptr;
+            if (options.headless)
+            {
+                memory_backend = new ncurses_cpp::ncurses_memory_backend(screen_rows, screen_cols);
+                ui_ptr.reset(new replay_ui(std::unique_ptr<ncurses_cpp::ncurses_backend>(memory_backend)));
+            }
+            else
+            {
+                ui_ptr.reset(new replay_ui());
+            }
+            replay_ui& ui = *ui_ptr;
+            ui.set_frame_commit_mode(true);
+
+            if (options.layout_path.empty())
+            {
+                build_windows(ui, windows);
+            }
+            else if (!ui.load_layout(options.layout_path, false))
+            {
+                startup_error = ui.get_layout_error();
+            }
+
+            if (startup_error.empty())
+            {
+                /* each pair stays pinned until the user interface is gone */
+                std::map<std::pair<ncurses_cpp::ncurses_color_t, ncurses_cpp::ncurses_color_t>, ncurses_cpp::ncurses_cpp_text_colors_e> pairs;
+
+                replay_log(reader, options.speed,
+                           [&ui, &pairs](const ncurses_cpp::ncurses_update_log_field_t& field, const ncurses_cpp::ncurses_update_log_record_t& record)
+                           {
+                               ncurses_cpp::ncurses_cpp_text_colors_e color = record.color;
+                               if (record.has_pair_colors)
+                               {
+                                   auto key = std::make_pair(record.foreground, record.background);
+                                   auto pair_iter = pairs.find(key);
+                                   if (pairs.end() == pair_iter)
+                                   {
+                                       pair_iter = pairs.insert(std::make_pair(key, ncurses_cpp::get_color_pair(record.foreground, record.background))).first;
+                                   }
+                                   color = pair_iter->second;
+                               }
+                               return ui.stage_update(field.window_name, field.field_name, record.value, color);
+                           },
+                           [&ui](void) { ui.flush_updates(); },
+                           result);
+
+                if (nullptr != memory_backend)
+                {
+                    for (uint32_t y = 0; y < memory_backend->get_rows(); ++y)
+                    {
+                        final_screen.push_back(memory_backend->get_row_text(y));
+                    }
+                }
+                else
+                {
+                    /* the final screen stays up until the shutdown key */
+                    ui.run();
+                }
+            }
+        }
+    }
+
+    if (!startup_error.empty())
+    {
+        fprintf(stderr, "%s\n", startup_error.c_str());
+        return 1;
+    }
+
+    for (auto iter = final_screen.begin(); iter != final_screen.end(); ++iter)
+    {
+        printf("%s\n", iter->c_str());
+    }
+
+    printf("replayed %llu updates (%llu skipped) in %llu frames over %.3f s, %.0f updates/s\n",
+           static_cast<unsigned long long>(result.replayed_count),
+           static_cast<unsigned long long>(result.skipped_count),
+           static_cast<unsigned long long>(result.frame_count),
+           result.elapsed_sec,
+           result.elapsed_sec > 0.0 ? static_cast<double>(result.replayed_count) / result.elapsed_sec : 0.0);
+
+    if (result.uncolored_count > 0)
+    {
+        printf("%llu updates in color pairs were sent in the default color\n",
+               static_cast<unsigned long long>(result.uncolored_count));
+    }
+
+    if (reader.is_corrupt())
+    {
+        fprintf(stderr, "%s: stopped at a record that could not be decoded\n", options.log_path.c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_backend.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend interface for the ncurses_cpp library.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines the interface between the ncurses_cpp fields, windows and user
+ *  interface and whatever actually holds the screen contents. The terminal
+ *  backend draws through curses; the memory backend keeps the screen as a grid
+ *  of cells so that the library can run without a terminal.
+ *  Like curses itself, the library draws on the currently active backend; an
+ *  ncurses_ui makes its backend the active one when it starts up.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_BACKEND_H__
+#define __NCURSES_BACKEND_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ncurses_colors.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+class ncurses_backend;
+
+/* windows are created on the active backend; returns nullptr if there is none */
+ncurses_backend * get_active_backend(void);
+void set_active_backend(ncurses_backend * backend);
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* a rectangular region of the screen with its own contents */
+class ncurses_backend_window
+{
+public:
+
+    virtual ~ncurses_backend_window(void) { }
+
+    /* backends that limit their output per frame draw higher priority windows first
+     *  and defer the lowest priority ones; other backends ignore the priority */
+    void set_priority(int32_t priority) { m_priority = priority; }
+    int32_t get_priority(void) const { return m_priority; }
+
+    /* text that does not fit on the line wraps onto the next one; returns false if
+     *  the text ran past the end of the window */
+    virtual bool draw_text(uint32_t x, uint32_t y, const char * text, size_t text_len, ncurses_cpp_text_colors_e text_color) = 0;
+
+    virtual void draw_outline(void) = 0;
+
+    /* pushes the changed window contents to the screen right away */
+    virtual void refresh(void) = 0;
+
+    /* copies the changed window contents into the next frame without pushing them to
+     *  the screen; returns true if there were any changes */
+    virtual bool stage(void) = 0;
+
+    /* marks the whole window as changed */
+    virtual void touch(void) = 0;
+
+protected:
+
+    ncurses_backend_window(void)
+      : m_priority(0)
+    { }
+
+private:
+
+    int32_t                                                   m_priority;
+};
+
+class ncurses_backend
+{
+public:
+
+    virtual ~ncurses_backend(void) { }
+
+    virtual bool open_screen(void) = 0;
+    virtual void close_screen(void) = 0;
+
+    virtual uint32_t get_rows(void) const = 0;
+    virtual uint32_t get_cols(void) const = 0;
+
+    /* picks up a new screen size after read_char() returned KEY_RESIZE; the whole
+     *  screen is repainted by the next frame, so every window must be staged again */
+    virtual void handle_resize(void) = 0;
+
+    /* covers the whole screen underneath all other windows */
+    virtual ncurses_backend_window * get_screen_window(void) = 0;
+
+    virtual std::unique_ptr<ncurses_backend_window> create_window(uint32_t height, uint32_t width, uint32_t begin_y, uint32_t begin_x) = 0;
+
+    /* pushes everything staged since the previous frame to the screen */
+    virtual void commit_frame(void) = 0;
+
+    /* true if the last frame held back staged output that a later frame must push */
+    virtual bool has_deferred_output(void) const { return false; }
+
+    /* never blocks; returns ERR if no input is available */
+    virtual int read_char(void) = 0;
+
+    /* the character is returned by a later read_char() call */
+    virtual void push_char(int ch) = 0;
+
+    /* descriptor to wait on for input, or -1 if input only arrives via push_char() */
+    virtual int get_input_fd(void) const = 0;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_BACKEND_H__
@@ -0,0 +1,127 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_color_gradient.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Maps a numeric value onto a range of colors.
+ *
+ * @section  DESCRIPTION
+ *
+ * A gradient covers [min_value, max_value] with a fixed number of steps. The
+ *  colors of the steps are blended in RGB between the color stops when the
+ *  gradient is created, and the pair for each step is pinned in the color pair
+ *  cache at the same time, so looking up the color of a value is a clamp and an
+ *  index into a table. On an 8-color terminal neighboring steps usually map to
+ *  the same pair. A gradient can be shared by any number of fields.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_COLOR_GRADIENT_H__
+#define __NCURSES_COLOR_GRADIENT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "ncurses_colors.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const size_t NCURSES_CPP_GRADIENT_DEFAULT_STEPS = 32;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_color_gradient
+{
+public:
+
+    ncurses_color_gradient(void);
+    virtual ~ncurses_color_gradient(void);
+
+    /* the stops are spread evenly over the range; fails unless max_value is above
+     *  min_value and there is at least one stop and one step */
+    bool create_gradient(double min_value, double max_value, const std::vector<ncurses_color_t>& stops, ncurses_color_t background);
+    bool create_gradient(double min_value, double max_value, const std::vector<ncurses_color_t>& stops, ncurses_color_t background, size_t num_steps);
+
+    /* values outside the range get the color of the nearest end; NaN gets the
+     *  default color */
+    ncurses_cpp_text_colors_e get_color(double value) const
+    {
+        if (m_step_colors.empty() ||
+            value != value)
+        {
+            return NCURSES_CPP_TXT_COLOR_DEFAULT;
+        }
+
+        double position = (value - m_min_value) * m_steps_per_unit;
+        size_t idx = position <= 0.0 ? 0 : (position >= m_last_step ? m_step_colors.size() - 1 : static_cast<size_t>(position));
+        return m_step_colors[idx];
+    }
+
+    size_t get_num_steps(void) const { return m_step_colors.size(); }
+
+private:
+
+    ncurses_color_gradient(const ncurses_color_gradient&) = delete;
+    ncurses_color_gradient& operator=(const ncurses_color_gradient&) = delete;
+
+    void release_pairs(void);
+
+    double                                                    m_min_value;
+    double                                                    m_steps_per_unit;
+    double                                                    m_last_step;
+
+    /* pinned pairs, one per step */
+    std::vector<ncurses_cpp_text_colors_e>                    m_step_colors;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_COLOR_GRADIENT_H__
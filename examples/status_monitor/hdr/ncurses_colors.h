@@ -35,6 +35,16 @@
  *
  * Defines helper methods for working with ncurses colors.
  *
+ * Text colors are curses color pairs. The first eight pairs are set up by
+ *  init_colors() and named by ncurses_cpp_text_colors_e; any other combination of
+ *  foreground and background, including 256-color palette entries and RGB
+ *  values, gets a pair on demand from the ncurses_color_pair_cache. The cache
+ *  reuses the least recently requested unpinned pair once the terminal runs out,
+ *  which changes the colors of any text still drawn with it, so the pairs handed
+ *  out for drawing, such as the steps of a gradient, are always pinned. RGB values are
+ *  shown as the nearest color the terminal has, because the curses library that
+ *  is linked only supports short color numbers.
+ *
  * @section  HISTORY
  *
  * 03-Apr-2021  OrthogonalHawk  File created.
@@ -48,6 +58,9 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
+#include <cstdint>
+#include <vector>
+
 #include <ncurses.h>
 
 
@@ -57,11 +70,20 @@ namespace ncurses_cpp {
  *                                 CONSTANTS
  *****************************************************************************/
 
+/* a foreground or background color: a palette index, the terminal default or an
+ *  RGB value made with ncurses_rgb() */
+typedef int32_t ncurses_color_t;
+
+const ncurses_color_t NCURSES_CPP_COLOR_DEFAULT = -1;
+const ncurses_color_t NCURSES_CPP_COLOR_RGB_FLAG = 0x1000000;
+
 /******************************************************************************
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
 
-typedef enum {
+/* the named colors are the pairs set up by init_colors(); values past the last one
+ *  are pairs handed out by the ncurses_color_pair_cache */
+typedef enum : int16_t {
     NCURSES_CPP_TXT_COLOR_DEFAULT = 0,
     NCURSES_CPP_TXT_COLOR_BLACK,
     NCURSES_CPP_TXT_COLOR_RED,
@@ -73,6 +95,18 @@ typedef enum {
     NCURSES_CPP_TXT_COLOR_WHITE
 } ncurses_cpp_text_colors_e;
 
+/* pair cache statistics; evictions are the pair churn, which keeps rising while the
+ *  terminal's pair limit is being thrashed */
+struct ncurses_color_pair_stats_t
+{
+    uint64_t                                                  hit_count;
+    uint64_t                                                  miss_count;
+    uint64_t                                                  eviction_count;
+
+    /* requests that fell back to a named color because every pair was pinned */
+    uint64_t                                                  exhausted_count;
+};
+
 
 /******************************************************************************
  *                                  MACROS
@@ -86,11 +120,106 @@ bool init_colors(int text_background_color);
 
 bool init_colors(void);
 
+constexpr ncurses_color_t ncurses_rgb(uint8_t red, uint8_t green, uint8_t blue)
+{
+    return NCURSES_CPP_COLOR_RGB_FLAG | (static_cast<ncurses_color_t>(red) << 16) | (static_cast<ncurses_color_t>(green) << 8) | blue;
+}
+
+/* the RGB value of a palette index or RGB color, using the xterm palette */
+bool get_color_rgb(ncurses_color_t color, uint8_t& red, uint8_t& green, uint8_t& blue);
+
+class ncurses_color_pair_cache;
+
+/* the cache used by the user interface thread; not thread-safe */
+ncurses_color_pair_cache& get_color_pair_cache(void);
+
+/* the pair to draw text in the given colors with; shorthand for
+ *  get_color_pair_cache().pin_pair(), so the pair keeps its colors until it is
+ *  unpinned. once every pair is pinned the nearest named color is returned. */
+ncurses_cpp_text_colors_e get_color_pair(ncurses_color_t foreground, ncurses_color_t background);
+
 
 /******************************************************************************
  *                            CLASS DECLARATION
  *****************************************************************************/
 
+class ncurses_color_pair_cache
+{
+public:
+
+    ncurses_color_pair_cache(void);
+    virtual ~ncurses_color_pair_cache(void);
+
+    /* sizes the cache for a screen and sets up the pairs already in use on it; called
+     *  by init_colors(). until then, e.g. on the memory backend, pairs are handed out
+     *  for a 256-color terminal without calling into curses. */
+    void attach_screen(int max_pairs, int num_colors, ncurses_color_t named_background);
+
+    /* called before the screen is deleted; the pairs stay assigned */
+    void detach_screen(void) { m_screen_attached = false; }
+
+    /* the pair for the colors after they are mapped to the terminal's colors; a
+     *  named color is returned where one matches. the pair is not pinned, so a later
+     *  request for other colors may evict it and recolor everything drawn with it;
+     *  use pin_pair() for pairs that text is drawn with. */
+    ncurses_cpp_text_colors_e get_pair(ncurses_color_t foreground, ncurses_color_t background);
+
+    /* a pinned pair is never evicted; every pin_pair() needs an unpin_pair() once
+     *  nothing drawn with the pair is left on screen */
+    ncurses_cpp_text_colors_e pin_pair(ncurses_color_t foreground, ncurses_color_t background);
+    void unpin_pair(ncurses_cpp_text_colors_e pair);
+
+    /* the terminal colors of any pair, for backends that write color sequences
+     *  themselves; returns false for the default colors and unknown pairs */
+    bool get_pair_colors(ncurses_cpp_text_colors_e pair, short& foreground, short& background) const;
+
+    /* maps a color to the nearest one the terminal can show */
+    ncurses_color_t resolve_color(ncurses_color_t color) const;
+
+    size_t get_capacity(void) const { return m_max_pair >= FIRST_DYNAMIC_PAIR ? m_max_pair - FIRST_DYNAMIC_PAIR + 1 : 0; }
+    const ncurses_color_pair_stats_t& get_stats(void) const { return m_stats; }
+
+private:
+
+    static const int FIRST_DYNAMIC_PAIR = NCURSES_CPP_TXT_COLOR_WHITE + 1;
+    static const int MAX_PAIRS = 256;
+    static const int NUM_RESOLVED_COLORS = 257;
+
+    struct slot_t
+    {
+        short                                                 foreground;
+        short                                                 background;
+        bool                                                  in_use;
+        uint32_t                                              pin_count;
+        int16_t                                               prev;
+        int16_t                                               next;
+    };
+
+    ncurses_cpp_text_colors_e find_pair(ncurses_color_t foreground, ncurses_color_t background, bool pin);
+    static size_t get_key(short foreground, short background);
+    void unmap_slot(int pair);
+    void unlink_slot(int pair);
+    void link_slot_front(int pair);
+    void link_slot_back(int pair);
+    void init_curses_pair(int pair);
+
+    bool                                                      m_screen_attached;
+    bool                                                      m_default_colors_enabled;
+    int                                                       m_max_pair;
+    int                                                       m_num_colors;
+    short                                                     m_named_background;
+
+    /* the pair for every pair of resolved colors, or zero */
+    std::vector<int16_t>                                      m_pairs_by_key;
+
+    /* the dynamic pairs that can be reused, most recently requested first */
+    std::vector<slot_t>                                       m_slots;
+    int16_t                                                   m_lru_head;
+    int16_t                                                   m_lru_tail;
+
+    ncurses_color_pair_stats_t                                m_stats;
+};
+
 }; /* end of the ncurses_cpp namespace */
 
 #endif // __NCURSES_COLORS_H__
@@ -0,0 +1,204 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_diff_backend.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend that diffs whole frames and writes its own output.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a terminal rendering backend for slow links (serial consoles, high
+ *  latency SSH) where the bytes on the wire matter more than CPU time. The
+ *  screen is kept as a back buffer, built up by the staged windows, and a front
+ *  buffer holding what the terminal shows. Committing a frame diffs the two and
+ *  emits the shortest cursor movement and color change sequences the terminal
+ *  supports (see terminfo(5)) to bring the terminal up to date.
+ *  An optional byte budget limits the output per frame. Windows are written in
+ *  order of priority; once the budget is used up the remaining, lowest priority
+ *  windows are deferred to the next frame.
+ *  Curses is still used to set up the terminal and to read input.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_DIFF_BACKEND_H__
+#define __NCURSES_DIFF_BACKEND_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_memory_backend.h"
+#include "ncurses_terminal_backend.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_diff_backend : public ncurses_memory_backend
+{
+public:
+
+    /* uses the process' controlling terminal */
+    ncurses_diff_backend(void);
+
+    /* uses the terminal behind term_out/term_in (see newterm()) */
+    ncurses_diff_backend(FILE * term_out, FILE * term_in);
+
+    virtual ~ncurses_diff_backend(void);
+
+    bool open_screen(void) override;
+    void close_screen(void) override;
+    void handle_resize(void) override;
+
+    void commit_frame(void) override;
+    bool has_deferred_output(void) const override { return m_has_deferred_output; }
+
+    int read_char(void) override { return m_terminal.read_char(); }
+    void push_char(int ch) override { m_terminal.push_char(ch); }
+    int get_input_fd(void) const override { return m_terminal.get_input_fd(); }
+
+    /* limits the bytes written per frame; zero removes the limit. The highest
+     *  priority window with changes is always written, even if it alone exceeds the
+     *  budget, so that every frame makes progress. Combined with a maximum frame rate
+     *  the budget bounds the bytes per second sent to the terminal. */
+    void set_frame_byte_budget(uint32_t max_bytes_per_frame) { m_frame_byte_budget = max_bytes_per_frame; }
+    uint32_t get_frame_byte_budget(void) const { return m_frame_byte_budget; }
+
+    uint64_t get_bytes_written(void) const { return m_bytes_written; }
+
+    /* number of times a window had to wait for a later frame */
+    uint64_t get_deferred_window_count(void) const { return m_deferred_window_count; }
+
+    void stage_cells(const ncurses_backend_window * window, uint32_t begin_y, uint32_t begin_x, uint32_t row, const ncurses_memory_cell_t * cells, uint32_t num_cells) override;
+    void release_window(const ncurses_backend_window * window) override;
+
+private:
+
+    /* terminfo strings; nullptr if the terminal does not have the capability */
+    struct terminal_caps_t
+    {
+        const char *                                          cursor_address;
+        const char *                                          clear_screen;
+        const char *                                          carriage_return;
+        const char *                                          cursor_right;
+        const char *                                          cursor_left;
+        const char *                                          cursor_down;
+        const char *                                          cursor_up;
+        const char *                                          parm_right_cursor;
+        const char *                                          parm_left_cursor;
+        const char *                                          parm_down_cursor;
+        const char *                                          parm_up_cursor;
+        const char *                                          set_a_foreground;
+        const char *                                          set_a_background;
+        const char *                                          orig_pair;
+        const char *                                          exit_attribute_mode;
+    };
+
+    /* the changed cells of one window, in screen order */
+    struct window_batch_t
+    {
+        const ncurses_backend_window *                        window;
+        int32_t                                               priority;
+        std::vector<uint32_t>                                 cells;
+    };
+
+    void load_terminal_caps(void);
+    window_batch_t& get_window_batch(const ncurses_backend_window * window);
+    void emit_batch(const window_batch_t& batch, std::string& out);
+    void move_cursor(uint32_t x, uint32_t y, std::string& out);
+    bool add_vertical_move(uint32_t from_y, uint32_t to_y, std::string& out) const;
+    bool add_horizontal_move(uint32_t from_x, uint32_t to_x, uint32_t y, bool allow_overwrite, std::string& out) const;
+    void set_color(ncurses_cpp_text_colors_e color, std::string& out);
+    void write_output(const std::string& output);
+
+    ncurses_terminal_backend                                  m_terminal;
+    FILE *                                                    m_term_out;
+    terminal_caps_t                                           m_caps;
+
+    /* window that last staged each cell of the back buffer */
+    std::vector<const ncurses_backend_window *>               m_cell_owners;
+
+    /* reused from frame to frame so that committing a frame does not allocate */
+    std::vector<window_batch_t>                               m_batches;
+    size_t                                                    m_num_batches;
+    std::vector<size_t>                                       m_batch_order;
+    std::string                                               m_frame_output;
+    std::string                                               m_batch_output;
+    std::string                                               m_best_move;
+    std::string                                               m_candidate_move;
+
+    /* terminal state as of the output generated so far */
+    bool                                                      m_cursor_known;
+    uint32_t                                                  m_cursor_x;
+    uint32_t                                                  m_cursor_y;
+    bool                                                      m_color_known;
+    ncurses_cpp_text_colors_e                                 m_current_color;
+
+    /* the colors of the current pair when it was set; a cached pair can be set up
+     *  again with other colors */
+    short                                                     m_current_foreground;
+    short                                                     m_current_background;
+
+    uint32_t                                                  m_frame_byte_budget;
+    bool                                                      m_has_deferred_output;
+    uint64_t                                                  m_bytes_written;
+    uint64_t                                                  m_deferred_window_count;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_DIFF_BACKEND_H__
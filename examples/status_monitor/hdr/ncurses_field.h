@@ -48,12 +48,18 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
-#include <ncurses.h>
-
+#include "ncurses_backend.h"
+#include "ncurses_color_gradient.h"
 #include "ncurses_colors.h"
+#include "ncurses_field_format.h"
+#include "ncurses_field_value.h"
+#include "ncurses_update_recorder.h"
 
 namespace ncurses_cpp {
 
@@ -61,10 +67,23 @@ namespace ncurses_cpp {
  *                                 CONSTANTS
  *****************************************************************************/
 
+/* longest text a single field can show, including the NUL terminator; longer
+ *  renders are truncated */
+const size_t NCURSES_CPP_FIELD_RENDER_CAPACITY = 256;
+
 /******************************************************************************
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
 
+/* shared between an ncurses_window and its fields; when frame commit mode is
+ *  enabled the fields only draw into the window and leave the terminal flush
+ *  to the ncurses_ui frame commit */
+struct ncurses_refresh_state_t
+{
+    bool                                                      frame_commit_mode;
+    uint64_t                                                  deferred_refresh_count;
+};
+
 /******************************************************************************
  *                                  MACROS
  *****************************************************************************/
@@ -77,44 +96,208 @@ namespace ncurses_cpp {
  *                            CLASS DECLARATION
  *****************************************************************************/
 
+/* type-independent interface to a field so that updates can be queued and applied
+ *  without knowing the field type at compile time */
+class ncurses_field_base
+{
+public:
+
+    static const uint32_t NO_PENDING_SLOT = UINT32_MAX;
+
+    ncurses_field_base(void) : m_pending_slot(NO_PENDING_SLOT), m_update_recorder(nullptr), m_record_id(0) { }
+    virtual ~ncurses_field_base(void) { }
+
+    virtual ncurses_field_type_e get_field_type(void) const = 0;
+
+    /* fails if the value does not match the field type */
+    virtual bool apply_update(const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color) = 0;
+
+    /* copies out the current value; fields without a single current value fail */
+    virtual bool get_value(ncurses_field_value_t& field_val) const { (void)field_val; return false; }
+
+    /* draws the field's current contents on a new backend window, e.g. after the
+     *  owning window was recreated for a new screen size; nullptr hides the field */
+    virtual bool move_to_window(ncurses_backend_window * window) = 0;
+
+    /* fields that keep a history of values, e.g. sparklines, must see every queued
+     *  value rather than just the latest one. the update coalescer hands them each
+     *  value through record_value() as it is staged and then redraws them once per
+     *  commit through redraw_field() instead of calling apply_update(). */
+    virtual bool keeps_value_history(void) const { return false; }
+    virtual bool record_value(const ncurses_field_value_t& field_val) { (void)field_val; return false; }
+    virtual bool redraw_field(ncurses_cpp_text_colors_e field_color) { (void)field_color; return false; }
+
+    /* records every later update of the field under the given id; nullptr stops
+     *  recording */
+    void set_update_recorder(ncurses_update_recorder * update_recorder, uint32_t record_id)
+    {
+        m_update_recorder = update_recorder;
+        m_record_id = record_id;
+    }
+
+protected:
+
+    bool is_recorded(void) const { return nullptr != m_update_recorder; }
+
+    void record_update(const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color) const
+    {
+        m_update_recorder->record_update(m_record_id, field_val, field_color);
+    }
+
+private:
+
+    friend class ncurses_update_coalescer;
+
+    /* index of this field's entry in the coalescer's pending list */
+    uint32_t                                                  m_pending_slot;
+
+    ncurses_update_recorder *                                 m_update_recorder;
+    uint32_t                                                  m_record_id;
+};
+
 template <typename T>
-class ncurses_field
+class ncurses_field : public ncurses_field_base
 {
 public:
 
+    /* a closed [first, second] value range and the color used inside it */
+    typedef std::pair<std::pair<T, T>, ncurses_cpp_text_colors_e> threshold_band_t;
+
     ncurses_field(void);
     virtual ~ncurses_field(void);
 
-    bool create_field(WINDOW * window, uint32_t x, uint32_t y, std::string format_str, T default_val);
-    bool create_field(WINDOW * window, uint32_t x, uint32_t y, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color);
+    ncurses_field_type_e get_field_type(void) const override { return ncurses_field_value_traits<T>::type; }
+    bool apply_update(const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color) override;
+    bool get_value(ncurses_field_value_t& field_val) const override;
+    bool move_to_window(ncurses_backend_window * window) override;
+
+    /* fails if the format does not compile for the field type */
+    bool create_field(ncurses_backend_window * window, uint32_t x, uint32_t y, std::string format_str, T default_val);
+    bool create_field(ncurses_backend_window * window, uint32_t x, uint32_t y, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color);
 
     virtual bool update_field(void);
 
-    bool update_field(T field_val);
-    bool update_field(T field_val, ncurses_cpp_text_colors_e field_color);
+    bool update_field(const T& field_val);
+    bool update_field(const T& field_val, ncurses_cpp_text_colors_e field_color);
+
+    /* takes the value over instead of copying it; for string fields the previous
+     *  value's storage is handed back in field_val, so a caller that keeps moving the
+     *  same std::string in never allocates */
+    bool update_field(T&& field_val);
+    bool update_field(T&& field_val, ncurses_cpp_text_colors_e field_color);
 
     bool add_field_thresholds(std::pair<T, T> field_threshold_vals, ncurses_cpp_text_colors_e field_color);
 
+    /* replaces all thresholds at once, sorting them a single time; returns false if
+     *  any band was rejected because its range was empty */
+    bool set_field_thresholds(const std::vector<threshold_band_t>& field_thresholds);
+
+    /* where bands overlap, the band with the lowest range wins */
+    ncurses_cpp_text_colors_e get_color_based_on_thresholds(const T& field_val);
+
+    /* colors values that fall outside every threshold band; only numeric fields use
+     *  a gradient. the gradient may be shared with other fields. */
+    void set_color_gradient(std::shared_ptr<const ncurses_color_gradient> gradient) { m_color_gradient = gradient; }
+
+    void set_refresh_state(ncurses_refresh_state_t * refresh_state) { m_refresh_state = refresh_state; }
+
+    /* forces the next update to redraw even if the value has not changed, e.g. after
+     *  the window contents were cleared */
+    void invalidate_rendered_image(void) { m_rendered_valid = false; }
+
+    uint64_t get_write_count(void) const { return m_write_count; }
+    uint64_t get_skip_count(void) const { return m_skip_count; }
+
 private:
 
     struct field_thresholds_t
     {
-        bool operator==(const field_thresholds_t& other) { return threshold == other.threshold && color == other.color; }
+        bool operator==(const field_thresholds_t& other) const { return threshold == other.threshold && color == other.color; }
 
         std::pair<T, T>             threshold;
         ncurses_cpp_text_colors_e   color;
     };
 
     static bool compare_threshold_vals(const field_thresholds_t& a, const field_thresholds_t& b);
-    ncurses_cpp_text_colors_e get_color_based_on_thresholds(T field_val);
+    static size_t count_points_below(const std::vector<T>& points, const T& field_val, std::true_type is_arithmetic);
+    static size_t count_points_below(const std::vector<T>& points, const T& field_val, std::false_type is_arithmetic);
+    void rebuild_threshold_index(void);
+    ncurses_cpp_text_colors_e get_value_color(const T& field_val);
+    void record_field_update(const T& field_val, ncurses_cpp_text_colors_e field_color);
+    size_t format_value(const T& field_val);
+    bool draw_text(size_t text_len, ncurses_cpp_text_colors_e field_color);
+    void refresh_window(void);
 
-    WINDOW *                                                  m_window;
+    ncurses_backend_window *                                  m_window;
     uint32_t                                                  m_x;
     uint32_t                                                  m_y;
-    std::string                                               m_format_str;
+    ncurses_field_format                                      m_format;
     T                                                         m_current_value;
     ncurses_cpp_text_colors_e                                 m_default_color;
     std::vector<field_thresholds_t>                           m_threshold_vals;
+
+    /* the bands flattened into disjoint pieces: every distinct band endpoint and the
+     *  open gaps around them, each with the color that applies there */
+    bool                                                      m_threshold_index_valid;
+    std::vector<T>                                            m_threshold_points;
+    std::vector<ncurses_cpp_text_colors_e>                    m_threshold_point_colors;
+    std::vector<ncurses_cpp_text_colors_e>                    m_threshold_gap_colors;
+
+    std::shared_ptr<const ncurses_color_gradient>             m_color_gradient;
+
+    ncurses_refresh_state_t *                                 m_refresh_state;
+    T                                                         m_applied_value;
+
+    /* last image written to the window, used to suppress redundant redraws */
+    char                                                      m_rendered_text[NCURSES_CPP_FIELD_RENDER_CAPACITY];
+    size_t                                                    m_rendered_len;
+    ncurses_cpp_text_colors_e                                 m_rendered_color;
+    bool                                                      m_rendered_valid;
+    uint64_t                                                  m_write_count;
+    uint64_t                                                  m_skip_count;
+};
+
+/* lightweight reference to a field that was resolved once by name; updates through
+ *  a handle go straight to the field without any lookups. a handle remains valid
+ *  until the owning ncurses_window is cleaned up. */
+template <typename T>
+class ncurses_field_handle
+{
+public:
+
+    ncurses_field_handle(void) : m_field(nullptr) { }
+    explicit ncurses_field_handle(ncurses_field<T> * field) : m_field(field) { }
+
+    bool is_valid(void) const { return nullptr != m_field; }
+    ncurses_field<T> * get_field(void) const { return m_field; }
+    explicit operator bool(void) const { return is_valid(); }
+
+    bool update_field(const T& field_val)
+    {
+        return nullptr != m_field && m_field->update_field(field_val);
+    }
+
+    bool update_field(const T& field_val, ncurses_cpp_text_colors_e field_color)
+    {
+        return nullptr != m_field && m_field->update_field(field_val, field_color);
+    }
+
+    bool update_field(T&& field_val)
+    {
+        return nullptr != m_field && m_field->update_field(std::move(field_val));
+    }
+
+    bool update_field(T&& field_val, ncurses_cpp_text_colors_e field_color)
+    {
+        return nullptr != m_field && m_field->update_field(std::move(field_val), field_color);
+    }
+
+    uint64_t get_write_count(void) const { return nullptr != m_field ? m_field->get_write_count() : 0; }
+    uint64_t get_skip_count(void) const { return nullptr != m_field ? m_field->get_skip_count() : 0; }
+
+private:
+
+    ncurses_field<T> *                                        m_field;
 };
 
 }; /* end of the ncurses_cpp namespace */
@@ -0,0 +1,228 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_field_format.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Pre-compiled printf-style format for ncurses fields.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a printf-style format that is parsed once, when a field is created,
+ *  into a short program: literal text, at most one typed conversion and more
+ *  literal text.
+ *  The conversion is checked against the field type at compile time so that a
+ *  mismatched format (e.g. "%s" on an int32_t field) is rejected instead of
+ *  being undefined behaviour. Rendering writes straight into a caller supplied
+ *  buffer; integer and fixed-point conversions avoid printf entirely.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_FIELD_FORMAT_H__
+#define __NCURSES_FIELD_FORMAT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ncurses_field_value.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_field_format
+{
+public:
+
+    ncurses_field_format(void);
+    virtual ~ncurses_field_format(void);
+
+    /* returns false if the format is malformed, has more than one conversion or
+     *  has a conversion that does not match the field type */
+    bool compile(const std::string& format_str, ncurses_field_type_e field_type);
+
+    /* the same check as compile() for a format that is known at compile time, e.g.
+     *  static_assert(ncurses_field_format::is_valid_format("%5.1f", NCURSES_CPP_FIELD_TYPE_FLOAT), ...) */
+    static constexpr bool is_valid_format(const char * format_str, ncurses_field_type_e field_type)
+    {
+        return 0 <= scan_literal(format_str, field_type, 0);
+    }
+
+    bool is_compiled(void) const { return m_compiled; }
+
+    /* each render call writes a NUL-terminated string into the buffer, truncating
+     *  if necessary, and returns the number of characters written */
+    size_t render(const std::string& field_val, char * buf, size_t buf_size) const;
+    size_t render(int32_t field_val, char * buf, size_t buf_size) const;
+    size_t render(uint32_t field_val, char * buf, size_t buf_size) const;
+    size_t render(float field_val, char * buf, size_t buf_size) const;
+    size_t render(double field_val, char * buf, size_t buf_size) const;
+    size_t render(int64_t field_val, char * buf, size_t buf_size) const;
+    size_t render(uint64_t field_val, char * buf, size_t buf_size) const;
+
+    /* "%s" renders "true" or "false"; integer conversions render 1 or 0 */
+    size_t render(bool field_val, char * buf, size_t buf_size) const;
+
+    /* durations render their tick count through an integer conversion */
+    template <typename Rep, typename Period>
+    size_t render(const std::chrono::duration<Rep, Period>& field_val, char * buf, size_t buf_size) const
+    {
+        return render(static_cast<int64_t>(field_val.count()), buf, buf_size);
+    }
+
+private:
+
+    struct conversion_t
+    {
+        char                                                  specifier;
+        bool                                                  left_justify;
+        bool                                                  force_sign;
+        bool                                                  space_sign;
+        bool                                                  zero_pad;
+        bool                                                  alternate_form;
+        int                                                   width;
+        int                                                   precision;
+    };
+
+    struct output_t;
+
+    static constexpr const char * get_valid_specifiers(ncurses_field_type_e field_type)
+    {
+        /* sparklines are drawn without a format */
+        return NCURSES_CPP_FIELD_TYPE_STRING == field_type ? "s" :
+               NCURSES_CPP_FIELD_TYPE_BOOL == field_type ? "sdiu" :
+               (NCURSES_CPP_FIELD_TYPE_FLOAT == field_type ||
+                NCURSES_CPP_FIELD_TYPE_DOUBLE == field_type) ? "fFeEgGaA" :
+               (NCURSES_CPP_FIELD_TYPE_INT32 == field_type ||
+                NCURSES_CPP_FIELD_TYPE_UINT32 == field_type ||
+                NCURSES_CPP_FIELD_TYPE_INT64 == field_type ||
+                NCURSES_CPP_FIELD_TYPE_UINT64 == field_type ||
+                NCURSES_CPP_FIELD_TYPE_NANOSECONDS == field_type ||
+                NCURSES_CPP_FIELD_TYPE_MICROSECONDS == field_type ||
+                NCURSES_CPP_FIELD_TYPE_MILLISECONDS == field_type ||
+                NCURSES_CPP_FIELD_TYPE_SECONDS == field_type) ? "diuoxXc" : "";
+    }
+
+    static constexpr bool contains_char(const char * text, char ch)
+    {
+        return '\0' != *text && (ch == *text || contains_char(text + 1, ch));
+    }
+
+    static constexpr bool specifier_matches_type(char specifier, ncurses_field_type_e field_type)
+    {
+        return '\0' != specifier && contains_char(get_valid_specifiers(field_type), specifier);
+    }
+
+    /* compile-time mirror of the compile() parser; each step returns the number of
+     *  conversions seen so far, or -1 once the format is known to be invalid */
+    static constexpr int scan_literal(const char * format_str, ncurses_field_type_e field_type, int num_conversions)
+    {
+        return '\0' == format_str[0] ? num_conversions :
+               '%' != format_str[0] ? scan_literal(format_str + 1, field_type, num_conversions) :
+               '%' == format_str[1] ? scan_literal(format_str + 2, field_type, num_conversions) :
+               0 != num_conversions ? -1 :
+               scan_flags(format_str + 1, field_type);
+    }
+
+    static constexpr int scan_flags(const char * format_str, ncurses_field_type_e field_type)
+    {
+        return contains_char("-+ 0#", format_str[0]) ? scan_flags(format_str + 1, field_type) :
+                                                        scan_width(format_str, field_type);
+    }
+
+    static constexpr int scan_width(const char * format_str, ncurses_field_type_e field_type)
+    {
+        return ('0' <= format_str[0] && '9' >= format_str[0]) ? scan_width(format_str + 1, field_type) :
+               '.' == format_str[0] ? scan_precision(format_str + 1, field_type) :
+                                      scan_modifiers(format_str, field_type);
+    }
+
+    static constexpr int scan_precision(const char * format_str, ncurses_field_type_e field_type)
+    {
+        return ('0' <= format_str[0] && '9' >= format_str[0]) ? scan_precision(format_str + 1, field_type) :
+                                                                 scan_modifiers(format_str, field_type);
+    }
+
+    static constexpr int scan_modifiers(const char * format_str, ncurses_field_type_e field_type)
+    {
+        return contains_char("hlLqjzt", format_str[0]) ? scan_modifiers(format_str + 1, field_type) :
+               specifier_matches_type(format_str[0], field_type) ? scan_literal(format_str + 1, field_type, 1) : -1;
+    }
+
+    size_t render_text(const char * text, size_t text_len, char * buf, size_t buf_size) const;
+    size_t render_signed(int64_t field_val, char * buf, size_t buf_size) const;
+    size_t render_unsigned(uint64_t field_val, char * buf, size_t buf_size) const;
+    size_t render_floating(double field_val, char * buf, size_t buf_size) const;
+
+    void put_integer(output_t& out, bool negative, uint64_t magnitude) const;
+    bool put_fixed_point(output_t& out, double field_val) const;
+    void put_padded(output_t& out, const char * prefix, size_t prefix_len, size_t num_zeros, const char * body, size_t body_len, bool zero_fill) const;
+
+    bool                                                      m_compiled;
+    bool                                                      m_has_conversion;
+
+    /* the compiled program: literal text, the conversion, then more literal text */
+    std::string                                               m_prefix;
+    conversion_t                                              m_conversion;
+    std::string                                               m_suffix;
+
+    /* single-conversion printf format used for the rare cases without a fast path */
+    std::string                                               m_fallback_spec;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_FIELD_FORMAT_H__
@@ -0,0 +1,136 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_field_table.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Name-indexed storage for the fields of an ncurses_window.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a single table that owns every field of a window regardless of its
+ *  value type. Entries are kept in one contiguous array in insertion order and
+ *  are found by name through an open-addressing hash index, so a lookup is a
+ *  single probe sequence instead of a tree walk per value type.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_FIELD_TABLE_H__
+#define __NCURSES_FIELD_TABLE_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ncurses_field.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_field_table
+{
+public:
+
+    ncurses_field_table(void);
+    virtual ~ncurses_field_table(void);
+
+    /* takes ownership of the field; fails if the name is already in use. Fields are
+     *  heap allocated, so pointers to them remain valid as the table grows. the name
+     *  is moved into the table. */
+    bool insert(std::string field_name, std::unique_ptr<ncurses_field_base> field);
+
+    /* returns nullptr if no field has the given name */
+    ncurses_field_base * find(const std::string& field_name) const;
+    ncurses_field_base * find(const char * field_name, size_t field_name_len) const;
+
+    size_t size(void) const { return m_entries.size(); }
+    ncurses_field_base * get_field(size_t idx) const { return m_entries[idx].field.get(); }
+    const std::string& get_field_name(size_t idx) const { return m_entries[idx].name; }
+
+    void clear(void);
+
+private:
+
+    static const uint32_t EMPTY_SLOT = UINT32_MAX;
+
+    struct entry_t
+    {
+        uint64_t                                              hash;
+        std::string                                           name;
+        std::unique_ptr<ncurses_field_base>                   field;
+    };
+
+    /* the upper hash bits are kept next to the entry index so that most
+     *  mismatches are rejected without touching the entry array */
+    struct slot_t
+    {
+        uint32_t                                              hash_tag;
+        uint32_t                                              entry_idx;
+    };
+
+    static uint64_t hash_name(const char * field_name, size_t field_name_len);
+
+    /* returns the slot holding the name, or the empty slot where it would go */
+    size_t find_slot(const char * field_name, size_t field_name_len, uint64_t hash) const;
+    void rebuild_slots(size_t num_slots);
+
+    std::vector<entry_t>                                      m_entries;
+    std::vector<slot_t>                                       m_slots;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_FIELD_TABLE_H__
@@ -0,0 +1,243 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_field_value.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Type-tagged field value that can be passed between threads.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a fixed-size, type-tagged container for ncurses_field values along
+ *  with a traits template that converts between the container and the typed
+ *  field values. The container never allocates, so it can be copied through
+ *  lock-free queues and other fixed-size buffers.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_FIELD_VALUE_H__
+#define __NCURSES_FIELD_VALUE_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* longer string values are truncated when stored in an ncurses_field_value_t */
+const size_t NCURSES_CPP_FIELD_VALUE_STR_CAPACITY = 47;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+    NCURSES_CPP_FIELD_TYPE_STRING = 0,
+    NCURSES_CPP_FIELD_TYPE_INT32,
+    NCURSES_CPP_FIELD_TYPE_UINT32,
+    NCURSES_CPP_FIELD_TYPE_FLOAT,
+    NCURSES_CPP_FIELD_TYPE_DOUBLE,
+    NCURSES_CPP_FIELD_TYPE_INT64,
+    NCURSES_CPP_FIELD_TYPE_UINT64,
+    NCURSES_CPP_FIELD_TYPE_BOOL,
+    NCURSES_CPP_FIELD_TYPE_NANOSECONDS,
+    NCURSES_CPP_FIELD_TYPE_MICROSECONDS,
+    NCURSES_CPP_FIELD_TYPE_MILLISECONDS,
+    NCURSES_CPP_FIELD_TYPE_SECONDS,
+
+    /* sparkline fields; their updates carry FLOAT or DOUBLE samples */
+    NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES,
+    NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES
+} ncurses_field_type_e;
+
+struct ncurses_field_value_t
+{
+    ncurses_field_type_e                                      type;
+
+    union
+    {
+        int32_t                                               int32_val;
+        uint32_t                                              uint32_val;
+        float                                                 float_val;
+        double                                                double_val;
+        int64_t                                               int64_val;
+        uint64_t                                              uint64_val;
+        bool                                                  bool_val;
+    };
+
+    uint8_t                                                   str_len;
+    char                                                      str_val[NCURSES_CPP_FIELD_VALUE_STR_CAPACITY + 1];
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* maps a field value type onto its type tag and copies values in and out of an
+ *  ncurses_field_value_t; only the specializations below are supported */
+template <typename T>
+struct ncurses_field_value_traits;
+
+template <>
+struct ncurses_field_value_traits<std::string>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_STRING;
+
+    static void store(ncurses_field_value_t& dst, const std::string& src) { store(dst, src.data(), src.size()); }
+
+    static void store(ncurses_field_value_t& dst, const char * src, size_t src_len)
+    {
+        size_t len = src_len < NCURSES_CPP_FIELD_VALUE_STR_CAPACITY ? src_len : NCURSES_CPP_FIELD_VALUE_STR_CAPACITY;
+
+        dst.type = type;
+        memcpy(dst.str_val, src, len);
+        dst.str_val[len] = '\0';
+        dst.str_len = static_cast<uint8_t>(len);
+    }
+
+    static void load(const ncurses_field_value_t& src, std::string& dst) { dst.assign(src.str_val, src.str_len); }
+};
+
+template <>
+struct ncurses_field_value_traits<int32_t>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_INT32;
+
+    static void store(ncurses_field_value_t& dst, const int32_t& src) { dst.type = type; dst.int32_val = src; }
+    static void load(const ncurses_field_value_t& src, int32_t& dst) { dst = src.int32_val; }
+};
+
+template <>
+struct ncurses_field_value_traits<uint32_t>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_UINT32;
+
+    static void store(ncurses_field_value_t& dst, const uint32_t& src) { dst.type = type; dst.uint32_val = src; }
+    static void load(const ncurses_field_value_t& src, uint32_t& dst) { dst = src.uint32_val; }
+};
+
+template <>
+struct ncurses_field_value_traits<float>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_FLOAT;
+
+    static void store(ncurses_field_value_t& dst, const float& src) { dst.type = type; dst.float_val = src; }
+    static void load(const ncurses_field_value_t& src, float& dst) { dst = src.float_val; }
+};
+
+template <>
+struct ncurses_field_value_traits<double>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_DOUBLE;
+
+    static void store(ncurses_field_value_t& dst, const double& src) { dst.type = type; dst.double_val = src; }
+    static void load(const ncurses_field_value_t& src, double& dst) { dst = src.double_val; }
+};
+
+template <>
+struct ncurses_field_value_traits<int64_t>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_INT64;
+
+    static void store(ncurses_field_value_t& dst, const int64_t& src) { dst.type = type; dst.int64_val = src; }
+    static void load(const ncurses_field_value_t& src, int64_t& dst) { dst = src.int64_val; }
+};
+
+template <>
+struct ncurses_field_value_traits<uint64_t>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_UINT64;
+
+    static void store(ncurses_field_value_t& dst, const uint64_t& src) { dst.type = type; dst.uint64_val = src; }
+    static void load(const ncurses_field_value_t& src, uint64_t& dst) { dst = src.uint64_val; }
+};
+
+template <>
+struct ncurses_field_value_traits<bool>
+{
+    static const ncurses_field_type_e type = NCURSES_CPP_FIELD_TYPE_BOOL;
+
+    static void store(ncurses_field_value_t& dst, const bool& src) { dst.type = type; dst.bool_val = src; }
+    static void load(const ncurses_field_value_t& src, bool& dst) { dst = src.bool_val; }
+};
+
+/* durations travel as their tick count; each supported unit has its own type tag so
+ *  that a value in one unit is never applied to a field in another */
+template <typename D, ncurses_field_type_e TYPE>
+struct ncurses_duration_value_traits
+{
+    static const ncurses_field_type_e type = TYPE;
+
+    static void store(ncurses_field_value_t& dst, const D& src) { dst.type = type; dst.int64_val = src.count(); }
+    static void load(const ncurses_field_value_t& src, D& dst) { dst = D(src.int64_val); }
+};
+
+template <>
+struct ncurses_field_value_traits<std::chrono::nanoseconds>
+  : ncurses_duration_value_traits<std::chrono::nanoseconds, NCURSES_CPP_FIELD_TYPE_NANOSECONDS>
+{ };
+
+template <>
+struct ncurses_field_value_traits<std::chrono::microseconds>
+  : ncurses_duration_value_traits<std::chrono::microseconds, NCURSES_CPP_FIELD_TYPE_MICROSECONDS>
+{ };
+
+template <>
+struct ncurses_field_value_traits<std::chrono::milliseconds>
+  : ncurses_duration_value_traits<std::chrono::milliseconds, NCURSES_CPP_FIELD_TYPE_MILLISECONDS>
+{ };
+
+template <>
+struct ncurses_field_value_traits<std::chrono::seconds>
+  : ncurses_duration_value_traits<std::chrono::seconds, NCURSES_CPP_FIELD_TYPE_SECONDS>
+{ };
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_FIELD_VALUE_H__
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_layout.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Parses layout files that describe windows and their fields.
+ *
+ * @section  DESCRIPTION
+ *
+ * A layout file describes windows declaratively so that a dashboard can be
+ *  changed without a recompile. It is read in a single pass, one statement
+ *  per line; tokens are separated by whitespace, tokens with spaces are put in
+ *  double quotes (with \" and \\ escapes) and '#' starts a comment.
+ *
+ *   window NAME HEIGHT WIDTH ROW COLUMN [no_outline]
+ *       title TEXT
+ *       field TYPE NAME X Y FORMAT DEFAULT
+ *       band LOW HIGH COLOR              threshold band of the preceding field
+ *       sparkline float|double NAME X Y WIDTH HISTORY
+ *   end
+ *
+ * HEIGHT, WIDTH, ROW and COLUMN are a number of cells or a share of the
+ *  screen with an optional offset, e.g. 50% or 100%-6, so that windows follow
+ *  the terminal size.
+ *
+ * TYPE is one of string, int32, uint32, float, double, int64, uint64, bool,
+ *  nanoseconds, microseconds, milliseconds or seconds. COLOR is one of
+ *  default, black, red, green, yellow, blue, magenta, cyan or white.
+ *
+ * Each window keeps a digest of its statements so that a reloaded layout can
+ *  tell which windows changed; whitespace and comments do not count.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_LAYOUT_H__
+#define __NCURSES_LAYOUT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+#include "ncurses_window.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct ncurses_layout_band_t
+{
+    ncurses_field_value_t                                     low;
+    ncurses_field_value_t                                     high;
+    ncurses_cpp_text_colors_e                                 color;
+};
+
+struct ncurses_layout_field_t
+{
+    ncurses_field_type_e                                      type;
+    std::string                                               name;
+    uint32_t                                                  x;
+    uint32_t                                                  y;
+
+    /* plain fields */
+    std::string                                               format;
+    ncurses_field_value_t                                     default_val;
+    std::vector<ncurses_layout_band_t>                        bands;
+
+    /* sparkline fields */
+    uint32_t                                                  width;
+    size_t                                                    history_len;
+};
+
+struct ncurses_layout_window_t
+{
+    std::string                                               name;
+    ncurses_window_geometry_t                                 geometry;
+    bool                                                      outline;
+    std::string                                               title;
+    std::vector<ncurses_layout_field_t>                       fields;
+
+    /* the window's statements, used to detect changes between loads */
+    std::string                                               digest;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_layout
+{
+public:
+
+    ncurses_layout(void);
+    virtual ~ncurses_layout(void);
+
+    /* replaces the current description; on failure the error names the line */
+    bool parse_file(const std::string& layout_path);
+    bool parse(const std::string& layout_text);
+
+    const std::string& get_error(void) const { return m_error; }
+    const std::vector<ncurses_layout_window_t>& get_windows(void) const { return m_windows; }
+
+    /* returns nullptr if there is no window with the name */
+    const ncurses_layout_window_t * find_window(const std::string& window_name) const;
+
+    /* creates the described window on the active backend. fields that also exist in
+     *  the previous version of the window with the same type keep its values. */
+    static std::shared_ptr<ncurses_window> build_window(const ncurses_layout_window_t& window_desc, const ncurses_window * previous_window, bool frame_commit_mode, std::string& error);
+
+private:
+
+    bool parse_line(std::vector<std::string>& tokens, size_t line_num);
+    bool set_error(size_t line_num, const std::string& message);
+
+    std::vector<ncurses_layout_window_t>                      m_windows;
+    bool                                                      m_in_window;
+    std::string                                               m_error;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_LAYOUT_H__
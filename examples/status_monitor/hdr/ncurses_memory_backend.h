@@ -0,0 +1,163 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_memory_backend.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend that keeps the screen as a grid of cells.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines an in-memory implementation of the ncurses_backend interface. The
+ *  screen is a fixed size grid of character/color cells; windows draw into
+ *  their own cell buffers, staging copies the changed rows into the pending
+ *  frame and committing a frame makes it the visible screen. Input is a queue
+ *  of characters fed through push_char().
+ *  Nothing touches a terminal, so the library can run headless in tests,
+ *  benchmarks and on machines without a TTY; the visible screen can be read
+ *  back cell by cell to check what was rendered.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_MEMORY_BACKEND_H__
+#define __NCURSES_MEMORY_BACKEND_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ncurses_backend.h"
+#include "ncurses_colors.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct ncurses_memory_cell_t
+{
+    char                                                      ch;
+    ncurses_cpp_text_colors_e                                 color;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_memory_backend : public ncurses_backend
+{
+public:
+
+    ncurses_memory_backend(uint32_t rows, uint32_t cols);
+    virtual ~ncurses_memory_backend(void);
+
+    bool open_screen(void) override;
+    void close_screen(void) override;
+
+    uint32_t get_rows(void) const override { return m_rows; }
+    uint32_t get_cols(void) const override { return m_cols; }
+    void handle_resize(void) override;
+
+    /* simulates a terminal resize: queues KEY_RESIZE, and the screen takes on the
+     *  new size once the user interface handles it */
+    void set_screen_size(uint32_t rows, uint32_t cols);
+
+    ncurses_backend_window * get_screen_window(void) override { return m_screen_window.get(); }
+    std::unique_ptr<ncurses_backend_window> create_window(uint32_t height, uint32_t width, uint32_t begin_y, uint32_t begin_x) override;
+
+    void commit_frame(void) override;
+
+    int read_char(void) override;
+    void push_char(int ch) override;
+    int get_input_fd(void) const override { return -1; }
+
+    /* contents of the visible screen, i.e. as of the last committed frame; cells
+     *  outside of the screen read as a blank */
+    char get_char(uint32_t x, uint32_t y) const;
+    ncurses_cpp_text_colors_e get_color(uint32_t x, uint32_t y) const;
+    std::string get_row_text(uint32_t y) const;
+
+    uint64_t get_frame_count(void) const { return m_frame_count; }
+
+    /* number of visible cells that changed, summed over all committed frames */
+    uint64_t get_cells_written(void) const { return m_cells_written; }
+
+    /* called by the memory windows when they stage their changed rows */
+    virtual void stage_cells(const ncurses_backend_window * window, uint32_t begin_y, uint32_t begin_x, uint32_t row, const ncurses_memory_cell_t * cells, uint32_t num_cells);
+
+    /* called by the memory windows when they are deleted */
+    virtual void release_window(const ncurses_backend_window * window) { (void)window; }
+
+protected:
+
+    /* discards the screen contents, including those of the screen window */
+    void resize_screen(uint32_t rows, uint32_t cols);
+
+    uint32_t                                                  m_rows;
+    uint32_t                                                  m_cols;
+    uint32_t                                                  m_requested_rows;
+    uint32_t                                                  m_requested_cols;
+
+    /* the frame being built up by staged windows and the one last committed */
+    std::vector<ncurses_memory_cell_t>                        m_pending_cells;
+    std::vector<ncurses_memory_cell_t>                        m_visible_cells;
+    std::vector<bool>                                         m_pending_dirty_rows;
+
+    std::unique_ptr<ncurses_backend_window>                   m_screen_window;
+    std::deque<int>                                           m_input_queue;
+
+    uint64_t                                                  m_frame_count;
+    uint64_t                                                  m_cells_written;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_MEMORY_BACKEND_H__
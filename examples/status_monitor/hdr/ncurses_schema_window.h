@@ -0,0 +1,308 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_schema_window.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Window whose fields are declared at compile time.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a window whose fields, with their names, types, positions, formats
+ *  and threshold bands, are part of its type. Each field is described by a
+ *  small descriptor type, usually declared with NCURSES_CPP_SCHEMA_FIELD, and
+ *  the window is instantiated with the list of descriptors:
+ *
+ *      NCURSES_CPP_SCHEMA_FIELD(cpu, float, 8, 1, "%5.1f %%", 0.0);
+ *      NCURSES_CPP_SCHEMA_FIELD(uptime, std::chrono::seconds, 8, 2, "%lds", std::chrono::seconds(0));
+ *      typedef ncurses_cpp::ncurses_schema_window<cpu, uptime> system_window_t;
+ *
+ *      window.update<cpu>(42.0);
+ *
+ *  Formats that do not match the field type, repeated names and two fields
+ *  starting at the same position fail to compile. The fields are ordinary
+ *  ncurses_field objects owned by the window, so they are drawn, relaid out
+ *  and reachable by name exactly like fields added at run time; the window
+ *  keeps a handle to each one in a base class selected by the descriptor type,
+ *  so update<F>() is resolved by the compiler and never searches for the field.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SCHEMA_WINDOW_H__
+#define __NCURSES_SCHEMA_WINDOW_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_field.h"
+#include "ncurses_field_format.h"
+#include "ncurses_field_value.h"
+#include "ncurses_window.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/* declares a schema field descriptor; the identifier doubles as the field name.
+ *  types containing a comma need a typedef first. */
+#define NCURSES_CPP_SCHEMA_FIELD(field_id, field_type, field_x, field_y, format_str, default_val)        \
+    struct field_id : public ncurses_cpp::ncurses_schema_field<field_type, field_x, field_y>          \
+    {                                                                                                 \
+        static constexpr const char * name(void) { return #field_id; }                                \
+        static constexpr const char * format(void) { return format_str; }                             \
+        static field_type default_value(void) { return default_val; }                                 \
+    }
+
+/* as above, followed by the field's threshold bands, e.g.
+ *  { { 0.0, 75.0 }, NCURSES_CPP_TXT_COLOR_GREEN }, { { 75.0, 100.0 }, NCURSES_CPP_TXT_COLOR_RED } */
+#define NCURSES_CPP_SCHEMA_BANDED_FIELD(field_id, field_type, field_x, field_y, format_str, default_val, ...) \
+    struct field_id : public ncurses_cpp::ncurses_schema_field<field_type, field_x, field_y>          \
+    {                                                                                                 \
+        static constexpr const char * name(void) { return #field_id; }                                \
+        static constexpr const char * format(void) { return format_str; }                             \
+        static field_type default_value(void) { return default_val; }                                 \
+        static std::vector<threshold_band_t> thresholds(void) { return { __VA_ARGS__ }; }             \
+    }
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+constexpr bool ncurses_schema_names_equal(const char * lhs, const char * rhs)
+{
+    return *lhs == *rhs && ('\0' == *lhs || ncurses_schema_names_equal(lhs + 1, rhs + 1));
+}
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* base of every field descriptor. a descriptor adds constexpr name() and format()
+ *  functions returning string literals and a default_value() function; it may hide
+ *  default_color() and thresholds() to change the field's colors. */
+template <typename T, uint32_t X, uint32_t Y>
+struct ncurses_schema_field
+{
+    typedef T                                                 value_type;
+    typedef typename ncurses_field<T>::threshold_band_t       threshold_band_t;
+
+    static constexpr uint32_t get_x(void) { return X; }
+    static constexpr uint32_t get_y(void) { return Y; }
+
+    static ncurses_cpp_text_colors_e default_color(void) { return NCURSES_CPP_TXT_COLOR_DEFAULT; }
+    static std::vector<threshold_band_t> thresholds(void) { return std::vector<threshold_band_t>(); }
+};
+
+/* true if F differs in name and position from every one of the other fields */
+template <typename F, typename... Others>
+struct ncurses_schema_field_is_distinct : std::true_type { };
+
+template <typename F, typename G, typename... Others>
+struct ncurses_schema_field_is_distinct<F, G, Others...>
+  : std::integral_constant<bool, !ncurses_schema_names_equal(F::name(), G::name()) &&
+                                 !(F::get_x() == G::get_x() && F::get_y() == G::get_y()) &&
+                                 ncurses_schema_field_is_distinct<F, Others...>::value> { };
+
+template <typename... Fields>
+struct ncurses_schema_fields_are_distinct : std::true_type { };
+
+template <typename F, typename... Others>
+struct ncurses_schema_fields_are_distinct<F, Others...>
+  : std::integral_constant<bool, ncurses_schema_field_is_distinct<F, Others...>::value &&
+                                 ncurses_schema_fields_are_distinct<Others...>::value> { };
+
+/* the smallest window, in columns and rows, in which every field has its start */
+template <typename... Fields>
+struct ncurses_schema_extent
+{
+    static constexpr uint32_t get_width(void) { return 0; }
+    static constexpr uint32_t get_height(void) { return 0; }
+};
+
+template <typename F, typename... Others>
+struct ncurses_schema_extent<F, Others...>
+{
+    static constexpr uint32_t get_width(void)
+    {
+        return F::get_x() + 1 > ncurses_schema_extent<Others...>::get_width() ? F::get_x() + 1 : ncurses_schema_extent<Others...>::get_width();
+    }
+
+    static constexpr uint32_t get_height(void)
+    {
+        return F::get_y() + 1 > ncurses_schema_extent<Others...>::get_height() ? F::get_y() + 1 : ncurses_schema_extent<Others...>::get_height();
+    }
+};
+
+/* holds the handle of one schema field; the window derives from one slot per field */
+template <typename F>
+struct ncurses_schema_slot
+{
+    static_assert(ncurses_field_format::is_valid_format(F::format(), ncurses_field_value_traits<typename F::value_type>::type),
+                  "the format of a schema field does not match the field type");
+
+    ncurses_field_handle<typename F::value_type>              handle;
+};
+
+template <typename... Fields>
+class ncurses_schema_window : public ncurses_window, private ncurses_schema_slot<Fields>...
+{
+    static_assert(sizeof...(Fields) > 0, "a schema window needs at least one field");
+    static_assert(ncurses_schema_fields_are_distinct<Fields...>::value, "schema fields need distinct names and start positions");
+
+public:
+
+    ncurses_schema_window(std::string window_name) : ncurses_window(std::move(window_name)) { }
+    ncurses_schema_window(std::string window_name, bool outline_window) : ncurses_window(std::move(window_name), outline_window) { }
+    virtual ~ncurses_schema_window(void) { }
+
+    /* creates the window and then every schema field in declaration order; returns
+     *  false if the window could not be created or any field did not fit */
+    using ncurses_window::create_window;
+    bool create_window(uint32_t height, uint32_t width, uint32_t start_x, uint32_t start_y) override;
+
+    static constexpr size_t get_schema_field_count(void) { return sizeof...(Fields); }
+
+    /* an outlined window needs one more row and column on each side */
+    static constexpr uint32_t get_min_width(void) { return ncurses_schema_extent<Fields...>::get_width(); }
+    static constexpr uint32_t get_min_height(void) { return ncurses_schema_extent<Fields...>::get_height(); }
+
+    /* the handles are invalid until create_window() succeeds and after the window
+     *  is cleaned up, when updates through them return false */
+    template <typename F>
+    ncurses_field_handle<typename F::value_type> get_handle(void) const
+    {
+        return static_cast<const ncurses_schema_slot<F>&>(*this).handle;
+    }
+
+    template <typename F>
+    bool update(const typename F::value_type& field_val)
+    {
+        return get_handle<F>().update_field(field_val);
+    }
+
+    template <typename F>
+    bool update(const typename F::value_type& field_val, ncurses_cpp_text_colors_e field_color)
+    {
+        return get_handle<F>().update_field(field_val, field_color);
+    }
+
+    template <typename F>
+    bool update(typename F::value_type&& field_val)
+    {
+        return get_handle<F>().update_field(std::move(field_val));
+    }
+
+    template <typename F>
+    bool update(typename F::value_type&& field_val, ncurses_cpp_text_colors_e field_color)
+    {
+        return get_handle<F>().update_field(std::move(field_val), field_color);
+    }
+
+protected:
+
+    void handle_fields_cleared(void) override;
+
+private:
+
+    template <typename F>
+    bool add_schema_field(void);
+};
+
+
+/******************************************************************************
+ *                            TEMPLATE FUNCTIONS
+ *****************************************************************************/
+
+template <typename... Fields>
+bool ncurses_schema_window<Fields...>::create_window(uint32_t height, uint32_t width, uint32_t start_x, uint32_t start_y)
+{
+    bool ret = ncurses_window::create_window(height, width, start_x, start_y);
+
+    if (ret)
+    {
+        /* a braced list evaluates its elements in order, so every field is added even
+         *  after one fails */
+        std::initializer_list<bool> fields_added = { add_schema_field<Fields>()... };
+        for (bool field_added : fields_added)
+        {
+            ret = ret && field_added;
+        }
+    }
+
+    return ret;
+}
+
+template <typename... Fields>
+void ncurses_schema_window<Fields...>::handle_fields_cleared(void)
+{
+    /* the fields the handles pointed at are gone */
+    std::initializer_list<bool> handles_reset = { (static_cast<ncurses_schema_slot<Fields>&>(*this).handle = ncurses_field_handle<typename Fields::value_type>(), true)... };
+    (void)handles_reset;
+}
+
+template <typename... Fields>
+template <typename F>
+bool ncurses_schema_window<Fields...>::add_schema_field(void)
+{
+    typedef typename F::value_type value_type;
+
+    ncurses_field_handle<value_type>& handle = static_cast<ncurses_schema_slot<F>&>(*this).handle;
+    handle = add_field<value_type>(F::get_x(), F::get_y(), F::name(), F::format(), F::default_value(), F::default_color());
+
+    std::vector<typename F::threshold_band_t> thresholds = F::thresholds();
+    return handle.is_valid() &&
+           (thresholds.empty() || handle.get_field()->set_field_thresholds(thresholds));
+}
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SCHEMA_WINDOW_H__
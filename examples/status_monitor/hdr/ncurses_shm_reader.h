@@ -0,0 +1,184 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_shm_reader.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    User interface side of the shared-memory telemetry segment.
+ *
+ * @section  DESCRIPTION
+ *
+ * Maps named slots of a telemetry segment onto window fields. The ncurses_ui
+ *  polls the reader once per frame; a poll only looks at the sequence number
+ *  of each bound slot and copies the slots that changed since the last poll.
+ *  Bindings may name slots that no producer has claimed yet; they are
+ *  resolved as soon as a producer claims them. A sparkline bound to a slot
+ *  receives the latest value at each poll, not every value the producer wrote.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SHM_READER_H__
+#define __NCURSES_SHM_READER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "ncurses_field.h"
+#include "ncurses_field_value.h"
+#include "ncurses_shm_segment.h"
+#include "ncurses_sparkline_field.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_shm_reader
+{
+public:
+
+    ncurses_shm_reader(void);
+    virtual ~ncurses_shm_reader(void);
+
+    /* opens the segment, creating it with slot_capacity slots if no producer has
+     *  created it yet */
+    bool open_segment(const std::string& segment_name);
+    bool open_segment(const std::string& segment_name, uint32_t slot_capacity);
+    void close_segment(void);
+
+    bool is_open(void) const { return m_segment.is_open(); }
+
+    /* fails if the name is too long or the handle is invalid; several fields may be
+     *  bound to the same slot */
+    template <typename T>
+    bool bind_field(const std::string& slot_name, const ncurses_field_handle<T>& handle);
+
+    template <typename T>
+    bool bind_field(const std::string& slot_name, const ncurses_sparkline_handle<T>& handle);
+
+    /* moves the bindings of a field that is about to be destroyed onto its
+     *  replacement, which gets the current slot values at the next poll; a nullptr
+     *  replacement drops the bindings */
+    void rebind_field(const ncurses_field_base * old_field, ncurses_field_base * new_field);
+
+    /* drops all bindings; call this before the bound fields are destroyed */
+    void clear_bindings(void);
+
+    /* applies the slots that changed since the last poll to their fields and returns
+     *  the number of fields updated */
+    size_t poll(void);
+
+    void set_poll_interval(std::chrono::milliseconds poll_interval) { m_poll_interval = poll_interval; }
+    std::chrono::milliseconds get_poll_interval(void) const { return m_poll_interval; }
+
+    uint64_t get_applied_count(void) const { return m_applied_count; }
+
+    /* reads that overlapped a write and had to be repeated */
+    uint64_t get_retry_count(void) const { return m_retry_count; }
+
+    /* values that their field did not accept, e.g. because the types differ, and
+     *  values in anything but a named color */
+    uint64_t get_rejected_count(void) const { return m_rejected_count; }
+
+private:
+
+    struct binding_t
+    {
+        char                                                  slot_name[NCURSES_SHM_NAME_CAPACITY];
+        ncurses_field_base *                                  field;
+        const ncurses_shm_slot_t *                            slot;
+        uint32_t                                              last_sequence;
+    };
+
+    bool bind(const std::string& slot_name, ncurses_field_base * field);
+    void resolve_bindings(void);
+    bool read_slot(const ncurses_shm_slot_t& slot, uint32_t& sequence);
+
+    ncurses_shm_segment                                       m_segment;
+    std::vector<binding_t>                                    m_bindings;
+    size_t                                                    m_unresolved_count;
+
+    /* slots [0, m_scanned_slot_count) have been matched against the bindings */
+    uint32_t                                                  m_scanned_slot_count;
+
+    std::chrono::milliseconds                                 m_poll_interval;
+    ncurses_field_value_t                                     m_read_value;
+    uint32_t                                                  m_read_color;
+    uint64_t                                                  m_applied_count;
+    uint64_t                                                  m_retry_count;
+    uint64_t                                                  m_rejected_count;
+};
+
+/******************************************************************************
+ *                            TEMPLATE FUNCTIONS
+ *****************************************************************************/
+
+/* these functions do not have specializations for the class; putting them here
+ *  helps the linker resolve the template versions */
+
+template <typename T>
+bool ncurses_shm_reader::bind_field(const std::string& slot_name, const ncurses_field_handle<T>& handle)
+{
+    return handle.is_valid() && bind(slot_name, handle.get_field());
+}
+
+template <typename T>
+bool ncurses_shm_reader::bind_field(const std::string& slot_name, const ncurses_sparkline_handle<T>& handle)
+{
+    return handle.is_valid() && bind(slot_name, handle.get_field());
+}
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SHM_READER_H__
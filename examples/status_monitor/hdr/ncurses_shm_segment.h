@@ -0,0 +1,188 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_shm_segment.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Layout and mapping of the shared-memory telemetry segment.
+ *
+ * @section  DESCRIPTION
+ *
+ * Other processes publish values for an ncurses_ui to display through a POSIX
+ *  shared-memory segment (shm_open), without a syscall per update. The segment
+ *  is laid out as follows; all integers are in host byte order and the layout
+ *  only changes together with NCURSES_SHM_VERSION.
+ *
+ *   offset 0    ncurses_shm_header_t (64 bytes)
+ *                 magic            "NCSM"; written last by the creator
+ *                 version          NCURSES_SHM_VERSION
+ *                 slot_size        sizeof(ncurses_shm_slot_t), 128
+ *                 slot_capacity    number of slots in the segment
+ *                 slots_claimed    slots [0, slots_claimed) have been handed out;
+ *                                   only ever grows
+ *   offset 64   ncurses_shm_slot_t[slot_capacity] (128 bytes each)
+ *                 sequence         seqlock counter; odd while the value is being
+ *                                   written, 0 if it never was
+ *                 state            NCURSES_SHM_SLOT_NAMED once name and value_type
+ *                                   are valid
+ *                 name             NUL-terminated slot name, the directory key
+ *                 value_type       ncurses_field_type_e of the values
+ *                 color            named ncurses_cpp_text_colors_e to draw the value in
+ *                 value            the ncurses_field_value_t union bits
+ *                 str_len/str_val  string values
+ *
+ * A writer claims a slot once by name and then publishes into it with the
+ *  seqlock protocol: increment sequence to an odd number, write the value, then
+ *  increment it to the next even number. A reader copies the value between two
+ *  reads of sequence and keeps the copy only if both reads returned the same
+ *  even number. Each slot must have a single writer.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SHM_SEGMENT_H__
+#define __NCURSES_SHM_SEGMENT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ncurses_field_value.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t NCURSES_SHM_MAGIC = 0x4D53434E;
+const uint32_t NCURSES_SHM_VERSION = 1;
+
+/* slots in a segment created by a reader that starts before any writer */
+const uint32_t NCURSES_SHM_DEFAULT_SLOT_CAPACITY = 256;
+
+/* slot names, including the terminating NUL */
+const size_t NCURSES_SHM_NAME_CAPACITY = 32;
+
+const uint32_t NCURSES_SHM_SLOT_FREE = 0;
+const uint32_t NCURSES_SHM_SLOT_NAMED = 1;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "the segment needs address-free atomics");
+
+struct ncurses_shm_header_t
+{
+    std::atomic<uint32_t>                                     magic;
+    uint32_t                                                  version;
+    uint32_t                                                  slot_size;
+    uint32_t                                                  slot_capacity;
+    std::atomic<uint32_t>                                     slots_claimed;
+    uint8_t                                                   reserved[44];
+};
+
+struct ncurses_shm_slot_t
+{
+    std::atomic<uint32_t>                                     sequence;
+    std::atomic<uint32_t>                                     state;
+    char                                                      name[NCURSES_SHM_NAME_CAPACITY];
+    uint32_t                                                  value_type;
+    uint32_t                                                  color;
+    uint64_t                                                  value;
+    uint32_t                                                  str_len;
+    char                                                      str_val[NCURSES_CPP_FIELD_VALUE_STR_CAPACITY + 1];
+    uint8_t                                                   reserved[20];
+};
+
+static_assert(sizeof(ncurses_shm_header_t) == 64, "the segment header layout changed");
+static_assert(sizeof(ncurses_shm_slot_t) == 128, "the segment slot layout changed");
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* maps a telemetry segment into the process; used by both writers and readers */
+class ncurses_shm_segment
+{
+public:
+
+    ncurses_shm_segment(void);
+    virtual ~ncurses_shm_segment(void);
+
+    /* removes the segment name; processes that have it mapped keep their mapping */
+    static bool remove_segment(const std::string& segment_name);
+
+    /* opens the segment, creating it with slot_capacity slots if it does not exist;
+     *  an existing segment keeps its own capacity */
+    bool open_segment(const std::string& segment_name, uint32_t slot_capacity);
+    void close_segment(void);
+
+    bool is_open(void) const { return nullptr != m_header; }
+
+    ncurses_shm_header_t * get_header(void) const { return m_header; }
+    ncurses_shm_slot_t * get_slot(uint32_t slot_idx) const { return m_slots + slot_idx; }
+    uint32_t get_slot_capacity(void) const { return nullptr != m_header ? m_header->slot_capacity : 0; }
+
+    /* the number of slots that have been handed out, up to the capacity */
+    uint32_t get_claimed_slot_count(void) const;
+
+    /* returns the index of the named slot or -1 if there is none */
+    int32_t find_slot(const char * slot_name) const;
+
+private:
+
+    static std::string get_object_name(const std::string& segment_name);
+
+    bool map_existing(int fd);
+
+    ncurses_shm_header_t *                                    m_header;
+    ncurses_shm_slot_t *                                      m_slots;
+    size_t                                                    m_mapped_size;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SHM_SEGMENT_H__
@@ -0,0 +1,178 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_shm_writer.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Producer side of the shared-memory telemetry segment.
+ *
+ * @section  DESCRIPTION
+ *
+ * A producer process claims one slot per value that it publishes and then
+ *  writes new values into the slot with the seqlock protocol described in
+ *  ncurses_shm_segment.h. Publishing is a handful of stores into the mapped
+ *  segment; it never makes a syscall and never waits for the reader. The writer
+ *  only uses the type definitions of this library, so producers do not need to
+ *  link against ncurses.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SHM_WRITER_H__
+#define __NCURSES_SHM_WRITER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <string>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+#include "ncurses_shm_segment.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* a claimed slot; remains valid until the writer closes its segment */
+template <typename T>
+class ncurses_shm_slot_handle
+{
+public:
+
+    ncurses_shm_slot_handle(void) : m_slot(nullptr) { }
+    explicit ncurses_shm_slot_handle(ncurses_shm_slot_t * slot) : m_slot(slot) { }
+
+    bool is_valid(void) const { return nullptr != m_slot; }
+    ncurses_shm_slot_t * get_slot(void) const { return m_slot; }
+    explicit operator bool(void) const { return is_valid(); }
+
+private:
+
+    ncurses_shm_slot_t *                                      m_slot;
+};
+
+class ncurses_shm_writer
+{
+public:
+
+    ncurses_shm_writer(void);
+    virtual ~ncurses_shm_writer(void);
+
+    /* opens the segment, creating it with slot_capacity slots if the reader has not
+     *  created it yet */
+    bool open_segment(const std::string& segment_name, uint32_t slot_capacity);
+    void close_segment(void);
+
+    bool is_open(void) const { return m_segment.is_open(); }
+
+    /* claims the named slot for values of type T. a slot that already carries the
+     *  name, e.g. from before the producer restarted, is taken over if its type
+     *  matches. fails if the name is too long or the segment is full. */
+    template <typename T>
+    ncurses_shm_slot_handle<T> claim_slot(const std::string& slot_name);
+
+    /* the value is shown with the color of the field's thresholds unless a color is
+     *  given; the reader drops values in anything but a named color */
+    template <typename T>
+    bool publish(const ncurses_shm_slot_handle<T>& handle, const T& slot_val);
+
+    template <typename T>
+    bool publish(const ncurses_shm_slot_handle<T>& handle, const T& slot_val, ncurses_cpp_text_colors_e slot_color);
+
+private:
+
+    ncurses_shm_slot_t * claim(const std::string& slot_name, ncurses_field_type_e value_type);
+    static void write_slot(ncurses_shm_slot_t * slot, const ncurses_field_value_t& slot_val, ncurses_cpp_text_colors_e slot_color);
+
+    ncurses_shm_segment                                       m_segment;
+};
+
+/******************************************************************************
+ *                            TEMPLATE FUNCTIONS
+ *****************************************************************************/
+
+/* these functions do not have specializations for the class; putting them here
+ *  helps the linker resolve the template versions */
+
+template <typename T>
+ncurses_shm_slot_handle<T> ncurses_shm_writer::claim_slot(const std::string& slot_name)
+{
+    return ncurses_shm_slot_handle<T>(claim(slot_name, ncurses_field_value_traits<T>::type));
+}
+
+template <typename T>
+bool ncurses_shm_writer::publish(const ncurses_shm_slot_handle<T>& handle, const T& slot_val)
+{
+    return publish<T>(handle, slot_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+template <typename T>
+bool ncurses_shm_writer::publish(const ncurses_shm_slot_handle<T>& handle, const T& slot_val, ncurses_cpp_text_colors_e slot_color)
+{
+    bool ret = false;
+
+    if (handle.is_valid())
+    {
+        ncurses_field_value_t value;
+        value.uint64_val = 0;
+        value.str_len = 0;
+        ncurses_field_value_traits<T>::store(value, slot_val);
+
+        write_slot(handle.get_slot(), value, slot_color);
+        ret = true;
+    }
+
+    return ret;
+}
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SHM_WRITER_H__
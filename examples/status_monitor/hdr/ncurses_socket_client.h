@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_socket_client.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Producer side of the field update socket.
+ *
+ * @section  DESCRIPTION
+ *
+ * Encodes field updates into batches (see ncurses_socket_protocol.h) and sends
+ *  them to an ncurses_ui listening on a Unix-domain socket. Updates are
+ *  collected in a fixed buffer and only written to the socket by flush(), or
+ *  when the buffer is full, so that many updates share one write. Like the
+ *  shared-memory writer, the client does not need to link against ncurses.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SOCKET_CLIENT_H__
+#define __NCURSES_SOCKET_CLIENT_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+#include "ncurses_socket_protocol.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_socket_client
+{
+public:
+
+    ncurses_socket_client(void);
+    virtual ~ncurses_socket_client(void);
+
+    bool connect_socket(const std::string& socket_path);
+    void close_socket(void);
+
+    bool is_connected(void) const { return m_fd >= 0; }
+
+    /* adds an update to the current batch, sending the batch first if the update
+     *  does not fit; fails if a name is too long or the send failed */
+    template <typename T>
+    bool add_update(const std::string& window_name, const std::string& field_name, const T& field_val);
+
+    template <typename T>
+    bool add_update(const std::string& window_name, const std::string& field_name, const T& field_val, ncurses_cpp_text_colors_e field_color);
+
+    /* for values that already carry their type, e.g. ones read back from an update log */
+    bool add_update(const std::string& window_name, const std::string& field_name, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color)
+    {
+        return add_record(window_name, field_name, field_val, field_color);
+    }
+
+    /* sends the current batch; blocks until the server has room for it */
+    bool flush(void);
+
+    size_t get_pending_update_count(void) const { return m_pending_update_count; }
+
+private:
+
+    bool add_record(const std::string& window_name, const std::string& field_name, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color);
+
+    int                                                       m_fd;
+    std::vector<uint8_t>                                      m_batch;
+    size_t                                                    m_batch_len;
+    size_t                                                    m_pending_update_count;
+};
+
+/******************************************************************************
+ *                            TEMPLATE FUNCTIONS
+ *****************************************************************************/
+
+/* these functions do not have specializations for the class; putting them here
+ *  helps the linker resolve the template versions */
+
+template <typename T>
+bool ncurses_socket_client::add_update(const std::string& window_name, const std::string& field_name, const T& field_val)
+{
+    return add_update<T>(window_name, field_name, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+template <typename T>
+bool ncurses_socket_client::add_update(const std::string& window_name, const std::string& field_name, const T& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    ncurses_field_value_t value;
+    value.uint64_val = 0;
+    value.str_len = 0;
+    ncurses_field_value_traits<T>::store(value, field_val);
+
+    return add_record(window_name, field_name, value, field_color);
+}
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SOCKET_CLIENT_H__
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_socket_protocol.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Wire format of the field update socket.
+ *
+ * @section  DESCRIPTION
+ *
+ * Processes that cannot use the shared-memory segment send field updates to
+ *  an ncurses_ui over a Unix-domain stream socket. A client writes batches of
+ *  records; every integer is in host byte order because both ends are on the
+ *  same machine, and nothing is padded.
+ *
+ *   batch   uint32 payload_len    bytes of records that follow, at most
+ *                                  NCURSES_SOCKET_MAX_BATCH_LEN
+ *           record[]
+ *
+ *   record  uint8 value_type      ncurses_field_type_e of the value; sparkline
+ *                                  samples are sent as FLOAT or DOUBLE
+ *           uint8 color           ncurses_cpp_text_colors_e; DEFAULT applies the
+ *                                  field's thresholds
+ *           uint8 window_name_len
+ *           uint8 field_name_len
+ *           char  window_name[window_name_len]
+ *           char  field_name[field_name_len]
+ *           value                 STRING: uint8 length followed by that many bytes,
+ *                                  at most NCURSES_CPP_FIELD_VALUE_STR_CAPACITY;
+ *                                  all other types: the 8 bytes of the
+ *                                  ncurses_field_value_t union
+ *
+ * A record for an unknown field is skipped. A batch that cannot be decoded,
+ *  e.g. because a record runs past its end, closes the connection.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SOCKET_PROTOCOL_H__
+#define __NCURSES_SOCKET_PROTOCOL_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const size_t NCURSES_SOCKET_BATCH_HEADER_LEN = sizeof(uint32_t);
+const size_t NCURSES_SOCKET_RECORD_HEADER_LEN = 4;
+const size_t NCURSES_SOCKET_VALUE_LEN = sizeof(uint64_t);
+
+/* the server reads each client into a buffer of this size, which always has room
+ *  for one complete batch */
+const size_t NCURSES_SOCKET_BUFFER_LEN = 64 * 1024;
+const size_t NCURSES_SOCKET_MAX_BATCH_LEN = NCURSES_SOCKET_BUFFER_LEN - NCURSES_SOCKET_BATCH_HEADER_LEN;
+
+/* window and field names longer than this cannot be sent */
+const size_t NCURSES_SOCKET_MAX_NAME_LEN = UINT8_MAX;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SOCKET_PROTOCOL_H__
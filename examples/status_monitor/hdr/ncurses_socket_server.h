@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_socket_server.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Receives field update batches on a Unix-domain socket.
+ *
+ * @section  DESCRIPTION
+ *
+ * Accepts connections from local producers and decodes the batches that they
+ *  send (see ncurses_socket_protocol.h). The server is driven by the thread
+ *  running the ncurses_ui event loop: all client sockets are registered with
+ *  one epoll descriptor, which the event loop polls together with its other
+ *  descriptors, and each service() call handles a bounded number of ready
+ *  clients with one large non-blocking read each so that input handling is
+ *  never held up. Each client gets a fixed receive buffer when it connects;
+ *  decoding works in place in that buffer and does not allocate.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SOCKET_SERVER_H__
+#define __NCURSES_SOCKET_SERVER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/epoll.h>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+#include "ncurses_socket_protocol.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const uint32_t NCURSES_SOCKET_DEFAULT_MAX_CLIENTS = 512;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/* a decoded record; the names point into the server's receive buffer and are only
+ *  valid while the record is being handled */
+struct ncurses_socket_record_t
+{
+    const char *                                              window_name;
+    size_t                                                    window_name_len;
+    const char *                                              field_name;
+    size_t                                                    field_name_len;
+    ncurses_field_value_t                                     value;
+    ncurses_cpp_text_colors_e                                 color;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_socket_record_handler
+{
+public:
+
+    virtual ~ncurses_socket_record_handler(void) { }
+
+    /* returns false if the record was not accepted, e.g. the field does not exist */
+    virtual bool handle_socket_record(const ncurses_socket_record_t& record) = 0;
+};
+
+class ncurses_socket_server
+{
+public:
+
+    ncurses_socket_server(void);
+    virtual ~ncurses_socket_server(void);
+
+    /* a stale socket file left behind by a process that exited is replaced; one
+     *  that another process is still listening on is not */
+    bool open_socket(const std::string& socket_path);
+    bool open_socket(const std::string& socket_path, uint32_t max_clients);
+    void close_socket(void);
+
+    bool is_open(void) const { return m_listen_fd >= 0; }
+
+    /* readable whenever a client connects or sends data; -1 while closed */
+    int get_event_fd(void) const { return m_epoll_fd; }
+
+    /* accepts new clients and reads the clients that have data, without blocking;
+     *  returns the number of ready descriptors handled, which is zero once there
+     *  is nothing left to do */
+    size_t service(ncurses_socket_record_handler& handler);
+
+    size_t get_client_count(void) const { return m_clients.size(); }
+    uint64_t get_refused_client_count(void) const { return m_refused_client_count; }
+    uint64_t get_bytes_read(void) const { return m_bytes_read; }
+    uint64_t get_batch_count(void) const { return m_batch_count; }
+    uint64_t get_record_count(void) const { return m_record_count; }
+    uint64_t get_rejected_record_count(void) const { return m_rejected_record_count; }
+
+    /* connections closed because they sent something that could not be decoded */
+    uint64_t get_protocol_error_count(void) const { return m_protocol_error_count; }
+
+private:
+
+    struct client_t
+    {
+        int                                                   fd;
+        size_t                                                client_idx;
+        size_t                                                buffered_len;
+        std::unique_ptr<uint8_t[]>                            buffer;
+    };
+
+    bool bind_socket(int listen_fd, const std::string& socket_path);
+    void accept_clients(void);
+    void close_client(client_t * client);
+    bool read_client(client_t * client, ncurses_socket_record_handler& handler);
+    bool decode_batch(const uint8_t * batch, size_t batch_len, ncurses_socket_record_handler& handler);
+
+    std::string                                               m_socket_path;
+    int                                                       m_listen_fd;
+    int                                                       m_epoll_fd;
+    uint32_t                                                  m_max_clients;
+    std::vector<std::unique_ptr<client_t>>                    m_clients;
+    std::vector<struct epoll_event>                           m_events;
+    ncurses_socket_record_t                                   m_record;
+
+    uint64_t                                                  m_refused_client_count;
+    uint64_t                                                  m_bytes_read;
+    uint64_t                                                  m_batch_count;
+    uint64_t                                                  m_record_count;
+    uint64_t                                                  m_rejected_record_count;
+    uint64_t                                                  m_protocol_error_count;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SOCKET_SERVER_H__
@@ -0,0 +1,243 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_sparkline_field.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Field that draws the recent history of a metric as a sparkline.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a field that keeps the last N samples of a float or double metric in
+ *  a ring buffer that is allocated once, when the field is created, and draws
+ *  them as a one line chart of a configurable width. Each column of the chart
+ *  summarizes a fixed number of consecutive samples by their average, minimum
+ *  or maximum, drawn as one of the characters of an ASCII level ramp.
+ *  Columns are aligned to the absolute sample count, so a new sample only
+ *  changes the rightmost column until that column is full and the chart
+ *  scrolls. Blocks of samples are summarized with vectorized reductions, and
+ *  only the columns whose character changed are redrawn.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_SPARKLINE_FIELD_H__
+#define __NCURSES_SPARKLINE_FIELD_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "ncurses_backend.h"
+#include "ncurses_colors.h"
+#include "ncurses_field.h"
+#include "ncurses_field_value.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/* how the samples behind a column are summarized */
+typedef enum {
+    NCURSES_CPP_SPARKLINE_AVERAGE = 0,
+    NCURSES_CPP_SPARKLINE_MINIMUM,
+    NCURSES_CPP_SPARKLINE_MAXIMUM
+} ncurses_cpp_sparkline_statistic_e;
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+template <typename T>
+class ncurses_sparkline_field : public ncurses_field_base
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "sparklines hold float or double samples");
+
+public:
+
+    ncurses_sparkline_field(void);
+    virtual ~ncurses_sparkline_field(void);
+
+    static ncurses_field_type_e get_series_type(void) { return std::is_same<T, float>::value ? NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES : NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES; }
+
+    ncurses_field_type_e get_field_type(void) const override { return get_series_type(); }
+    bool apply_update(const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color) override;
+
+    bool keeps_value_history(void) const override { return true; }
+    bool record_value(const ncurses_field_value_t& field_val) override;
+    bool redraw_field(ncurses_cpp_text_colors_e field_color) override;
+    bool move_to_window(ncurses_backend_window * window) override;
+
+    /* the history holds at least history_len samples; it is rounded up to a whole
+     *  number of samples per column */
+    bool create_field(ncurses_backend_window * window, uint32_t x, uint32_t y, uint32_t width, size_t history_len, ncurses_cpp_text_colors_e default_color);
+
+    /* NaN samples are rejected */
+    bool add_sample(const T& sample);
+    bool add_sample(const T& sample, ncurses_cpp_text_colors_e field_color);
+
+    /* appends a block of samples and redraws once; NaN samples are skipped */
+    bool add_samples(const T * samples, size_t num_samples);
+
+    void set_statistic(ncurses_cpp_sparkline_statistic_e statistic);
+
+    /* by default the vertical range follows the columns that are shown */
+    void set_range(T min_val, T max_val);
+    void set_auto_range(void);
+
+    uint32_t get_width(void) const { return m_width; }
+    size_t get_history_len(void) const { return m_history.size(); }
+    size_t get_samples_per_column(void) const { return m_samples_per_column; }
+    uint64_t get_sample_count(void) const { return m_sample_count; }
+
+    /* the chart as last drawn, one character per column */
+    const char * get_rendered_chart(void) const { return m_rendered_glyphs.data(); }
+
+    void set_refresh_state(ncurses_refresh_state_t * refresh_state) { m_refresh_state = refresh_state; }
+    void invalidate_rendered_image(void) { m_rendered_valid = false; }
+
+    uint64_t get_write_count(void) const { return m_write_count; }
+
+private:
+
+    struct column_stats_t
+    {
+        T                                                     min_val;
+        T                                                     max_val;
+        double                                                sum;
+        uint32_t                                              count;
+    };
+
+    static void reduce_samples(const T * samples, size_t num_samples, column_stats_t& stats);
+
+    bool append_sample(const T& sample);
+    void record_sample(const T& sample, ncurses_cpp_text_colors_e field_color);
+    bool draw_chart(ncurses_cpp_text_colors_e field_color);
+    double get_column_value(const column_stats_t& stats) const;
+    void refresh_window(void);
+
+    ncurses_backend_window *                                  m_window;
+    uint32_t                                                  m_x;
+    uint32_t                                                  m_y;
+    uint32_t                                                  m_width;
+    ncurses_cpp_text_colors_e                                 m_default_color;
+    ncurses_cpp_sparkline_statistic_e                         m_statistic;
+    bool                                                      m_auto_range;
+    T                                                         m_range_min;
+    T                                                         m_range_max;
+
+    /* sample i lives at m_history[i % m_history.size()]; the size is a multiple of
+     *  m_samples_per_column, so a column's samples never wrap around the end */
+    std::vector<T>                                            m_history;
+    size_t                                                    m_samples_per_column;
+    uint64_t                                                  m_sample_count;
+
+    /* summary of column (sample index / m_samples_per_column) at that index modulo
+     *  the width */
+    std::vector<column_stats_t>                               m_columns;
+
+    /* scratch space for drawing, allocated with the field */
+    std::vector<double>                                       m_column_values;
+    std::vector<char>                                         m_glyphs;
+
+    /* values and range of the shown columns before the newest one, valid while the
+     *  column count and the chart settings stay the same */
+    bool                                                      m_settled_valid;
+    uint64_t                                                  m_settled_column_count;
+    double                                                    m_settled_min;
+    double                                                    m_settled_max;
+
+    /* the range the glyphs were last leveled against */
+    double                                                    m_level_range_min;
+    double                                                    m_level_range_max;
+
+    ncurses_refresh_state_t *                                 m_refresh_state;
+    std::vector<char>                                         m_rendered_glyphs;
+    ncurses_cpp_text_colors_e                                 m_rendered_color;
+    bool                                                      m_rendered_valid;
+    uint64_t                                                  m_write_count;
+};
+
+/* counterpart of ncurses_field_handle for sparkline fields */
+template <typename T>
+class ncurses_sparkline_handle
+{
+public:
+
+    ncurses_sparkline_handle(void) : m_field(nullptr) { }
+    explicit ncurses_sparkline_handle(ncurses_sparkline_field<T> * field) : m_field(field) { }
+
+    bool is_valid(void) const { return nullptr != m_field; }
+    ncurses_sparkline_field<T> * get_field(void) const { return m_field; }
+    explicit operator bool(void) const { return is_valid(); }
+
+    bool add_sample(const T& sample)
+    {
+        return nullptr != m_field && m_field->add_sample(sample);
+    }
+
+    bool add_sample(const T& sample, ncurses_cpp_text_colors_e field_color)
+    {
+        return nullptr != m_field && m_field->add_sample(sample, field_color);
+    }
+
+    bool add_samples(const T * samples, size_t num_samples)
+    {
+        return nullptr != m_field && m_field->add_samples(samples, num_samples);
+    }
+
+private:
+
+    ncurses_sparkline_field<T> *                              m_field;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_SPARKLINE_FIELD_H__
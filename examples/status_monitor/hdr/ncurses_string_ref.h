@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_string_ref.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Non-owning reference to a run of characters.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a pointer and length pair that the name-based update paths accept
+ *  in place of a std::string. A string literal, a character buffer or a
+ *  std::string all convert to it without copying, so looking a field up by
+ *  name never builds a temporary std::string that might have to allocate. The
+ *  referenced characters must outlive the call they are passed to.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_STRING_REF_H__
+#define __NCURSES_STRING_REF_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_string_ref
+{
+public:
+
+    ncurses_string_ref(void) : m_data(""), m_size(0) { }
+    ncurses_string_ref(const char * str) : m_data(str), m_size(strlen(str)) { }
+    ncurses_string_ref(const char * str, size_t len) : m_data(str), m_size(len) { }
+    ncurses_string_ref(const std::string& str) : m_data(str.data()), m_size(str.size()) { }
+
+    const char * data(void) const { return m_data; }
+    size_t size(void) const { return m_size; }
+    bool empty(void) const { return 0 == m_size; }
+
+    std::string to_string(void) const { return std::string(m_data, m_size); }
+
+    bool operator==(const ncurses_string_ref& other) const { return m_size == other.m_size && 0 == memcmp(m_data, other.m_data, m_size); }
+    bool operator!=(const ncurses_string_ref& other) const { return !(*this == other); }
+
+private:
+
+    const char *                                              m_data;
+    size_t                                                    m_size;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_STRING_REF_H__
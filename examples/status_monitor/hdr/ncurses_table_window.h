@@ -0,0 +1,302 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_table_window.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Window that shows a large table through a scrolling viewport.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines an ncurses_window subtype for tables with many rows, e.g. network
+ *  connections or queue entries. Cells are kept in a column-oriented store with
+ *  one typed array per column instead of one ncurses_field per cell, and only
+ *  the rows inside the viewport are ever drawn. Scrolling redraws the visible
+ *  rows, regardless of the size of the table, and updating a row that is not
+ *  visible only writes the store.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_TABLE_WINDOW_H__
+#define __NCURSES_TABLE_WINDOW_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_format.h"
+#include "ncurses_field_value.h"
+#include "ncurses_window.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* the cells of one table column, stored contiguously by row */
+class ncurses_table_column_base
+{
+public:
+
+    ncurses_table_column_base(const std::string& header, uint32_t width) : m_header(header), m_width(width) { }
+    virtual ~ncurses_table_column_base(void) { }
+
+    virtual ncurses_field_type_e get_column_type(void) const = 0;
+
+    virtual void resize(size_t num_rows) = 0;
+
+    /* writes the formatted cell into the buffer as a NUL-terminated string and
+     *  returns its length */
+    virtual size_t render_cell(size_t row, char * buf, size_t buf_size) const = 0;
+
+    const std::string& get_header(void) const { return m_header; }
+    uint32_t get_width(void) const { return m_width; }
+
+private:
+
+    std::string                                               m_header;
+    uint32_t                                                  m_width;
+};
+
+template <typename T>
+class ncurses_table_column : public ncurses_table_column_base
+{
+public:
+
+    ncurses_table_column(const std::string& header, uint32_t width);
+    virtual ~ncurses_table_column(void);
+
+    ncurses_field_type_e get_column_type(void) const override { return ncurses_field_value_traits<T>::type; }
+
+    /* returns false if the format does not match the column type */
+    bool compile_format(const std::string& format_str);
+
+    void resize(size_t num_rows) override;
+    size_t render_cell(size_t row, char * buf, size_t buf_size) const override;
+
+    void set_value(size_t row, const T& cell_val) { m_values[row] = cell_val; }
+    T get_value(size_t row) const { return m_values[row]; }
+
+private:
+
+    std::vector<T>                                            m_values;
+    ncurses_field_format                                      m_format;
+};
+
+class ncurses_table_window : public ncurses_window
+{
+public:
+
+    ncurses_table_window(std::string window_name);
+    ncurses_table_window(std::string window_name, bool outline_window);
+    virtual ~ncurses_table_window(void);
+
+    using ncurses_window::create_window;
+    bool create_window(uint32_t height, uint32_t width, uint32_t start_x, uint32_t start_y) override;
+
+    /* columns are laid out from left to right in the order they are added, one space
+     *  apart, under a header line; returns false if the format does not compile for
+     *  the column type */
+    template <typename T>
+    bool add_column(const std::string& header, uint32_t width, const std::string& format_str);
+
+    size_t get_column_count(void) const { return m_columns.size(); }
+
+    /* new rows start out with default values and the default color */
+    void set_row_count(size_t num_rows);
+    size_t get_row_count(void) const { return m_num_rows; }
+
+    /* only rows inside the viewport are drawn; updating any other row just writes
+     *  the column store */
+    template <typename T>
+    bool set_cell(size_t row, size_t column, const T& cell_val);
+
+    template <typename T>
+    bool get_cell(size_t row, size_t column, T& cell_val) const;
+
+    bool set_row_color(size_t row, ncurses_cpp_text_colors_e row_color);
+
+    uint32_t get_visible_row_count(void) const;
+    size_t get_first_visible_row(void) const { return m_first_row; }
+
+    /* the viewport is kept within the table; returns false if it did not move */
+    bool scroll_to(size_t first_row);
+    bool scroll_by(int64_t num_rows);
+
+    /* moves the viewport for the arrow, page up/down, home and end keys; returns
+     *  false for any other key */
+    bool handle_scroll_key(int key);
+
+    /* number of table rows drawn since the window was created */
+    uint64_t get_rows_drawn(void) const { return m_rows_drawn; }
+
+private:
+
+    template <typename T>
+    ncurses_table_column<T> * find_column(size_t column) const;
+
+    uint32_t get_first_line(void) const;
+    uint32_t get_line_width(void) const;
+    size_t get_last_first_row(void) const;
+    bool is_row_visible(size_t row) const;
+
+    void draw_header(void);
+    void draw_row(size_t row);
+    void draw_viewport(void);
+    void draw_line(uint32_t line, ncurses_cpp_text_colors_e line_color);
+
+    void redraw_contents(void) override;
+
+    std::vector<std::unique_ptr<ncurses_table_column_base>>   m_columns;
+    std::vector<ncurses_cpp_text_colors_e>                    m_row_colors;
+    size_t                                                    m_num_rows;
+    size_t                                                    m_first_row;
+
+    /* scratch space for drawing, sized when the window or a column is created */
+    std::vector<char>                                         m_line_buf;
+    std::vector<char>                                         m_cell_buf;
+
+    uint64_t                                                  m_rows_drawn;
+};
+
+
+/******************************************************************************
+ *                            TEMPLATE FUNCTIONS
+ *****************************************************************************/
+
+template <typename T>
+bool ncurses_table_window::add_column(const std::string& header, uint32_t width, const std::string& format_str)
+{
+    bool ret = false;
+
+    std::unique_ptr<ncurses_table_column<T>> new_column(new ncurses_table_column<T>(header, width));
+    if (width > 0 &&
+        new_column->compile_format(format_str))
+    {
+        new_column->resize(m_num_rows);
+        m_columns.push_back(std::move(new_column));
+
+        if (m_cell_buf.size() < width + 1)
+        {
+            m_cell_buf.resize(width + 1);
+        }
+
+        if (nullptr != get_backend_window())
+        {
+            draw_header();
+            draw_viewport();
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+template <typename T>
+bool ncurses_table_window::set_cell(size_t row, size_t column, const T& cell_val)
+{
+    bool ret = false;
+
+    ncurses_table_column<T> * table_column = find_column<T>(column);
+    if (nullptr != table_column &&
+        row < m_num_rows)
+    {
+        table_column->set_value(row, cell_val);
+
+        if (is_row_visible(row))
+        {
+            draw_row(row);
+            refresh_window();
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+template <typename T>
+bool ncurses_table_window::get_cell(size_t row, size_t column, T& cell_val) const
+{
+    bool ret = false;
+
+    ncurses_table_column<T> * table_column = find_column<T>(column);
+    if (nullptr != table_column &&
+        row < m_num_rows)
+    {
+        cell_val = table_column->get_value(row);
+        ret = true;
+    }
+
+    return ret;
+}
+
+template <typename T>
+ncurses_table_column<T> * ncurses_table_window::find_column(size_t column) const
+{
+    if (column < m_columns.size() &&
+        ncurses_field_value_traits<T>::type == m_columns[column]->get_column_type())
+    {
+        return static_cast<ncurses_table_column<T> *>(m_columns[column].get());
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_TABLE_WINDOW_H__
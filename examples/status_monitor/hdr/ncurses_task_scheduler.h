@@ -0,0 +1,189 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_task_scheduler.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Runs periodic tasks, each at its own period, on a small worker pool.
+ *
+ * @section  DESCRIPTION
+ *
+ * Each task has a run function, called on a worker thread every period, and an
+ *  optional completion function that hands the results back to the thread that
+ *  owns the user interface; completions are collected by the scheduler and
+ *  called from run_completions(). A task never runs concurrently with itself:
+ *  from the moment it is dispatched until its completion has been called it is
+ *  busy, so the completion can read whatever the run left behind without any
+ *  further locking. The next deadline of every task is kept in a min-heap that
+ *  the idle workers wait on.
+ *
+ * A run that starts more than a tenth of its period after it was due, because
+ *  every worker was busy, is counted as late. A deadline that arrives while the
+ *  task is still busy is counted as an overrun and skipped; the task stays on
+ *  its original period instead of running back to back to catch up.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_TASK_SCHEDULER_H__
+#define __NCURSES_TASK_SCHEDULER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const size_t NCURSES_TASK_DEFAULT_WORKER_COUNT = 2;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct ncurses_task_stats_t
+{
+    uint64_t                                                  run_count;
+    uint64_t                                                  late_count;
+    uint64_t                                                  overrun_count;
+
+    /* how long after its deadline each run started, and how long it ran */
+    std::chrono::steady_clock::duration                       start_delay_total;
+    std::chrono::steady_clock::duration                       start_delay_max;
+    std::chrono::steady_clock::duration                       run_time_max;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_task_scheduler
+{
+public:
+
+    typedef std::function<void(void)> task_function_t;
+
+    ncurses_task_scheduler(void);
+    virtual ~ncurses_task_scheduler(void);
+
+    /* tasks can be added before or after start(), from the thread that starts and
+     *  stops the scheduler; the first run is one period after the task is added or
+     *  the scheduler is started, whichever is later. returns the task index, or -1 if
+     *  the period is zero or there is no run function. */
+    int32_t add_task(const std::string& task_name, std::chrono::milliseconds period, task_function_t run_function);
+    int32_t add_task(const std::string& task_name, std::chrono::milliseconds period, task_function_t run_function, task_function_t completion_function);
+
+    /* called from a worker whenever a completion is waiting, e.g. to wake the event
+     *  loop; only set this while the scheduler is stopped */
+    void set_completion_notifier(task_function_t notifier) { m_completion_notifier = notifier; }
+
+    bool start(size_t num_workers);
+    bool is_running(void) const { return !m_workers.empty(); }
+
+    /* waits for the running tasks to return; completions that are still waiting are
+     *  discarded */
+    void stop(void);
+
+    /* calls the completion functions of the runs that finished since the last call;
+     *  returns the number called */
+    size_t run_completions(void);
+
+    size_t get_task_count(void) const;
+    std::string get_task_name(size_t task_idx) const;
+    bool get_task_stats(size_t task_idx, ncurses_task_stats_t& stats) const;
+
+    /* totals over all tasks */
+    uint64_t get_run_count(void) const;
+    uint64_t get_late_count(void) const;
+    uint64_t get_overrun_count(void) const;
+
+private:
+
+    struct task_t
+    {
+        std::string                                           name;
+        std::chrono::steady_clock::duration                   period;
+        task_function_t                                       run_function;
+        task_function_t                                       completion_function;
+        bool                                                  busy;
+        ncurses_task_stats_t                                  stats;
+    };
+
+    struct deadline_t
+    {
+        std::chrono::steady_clock::time_point                 due_time;
+        size_t                                                task_idx;
+
+        /* orders the heap with the earliest deadline on top */
+        bool operator<(const deadline_t& rhs) const { return due_time > rhs.due_time; }
+    };
+
+    void schedule(size_t task_idx, std::chrono::steady_clock::time_point due_time);
+    void run_worker(void);
+
+    mutable std::mutex                                        m_mutex;
+    std::condition_variable                                   m_wakeup;
+    std::vector<std::unique_ptr<task_t>>                      m_tasks;
+    std::vector<deadline_t>                                   m_deadlines;
+    std::vector<task_t *>                                     m_completed;
+    std::vector<task_t *>                                     m_completing;
+    task_function_t                                           m_completion_notifier;
+    std::vector<std::thread>                                  m_workers;
+    bool                                                      m_stopping;
+
+    uint64_t                                                  m_run_count;
+    uint64_t                                                  m_late_count;
+    uint64_t                                                  m_overrun_count;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_TASK_SCHEDULER_H__
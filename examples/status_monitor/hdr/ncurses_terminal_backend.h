@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_terminal_backend.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend that draws on a terminal through curses.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines the curses implementation of the ncurses_backend interface. It
+ *  either takes over the process' controlling terminal (initscr()) or drives
+ *  the terminal behind a pair of FILE streams (newterm()).
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_TERMINAL_BACKEND_H__
+#define __NCURSES_TERMINAL_BACKEND_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstdio>
+#include <memory>
+
+#include <ncurses.h>
+
+#include "ncurses_backend.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_terminal_backend : public ncurses_backend
+{
+public:
+
+    /* uses the process' controlling terminal */
+    ncurses_terminal_backend(void);
+
+    /* uses the terminal behind term_out/term_in (see newterm()) */
+    ncurses_terminal_backend(FILE * term_out, FILE * term_in);
+
+    virtual ~ncurses_terminal_backend(void);
+
+    bool open_screen(void) override;
+    void close_screen(void) override;
+
+    uint32_t get_rows(void) const override;
+    uint32_t get_cols(void) const override;
+    void handle_resize(void) override;
+
+    ncurses_backend_window * get_screen_window(void) override { return m_screen_window.get(); }
+    std::unique_ptr<ncurses_backend_window> create_window(uint32_t height, uint32_t width, uint32_t begin_y, uint32_t begin_x) override;
+
+    void commit_frame(void) override;
+
+    int read_char(void) override;
+    void push_char(int ch) override;
+    int get_input_fd(void) const override;
+
+private:
+
+    FILE *                                                    m_term_out;
+    FILE *                                                    m_term_in;
+    SCREEN *                                                  m_screen;
+    bool                                                      m_screen_open;
+    std::unique_ptr<ncurses_backend_window>                   m_screen_window;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_TERMINAL_BACKEND_H__
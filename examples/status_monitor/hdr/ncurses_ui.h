@@ -48,12 +48,24 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
+#include <atomic>
 #include <chrono>
+#include <cstdio>
 #include <map>
 #include <memory>
 #include <string>
 
+#include "ncurses_backend.h"
 #include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+#include "ncurses_layout.h"
+#include "ncurses_shm_reader.h"
+#include "ncurses_socket_server.h"
+#include "ncurses_string_ref.h"
+#include "ncurses_task_scheduler.h"
+#include "ncurses_update_coalescer.h"
+#include "ncurses_update_queue.h"
+#include "ncurses_update_recorder.h"
 #include "ncurses_window.h"
 
 namespace ncurses_cpp {
@@ -66,6 +78,27 @@ namespace ncurses_cpp {
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
 
+/* render statistics from the most recent diagnostics interval; in immediate mode
+ *  every pass of the event loop counts as a frame */
+struct ncurses_ui_diagnostics_t
+{
+    double                                                      frame_time_avg_ms;
+    double                                                      frame_time_max_ms;
+    double                                                      periodic_task_time_max_ms;
+    double                                                      updates_applied_per_sec;
+    double                                                      updates_dropped_per_sec;
+    double                                                      terminal_bytes_per_frame;
+    double                                                      wakeups_per_sec;
+    uint64_t                                                    wakeup_count;
+
+    /* color pairs evicted from the pair cache to make room for other colors */
+    double                                                      pair_evictions_per_sec;
+
+    /* totals since the user interface was created */
+    uint64_t                                                    late_task_count;
+    uint64_t                                                    overrun_task_count;
+};
+
 /******************************************************************************
  *                                  MACROS
  *****************************************************************************/
@@ -78,43 +111,265 @@ namespace ncurses_cpp {
  *                            CLASS DECLARATION
  *****************************************************************************/
 
-class ncurses_ui
+class ncurses_ui : private ncurses_socket_record_handler
 {
 public:
 
     ncurses_ui(void);
+
+    /* handle_periodic_tasks() is called at the given interval; zero never calls it */
     ncurses_ui(int shutdown_key, uint32_t periodic_task_interval_in_ms);
+
+    /* runs the user interface on the terminal behind term_out/term_in (see newterm())
+     *  instead of the process' controlling terminal */
+    ncurses_ui(int shutdown_key, uint32_t periodic_task_interval_in_ms, FILE * term_out, FILE * term_in);
+
+    /* renders through the given backend, e.g. an ncurses_memory_backend to run
+     *  without a terminal */
+    ncurses_ui(int shutdown_key, uint32_t periodic_task_interval_in_ms, std::unique_ptr<ncurses_backend> backend);
     virtual ~ncurses_ui(void);
 
     bool run(void);
 
+    /* applies all queued updates right away, committing a frame in frame commit mode;
+     *  lets tests and benchmarks drive the user interface without the event loop */
+    void flush_updates(void);
+
+    /* when enabled, field updates only mark their windows dirty and the terminal is
+     *  flushed once per frame with a single doupdate() */
+    void set_frame_commit_mode(bool enabled);
+    bool get_frame_commit_mode(void) const { return m_frame_commit_mode; }
+
+    /* limits how often frames are committed; zero removes the limit */
+    void set_max_frame_rate(uint32_t max_frames_per_sec);
+
+    /* called by the event loop when the terminal reports a new size (KEY_RESIZE, which
+     *  is then passed on to handle_char()); windows created from a geometry that
+     *  changed are rebuilt from their fields' current values and everything is
+     *  redrawn in a single frame */
+    void handle_resize(void);
+    uint64_t get_resize_count(void) const { return m_resize_count; }
+    uint64_t get_relayout_count(void) const { return m_relayout_count; }
+
+    uint64_t get_frame_count(void) const { return m_frame_count; }
+    uint64_t get_saved_flush_count(void) const { return m_saved_flush_count; }
+
+    /* replaces the update queue; only call this before any thread posts updates */
+    void configure_update_queue(size_t capacity, ncurses_update_overflow_policy_e overflow_policy);
+    void set_update_overflow_policy(ncurses_update_overflow_policy_e overflow_policy);
+
+    /* may be called from any thread; the update is applied by the user interface
+     *  thread the next time it drains the update queue */
+    template <typename T>
+    bool post_update(const ncurses_field_handle<T>& handle, const T& field_val);
+
+    template <typename T>
+    bool post_update(const ncurses_field_handle<T>& handle, const T& field_val, ncurses_cpp_text_colors_e field_color);
+
+    /* string values straight from a character buffer; the text is copied into the
+     *  update itself, truncated to NCURSES_CPP_FIELD_VALUE_STR_CAPACITY characters */
+    bool post_update(const ncurses_field_handle<std::string>& handle, ncurses_string_ref field_val);
+    bool post_update(const ncurses_field_handle<std::string>& handle, ncurses_string_ref field_val, ncurses_cpp_text_colors_e field_color);
+
+    /* every posted sample is added to the sparkline, even when several arrive between
+     *  frames; the sparkline is redrawn once per frame */
+    template <typename T>
+    bool post_update(const ncurses_sparkline_handle<T>& handle, const T& sample);
+
+    template <typename T>
+    bool post_update(const ncurses_sparkline_handle<T>& handle, const T& sample, ncurses_cpp_text_colors_e field_color);
+
+    uint64_t get_enqueued_update_count(void) const { return m_update_queue->get_enqueued_count(); }
+    uint64_t get_dropped_update_count(void) const { return m_update_queue->get_dropped_count(); }
+    uint64_t get_applied_update_count(void) const { return m_applied_update_count; }
+    uint64_t get_coalesced_update_count(void) const { return m_update_coalescer.get_coalesced_count(); }
+
+    /* values published by other processes through a shared-memory segment; the
+     *  reader is polled at its poll interval and its updates are applied together
+     *  with the queued ones. pass nullptr to stop polling. */
+    void set_shm_reader(std::shared_ptr<ncurses_shm_reader> shm_reader);
+
+    /* accepts update batches from local processes on a Unix-domain socket (see
+     *  ncurses_socket_protocol.h); the updates are applied in the same frames as
+     *  posted ones. fails if another process is listening on the path. */
+    bool listen_on_socket(const std::string& socket_path);
+    void stop_listening(void);
+    const ncurses_socket_server& get_socket_server(void) const { return m_socket_server; }
+
+    /* builds windows from a layout file (see ncurses_layout.h). when watched, the file
+     *  is reloaded every time it is saved: only the windows whose statements changed
+     *  are rebuilt and their fields keep the current values. a file that does not load
+     *  leaves the windows as they are and sets the layout error. rebuilding a window
+     *  invalidates the handles to its fields. */
+    bool load_layout(const std::string& layout_path, bool watch_for_changes);
+    bool reload_layout(void);
+    const std::string& get_layout_error(void) const { return m_layout_error; }
+    uint64_t get_layout_reload_count(void) const { return m_layout_reload_count; }
+
+    /* runs the task on a worker thread every period while run() is going, so that a
+     *  slow task never holds up input or frames. the completion, if given, is then
+     *  called on the user interface thread and is where the results go into fields
+     *  and tables; the task does not run again until its completion returns. tasks
+     *  that start late or are still busy when they are due again are counted (see
+     *  ncurses_task_scheduler.h). returns the task index or -1. */
+    int32_t add_periodic_task(const std::string& task_name, std::chrono::milliseconds period, ncurses_task_scheduler::task_function_t run_function);
+    int32_t add_periodic_task(const std::string& task_name, std::chrono::milliseconds period, ncurses_task_scheduler::task_function_t run_function, ncurses_task_scheduler::task_function_t completion_function);
+
+    /* only takes effect when run() starts the workers */
+    void set_task_worker_count(size_t num_workers) { m_task_worker_count = num_workers; }
+    const ncurses_task_scheduler& get_task_scheduler(void) const { return m_task_scheduler; }
+
+    /* may be called from any thread; wakes the event loop so that it picks up new
+     *  data right away. post_update() does this automatically. */
+    void notify_wakeup(void);
+
+    /* the event loop sleeps until input, the periodic timer or a wakeup arrives;
+     *  when measurement is enabled the wakeup rate is shown on the status line */
+    void set_wakeup_measurement(bool enabled) { m_wakeup_measurement = enabled; }
+    uint64_t get_wakeup_count(void) const { return m_wakeup_count; }
+    double get_wakeups_per_second(void) const { return m_wakeups_per_second; }
+
+    /* records every update of the fields in the added windows, including windows
+     *  and fields added later, into a binary log (see ncurses_update_log.h) until
+     *  stop_recording(); the replay example plays a log back. the diagnostics
+     *  overlay is not recorded. fails if the log cannot be created. */
+    bool start_recording(const std::string& log_path);
+    void stop_recording(void);
+    bool is_recording(void) const { return nullptr != m_update_recorder; }
+    const ncurses_update_recorder * get_update_recorder(void) const { return m_update_recorder.get(); }
+
+    /* the statistics behind the diagnostics overlay are always collected; the overlay
+     *  itself is a small window in the top right corner that is toggled by a key */
+    void set_diagnostics_toggle_key(int toggle_key) { m_diagnostics_toggle_key = toggle_key; }
+    void set_diagnostics_visible(bool visible);
+    bool get_diagnostics_visible(void) const { return nullptr != m_diagnostics_window; }
+    const ncurses_ui_diagnostics_t& get_diagnostics(void) const { return m_diagnostics; }
+
 protected:
 
     bool add_window(std::shared_ptr<ncurses_window> window);
 
     template <typename T>
-    bool update_field(std::string window_name, std::string field_name, T field_val);
+    bool update_field(ncurses_string_ref window_name, ncurses_string_ref field_name, const T& field_val);
+
+    template <typename T>
+    bool update_field(ncurses_string_ref window_name, ncurses_string_ref field_name, const T& field_val, ncurses_cpp_text_colors_e field_color);
+
+    /* stages a type-tagged update by name, the way the update socket does, to be
+     *  applied with the next frame; fails if there is no such field or the value
+     *  type does not match it */
+    bool stage_update(ncurses_string_ref window_name, ncurses_string_ref field_name, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color);
 
+    /* resolves a field once so that frequent updates can skip the name lookups */
     template <typename T>
-    bool update_field(std::string window_name, std::string field_name, T field_val, ncurses_cpp_text_colors_e field_color);
+    ncurses_field_handle<T> get_field_handle(ncurses_string_ref window_name, ncurses_string_ref field_name);
 
     /* derived class should override; automatically invoked when a new character
      *  is availabe */
     virtual void handle_char(int next_char);
 
     /* derived class should override; automatically invoked periodically based on the
-     *  rate specified by a constructor argument */
+     *  rate specified by a constructor argument. runs on the user interface thread, so
+     *  anything slow belongs in add_periodic_task() instead. */
     virtual void handle_periodic_tasks(void);
 
 private:
 
     void setup_ncurses(void);
+    void draw_status_line(void);
+    ncurses_window * find_window(ncurses_string_ref window_name);
     void cleanup_ncurses(void);
+    void setup_event_sources(void);
+    void cleanup_event_sources(void);
+    int get_poll_timeout_in_ms(void) const;
+    bool handle_input(void);
+    void handle_timer(void);
+    void handle_wakeup(void);
+    void update_wakeup_measurement(void);
+    void update_diagnostics(void);
+    void show_diagnostics(void);
+    void redraw_all_windows(void);
+    uint64_t read_terminal_bytes_written(void) const;
+    void commit_frame(void);
+    void drain_update_queue(void);
+    void apply_queued_updates(void);
+    void poll_shm_reader(void);
+    void service_socket(void);
+    bool handle_socket_record(const ncurses_socket_record_t& record) override;
+    bool apply_layout(std::unique_ptr<ncurses_layout> layout);
+    void handle_layout_event(void);
+    void stop_watching_layout(void);
 
     int                                                         m_shutdown_key;
     uint32_t                                                    m_periodic_task_interval_in_ms;
     std::chrono::steady_clock::time_point                       m_last_periodic_task_invocation;
+    bool                                                        m_frame_commit_mode;
+    std::chrono::microseconds                                   m_min_frame_interval;
+    std::chrono::steady_clock::time_point                       m_last_frame_commit;
+    uint64_t                                                    m_frame_count;
+    uint64_t                                                    m_resize_count;
+    uint64_t                                                    m_relayout_count;
+    uint64_t                                                    m_saved_flush_count;
+    std::unique_ptr<ncurses_update_queue>                       m_update_queue;
+    ncurses_update_coalescer                                    m_update_coalescer;
+    uint64_t                                                    m_applied_update_count;
+    std::shared_ptr<ncurses_shm_reader>                         m_shm_reader;
+    std::chrono::steady_clock::time_point                       m_last_shm_poll;
+    ncurses_socket_server                                       m_socket_server;
+    std::unique_ptr<ncurses_layout>                             m_layout;
+    std::string                                                 m_layout_path;
+    std::string                                                 m_layout_error;
+    uint64_t                                                    m_layout_reload_count;
+    int                                                         m_layout_watch_fd;
+    ncurses_task_scheduler                                      m_task_scheduler;
+    size_t                                                      m_task_worker_count;
+    std::unique_ptr<ncurses_update_recorder>                    m_update_recorder;
+
+    std::unique_ptr<ncurses_backend>                            m_backend;
+    int                                                         m_input_fd;
+    int                                                         m_timer_fd;
+    int                                                         m_wakeup_fd;
+    std::atomic<bool>                                           m_wakeup_pending;
+    bool                                                        m_frame_pending;
+    bool                                                        m_wakeup_measurement;
+    uint64_t                                                    m_wakeup_count;
+    uint64_t                                                    m_wakeup_count_at_measurement_start;
+    std::chrono::steady_clock::time_point                       m_wakeup_measurement_start;
+    double                                                      m_wakeups_per_second;
     std::map<std::string, std::shared_ptr<ncurses_window>>      m_windows_by_name;
+
+    /* diagnostics accumulated over the current interval */
+    ncurses_ui_diagnostics_t                                    m_diagnostics;
+    std::chrono::steady_clock::time_point                       m_diagnostics_interval_start;
+    std::chrono::steady_clock::duration                         m_frame_time_total;
+    std::chrono::steady_clock::duration                         m_frame_time_max;
+    std::chrono::steady_clock::duration                         m_periodic_task_time_max;
+    uint64_t                                                    m_timed_frame_count;
+    uint64_t                                                    m_frames_at_interval_start;
+    uint64_t                                                    m_applied_at_interval_start;
+    uint64_t                                                    m_dropped_at_interval_start;
+    uint64_t                                                    m_terminal_bytes_at_interval_start;
+    uint64_t                                                    m_pair_evictions_at_interval_start;
+    int                                                         m_io_stats_fd;
+    int                                                         m_diagnostics_toggle_key;
+
+    struct diagnostics_fields_t
+    {
+        ncurses_field_handle<double>                            frame_time_avg;
+        ncurses_field_handle<double>                            frame_time_max;
+        ncurses_field_handle<double>                            periodic_task_time_max;
+        ncurses_field_handle<double>                            updates_applied;
+        ncurses_field_handle<double>                            updates_dropped;
+        ncurses_field_handle<double>                            terminal_bytes;
+        ncurses_field_handle<double>                            wakeups_per_sec;
+        ncurses_field_handle<uint64_t>                          wakeup_count;
+        ncurses_field_handle<uint64_t>                          late_task_count;
+        ncurses_field_handle<uint64_t>                          overrun_task_count;
+        ncurses_field_handle<double>                            pair_evictions;
+    };
+
+    std::shared_ptr<ncurses_window>                             m_diagnostics_window;
+    diagnostics_fields_t                                        m_diagnostics_fields;
 };
 
 /******************************************************************************
@@ -125,29 +380,73 @@ private:
  *  helps the linker resolve the template versions */
 
 template <typename T>
-bool ncurses_ui::update_field(std::string window_name, std::string field_name, T field_val)
+bool ncurses_ui::update_field(ncurses_string_ref window_name, ncurses_string_ref field_name, const T& field_val)
 {
-    if (m_windows_by_name.count(window_name) > 0)
-    {
-        return m_windows_by_name[window_name]->update_field<T>(field_name, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
-    }
-    else
-    {
-        return false;
-    }
+    return update_field<T>(window_name, field_name, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
 }
 
 template <typename T>
-bool ncurses_ui::update_field(std::string window_name, std::string field_name, T field_val, ncurses_cpp_text_colors_e field_color)
+bool ncurses_ui::update_field(ncurses_string_ref window_name, ncurses_string_ref field_name, const T& field_val, ncurses_cpp_text_colors_e field_color)
 {
-    if (m_windows_by_name.count(window_name) > 0)
+    ncurses_window * window = find_window(window_name);
+    return nullptr != window && window->update_field<T>(field_name, field_val, field_color);
+}
+
+template <typename T>
+ncurses_field_handle<T> ncurses_ui::get_field_handle(ncurses_string_ref window_name, ncurses_string_ref field_name)
+{
+    ncurses_window * window = find_window(window_name);
+    return nullptr != window ? window->get_field_handle<T>(field_name) : ncurses_field_handle<T>();
+}
+
+template <typename T>
+bool ncurses_ui::post_update(const ncurses_field_handle<T>& handle, const T& field_val)
+{
+    return post_update<T>(handle, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+template <typename T>
+bool ncurses_ui::post_update(const ncurses_field_handle<T>& handle, const T& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    if (handle.is_valid())
     {
-        return m_windows_by_name[window_name]->update_field<T>(field_name, field_val, field_color);
+        ncurses_field_update_t update;
+        update.field = handle.get_field();
+        update.color = field_color;
+        ncurses_field_value_traits<T>::store(update.value, field_val);
+
+        ret = m_update_queue->post(update);
+        notify_wakeup();
     }
-    else
+
+    return ret;
+}
+
+template <typename T>
+bool ncurses_ui::post_update(const ncurses_sparkline_handle<T>& handle, const T& sample)
+{
+    return post_update<T>(handle, sample, NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+template <typename T>
+bool ncurses_ui::post_update(const ncurses_sparkline_handle<T>& handle, const T& sample, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    if (handle.is_valid())
     {
-        return false;
+        ncurses_field_update_t update;
+        update.field = handle.get_field();
+        update.color = field_color;
+        ncurses_field_value_traits<T>::store(update.value, sample);
+
+        ret = m_update_queue->post(update);
+        notify_wakeup();
     }
+
+    return ret;
 }
 
 }; /* end of the ncurses_cpp namespace */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_coalescer.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Keeps only the latest pending update for each field.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a last-writer-wins staging area that sits between the update queue
+ *  and the ncurses windows. Updates staged for a field that already has a
+ *  pending update replace it, so the rendering cost of a frame depends on the
+ *  number of distinct dirty fields rather than on the rate of incoming updates.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_UPDATE_COALESCER_H__
+#define __NCURSES_UPDATE_COALESCER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "ncurses_field.h"
+#include "ncurses_update_queue.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_update_coalescer
+{
+public:
+
+    ncurses_update_coalescer(void);
+    virtual ~ncurses_update_coalescer(void);
+
+    /* replaces any update already pending for the same field */
+    void stage(const ncurses_field_update_t& update);
+
+    /* applies the pending updates in the order their fields first became dirty;
+     *  returns the number of updates that were applied successfully */
+    size_t commit(void);
+
+    /* drops all pending updates without applying them; must be called before the
+     *  fields with pending updates are destroyed */
+    void discard(void);
+
+    size_t get_pending_count(void) const { return m_pending.size(); }
+    uint64_t get_coalesced_count(void) const { return m_coalesced_count; }
+
+private:
+
+    std::vector<ncurses_field_update_t>                       m_pending;
+    uint64_t                                                  m_coalesced_count;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_UPDATE_COALESCER_H__
@@ -0,0 +1,215 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_log.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Format of the field update log and a reader for it.
+ *
+ * @section  DESCRIPTION
+ *
+ * An ncurses_ui can record every field update into an append-only binary log
+ *  (see ncurses_update_recorder.h) that examples/replay feeds back into a user
+ *  interface. Integers are in host byte order because logs are replayed on the
+ *  machine, or at least the architecture, that recorded them; varints are
+ *  LEB128, seven bits per byte with the high bit set on all but the last byte.
+ *
+ *   header  char   magic[4]        "NCRL"
+ *           uint32 version         NCURSES_UPDATE_LOG_VERSION
+ *           int64  start_time      system_clock nanoseconds since the epoch when
+ *                                   recording started
+ *
+ *   record  uint8  kind            NCURSES_UPDATE_LOG_FIELD or
+ *                                   NCURSES_UPDATE_LOG_UPDATE; zero ends the log
+ *
+ *   FIELD   varint field_id        ids are assigned in order from zero; a field
+ *                                   is defined before its first update
+ *           uint8  field_type      ncurses_field_type_e of the field
+ *           uint8  window_name_len
+ *           uint8  field_name_len
+ *           char   window_name[window_name_len]
+ *           char   field_name[field_name_len]
+ *
+ *   UPDATE  varint time_delta      nanoseconds since the previous update, or since
+ *                                   recording started for the first one
+ *           varint field_id
+ *           uint8  color           named ncurses_cpp_text_colors_e the update asked
+ *                                   for; DEFAULT applies the field's thresholds.
+ *                                   pairs from the color pair cache are process
+ *                                   local, so they are logged as
+ *                                   NCURSES_UPDATE_LOG_PAIR_COLOR followed by
+ *           int16  foreground      the terminal colors of the pair
+ *           int16  background
+ *           value                  STRING: uint8 length followed by that many
+ *                                   bytes; BOOL: 1 byte; INT32, UINT32 and FLOAT:
+ *                                   4 bytes; all other types: 8 bytes. sparkline
+ *                                   samples are FLOAT or DOUBLE values.
+ *
+ * The log grows in whole segments, so a log whose recorder never closed it ends
+ *  in zero bytes, which read as the end of the log.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_UPDATE_LOG_H__
+#define __NCURSES_UPDATE_LOG_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const char NCURSES_UPDATE_LOG_MAGIC[4] = { 'N', 'C', 'R', 'L' };
+const uint32_t NCURSES_UPDATE_LOG_VERSION = 1;
+const size_t NCURSES_UPDATE_LOG_HEADER_LEN = 16;
+
+const uint8_t NCURSES_UPDATE_LOG_END = 0;
+const uint8_t NCURSES_UPDATE_LOG_FIELD = 1;
+const uint8_t NCURSES_UPDATE_LOG_UPDATE = 2;
+
+/* marks an update color given as the terminal colors of a color pair */
+const uint8_t NCURSES_UPDATE_LOG_PAIR_COLOR = UINT8_MAX;
+
+/* window and field names longer than this are truncated in the log */
+const size_t NCURSES_UPDATE_LOG_MAX_NAME_LEN = UINT8_MAX;
+
+/* upper bounds of the encoded records; a varint of n bits takes (n + 6) / 7 bytes */
+const size_t NCURSES_UPDATE_LOG_MAX_FIELD_LEN = 1 + 5 + 3 + 2 * NCURSES_UPDATE_LOG_MAX_NAME_LEN;
+const size_t NCURSES_UPDATE_LOG_MAX_UPDATE_LEN = 1 + 10 + 5 + 1 + 2 * sizeof(int16_t) + 1 + NCURSES_CPP_FIELD_VALUE_STR_CAPACITY;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct ncurses_update_log_field_t
+{
+    std::string                                               window_name;
+    std::string                                               field_name;
+    ncurses_field_type_e                                      field_type;
+};
+
+struct ncurses_update_log_record_t
+{
+    /* nanoseconds since recording started */
+    uint64_t                                                  time_ns;
+    uint32_t                                                  field_id;
+    ncurses_cpp_text_colors_e                                 color;
+
+    /* set for a color pair logged by its terminal colors, in which case color is
+     *  DEFAULT; get_color_pair() turns the colors back into a pair */
+    bool                                                      has_pair_colors;
+    ncurses_color_t                                           foreground;
+    ncurses_color_t                                           background;
+
+    ncurses_field_value_t                                     value;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/* the type of the values logged for a field of the given type */
+ncurses_field_type_e get_update_log_value_type(ncurses_field_type_e field_type);
+
+/* each encode function writes into a buffer with room for the longest encoding and
+ *  returns the number of bytes written */
+size_t encode_update_log_varint(uint64_t value, uint8_t * dst);
+size_t encode_update_log_value(const ncurses_field_value_t& field_val, uint8_t * dst);
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* reads a log from a read-only mapping of the whole file */
+class ncurses_update_log_reader
+{
+public:
+
+    ncurses_update_log_reader(void);
+    virtual ~ncurses_update_log_reader(void);
+
+    /* fails if the file cannot be mapped or does not start with a log header */
+    bool open_log(const std::string& log_path);
+    void close_log(void);
+    bool is_open(void) const { return nullptr != m_data; }
+
+    /* returns the next update, taking in the field definitions on the way; returns
+     *  false at the end of the log or at a record that cannot be decoded, which
+     *  is_corrupt() then reports */
+    bool read_update(ncurses_update_log_record_t& record);
+
+    /* starts reading from the first record again; the fields seen so far are kept */
+    void rewind(void);
+
+    bool is_corrupt(void) const { return m_corrupt; }
+    int64_t get_start_time(void) const { return m_start_time; }
+    size_t get_log_len(void) const { return m_data_len; }
+
+    /* fields are known once their definition has been read; nullptr otherwise */
+    size_t get_field_count(void) const { return m_fields.size(); }
+    const ncurses_update_log_field_t * get_field(uint32_t field_id) const { return field_id < m_fields.size() ? &m_fields[field_id] : nullptr; }
+
+private:
+
+    bool read_varint(uint64_t& value);
+    bool read_field(void);
+    bool read_pair_colors(ncurses_color_t& foreground, ncurses_color_t& background);
+    bool read_value(ncurses_field_type_e value_type, ncurses_field_value_t& field_val);
+
+    const uint8_t *                                           m_data;
+    size_t                                                    m_data_len;
+    size_t                                                    m_offset;
+    uint64_t                                                  m_time_ns;
+    bool                                                      m_corrupt;
+    int64_t                                                   m_start_time;
+    std::vector<ncurses_update_log_field_t>                   m_fields;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_UPDATE_LOG_H__
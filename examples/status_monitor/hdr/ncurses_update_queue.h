@@ -0,0 +1,154 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_queue.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Bounded lock-free queue of field updates.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a bounded, lock-free multi-producer queue that lets any thread post
+ *  field updates for the ncurses user interface thread to apply. The ring uses
+ *  a per-cell sequence number so that producers never take a lock; when the
+ *  ring is full the configured overflow policy decides whether the oldest
+ *  update, the newest update or the producer gives way.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_UPDATE_QUEUE_H__
+#define __NCURSES_UPDATE_QUEUE_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ncurses_colors.h"
+#include "ncurses_field.h"
+#include "ncurses_field_value.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+typedef enum {
+    NCURSES_CPP_OVERFLOW_DROP_OLDEST = 0,
+    NCURSES_CPP_OVERFLOW_DROP_NEWEST,
+    NCURSES_CPP_OVERFLOW_BLOCK
+} ncurses_update_overflow_policy_e;
+
+struct ncurses_field_update_t
+{
+    ncurses_field_base *                                      field;
+    ncurses_cpp_text_colors_e                                 color;
+    ncurses_field_value_t                                     value;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class ncurses_update_queue
+{
+public:
+
+    /* the capacity is rounded up to the next power of two */
+    ncurses_update_queue(size_t capacity, ncurses_update_overflow_policy_e overflow_policy);
+    virtual ~ncurses_update_queue(void);
+
+    size_t get_capacity(void) const { return m_mask + 1; }
+
+    void set_overflow_policy(ncurses_update_overflow_policy_e overflow_policy) { m_overflow_policy.store(overflow_policy); }
+    ncurses_update_overflow_policy_e get_overflow_policy(void) const { return m_overflow_policy.load(); }
+
+    /* may be called from any thread; returns false if the update was dropped */
+    bool post(const ncurses_field_update_t& update);
+
+    /* must only be called from the consuming thread */
+    bool pop(ncurses_field_update_t& update);
+
+    /* releases any producers blocked on a full queue; later posts to a full queue
+     *  are dropped regardless of the overflow policy */
+    void close(void) { m_closed.store(true); }
+
+    uint64_t get_enqueued_count(void) const { return m_enqueued_count.load(std::memory_order_relaxed); }
+    uint64_t get_dropped_count(void) const { return m_dropped_count.load(std::memory_order_relaxed); }
+
+private:
+
+    struct cell_t
+    {
+        std::atomic<size_t>                                   sequence;
+        ncurses_field_update_t                                update;
+    };
+
+    bool try_push(const ncurses_field_update_t& update);
+    bool try_pop(ncurses_field_update_t& update);
+
+    std::unique_ptr<cell_t[]>                                 m_cells;
+    size_t                                                    m_mask;
+
+    /* keep the producer and consumer positions on separate cache lines */
+    char                                                      m_pad0[64];
+    std::atomic<size_t>                                       m_enqueue_pos;
+    char                                                      m_pad1[64];
+    std::atomic<size_t>                                       m_dequeue_pos;
+    char                                                      m_pad2[64];
+
+    std::atomic<ncurses_update_overflow_policy_e>             m_overflow_policy;
+    std::atomic<bool>                                         m_closed;
+    std::atomic<uint64_t>                                     m_enqueued_count;
+    std::atomic<uint64_t>                                     m_dropped_count;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_UPDATE_QUEUE_H__
@@ -0,0 +1,198 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_recorder.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Records field updates into an append-only binary log.
+ *
+ * @section  DESCRIPTION
+ *
+ * Records field updates, with the time each one was made, into the log format
+ *  described in ncurses_update_log.h. Records are encoded on the recording
+ *  thread into a fixed pool of buffer chunks; a writer thread copies every
+ *  full chunk into the log file, which it maps and grows one segment at a
+ *  time. Recording an update never allocates and only takes a lock when a
+ *  chunk fills up. Once every chunk is waiting for the writer, further updates
+ *  are dropped and counted rather than holding up the user interface; field
+ *  definitions wait for a free chunk instead, because the updates after them
+ *  cannot be read without them. Data handed to the writer survives the process
+ *  crashing, but not the machine.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __NCURSES_UPDATE_RECORDER_H__
+#define __NCURSES_UPDATE_RECORDER_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ncurses_colors.h"
+#include "ncurses_field_value.h"
+#include "ncurses_string_ref.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* the log file grows by this much at a time; a multiple of the page size */
+const size_t NCURSES_UPDATE_RECORDER_SEGMENT_LEN = 16 * 1024 * 1024;
+
+/* records are buffered in this many chunks of this size */
+const size_t NCURSES_UPDATE_RECORDER_CHUNK_LEN = 64 * 1024;
+const size_t NCURSES_UPDATE_RECORDER_CHUNK_COUNT = 64;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct ncurses_update_recorder_stats_t
+{
+    uint64_t                                                  field_count;
+    uint64_t                                                  update_count;
+    uint64_t                                                  dropped_update_count;
+
+    /* colors that were neither named nor a known pair, logged as DEFAULT */
+    uint64_t                                                  unmapped_color_count;
+
+    /* bytes in the log file, including the header */
+    uint64_t                                                  bytes_written;
+    bool                                                      write_failed;
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+/* every method must be called from the recording thread; the writer thread is
+ *  internal */
+class ncurses_update_recorder
+{
+public:
+
+    ncurses_update_recorder(void);
+    virtual ~ncurses_update_recorder(void);
+
+    /* creates the log, replacing any existing file, and starts the writer */
+    bool open_log(const std::string& log_path);
+
+    /* hands the buffered records to the writer, waits for it to write them and
+     *  trims the log to its length */
+    void close_log(void);
+    bool is_open(void) const { return m_fd >= 0; }
+
+    /* returns the id to record the field's updates under */
+    uint32_t add_field(ncurses_string_ref window_name, ncurses_string_ref field_name, ncurses_field_type_e field_type);
+
+    void record_update(uint32_t field_id, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color);
+
+    /* hands the records buffered so far to the writer, e.g. once per frame, so that
+     *  the log does not lag behind when updates are rare */
+    void flush(void);
+
+    ncurses_update_recorder_stats_t get_stats(void) const;
+
+private:
+
+    static const size_t NO_CHUNK = SIZE_MAX;
+
+    struct chunk_t
+    {
+        std::unique_ptr<uint8_t[]>                            data;
+        size_t                                                len;
+    };
+
+    /* makes room for a record of the given length in the current chunk; fails if
+     *  every chunk is waiting for the writer and wait_for_chunk is false */
+    bool reserve(size_t record_len, bool wait_for_chunk);
+    size_t encode_color(ncurses_cpp_text_colors_e field_color, uint8_t * dst);
+    void hand_over_chunk(void);
+
+    void run_writer(void);
+    bool write_to_log(const uint8_t * data, size_t data_len);
+    bool map_next_segment(void);
+
+    int                                                       m_fd;
+    std::chrono::steady_clock::time_point                     m_start_time;
+    uint64_t                                                  m_last_update_ns;
+    uint32_t                                                  m_field_count;
+    uint64_t                                                  m_update_count;
+    uint64_t                                                  m_dropped_update_count;
+    uint64_t                                                  m_unmapped_color_count;
+
+    /* owned by the recording thread until it is handed over */
+    std::vector<chunk_t>                                      m_chunks;
+    size_t                                                    m_current_chunk;
+
+    /* guarded by m_mutex; the full chunks are a ring in the order they were filled */
+    mutable std::mutex                                        m_mutex;
+    std::condition_variable                                   m_chunk_full;
+    std::condition_variable                                   m_chunk_free;
+    std::vector<size_t>                                       m_free_chunks;
+    std::vector<size_t>                                       m_full_chunks;
+    size_t                                                    m_full_head;
+    size_t                                                    m_full_count;
+    bool                                                      m_stopping;
+    uint64_t                                                  m_bytes_written;
+    bool                                                      m_write_failed;
+
+    /* owned by the writer thread while it runs */
+    std::thread                                               m_writer;
+    uint8_t *                                                 m_segment;
+    size_t                                                    m_segment_idx;
+    size_t                                                    m_segment_used;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __NCURSES_UPDATE_RECORDER_H__
@@ -48,14 +48,16 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
-#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
-#include <ncurses.h>
-
+#include "ncurses_backend.h"
 #include "ncurses_colors.h"
 #include "ncurses_field.h"
+#include "ncurses_field_table.h"
+#include "ncurses_sparkline_field.h"
+#include "ncurses_string_ref.h"
 
 namespace ncurses_cpp {
 
@@ -67,6 +69,24 @@ namespace ncurses_cpp {
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
 
+/* one coordinate or size of a window as a share of the screen plus a number of
+ *  cells; e.g. { 1.0, -8 } is 8 cells short of the bottom or right edge and
+ *  { 0.0, 20 } is a fixed 20 cells */
+struct ncurses_window_extent_t
+{
+    float                                                     fraction;
+    int32_t                                                   offset;
+};
+
+/* window geometry that follows the screen size */
+struct ncurses_window_geometry_t
+{
+    ncurses_window_extent_t                                   height;
+    ncurses_window_extent_t                                   width;
+    ncurses_window_extent_t                                   row;
+    ncurses_window_extent_t                                   column;
+};
+
 /******************************************************************************
  *                                  MACROS
  *****************************************************************************/
@@ -75,6 +95,15 @@ namespace ncurses_cpp {
  *                           FUNCTION DECLARATION
  *****************************************************************************/
 
+bool operator==(const ncurses_window_extent_t& lhs, const ncurses_window_extent_t& rhs);
+bool operator!=(const ncurses_window_extent_t& lhs, const ncurses_window_extent_t& rhs);
+bool operator==(const ncurses_window_geometry_t& lhs, const ncurses_window_geometry_t& rhs);
+bool operator!=(const ncurses_window_geometry_t& lhs, const ncurses_window_geometry_t& rhs);
+
+/* resolves the geometry for a screen; windows that would extend past the screen
+ *  are cut off at its edges. returns false if nothing of the window is left. */
+bool resolve_window_geometry(const ncurses_window_geometry_t& geometry, uint32_t screen_rows, uint32_t screen_cols, uint32_t& height, uint32_t& width, uint32_t& row, uint32_t& column);
+
 /******************************************************************************
  *                            CLASS DECLARATION
  *****************************************************************************/
@@ -84,7 +113,7 @@ class ncurses_window
 public:
 
     static const std::vector<std::string> RESERVED_FIELD_NAMES;
-    static bool is_reserved_field(std::string field_name);
+    static bool is_reserved_field(ncurses_string_ref field_name);
 
     typedef enum {
         LEFT = 0,
@@ -104,49 +133,143 @@ public:
 
     std::string get_window_name(void) const { return m_window_name; }
 
-    bool create_window(uint32_t height, uint32_t width, uint32_t start_x, uint32_t start_y);
+    virtual bool create_window(uint32_t height, uint32_t width, uint32_t start_x, uint32_t start_y);
+
+    /* creates the window on the current screen; relayout() moves and resizes it when
+     *  the screen size changes */
+    bool create_window(const ncurses_window_geometry_t& geometry);
     bool cleanup_window(void);
 
+    /* recreates a window created from a geometry if its position or size on a screen
+     *  of the given size differs, redrawing the outline and every field from the
+     *  field's current value; a window that no longer fits is hidden until it fits
+     *  again. the changes are left for the next frame. returns true if the window was
+     *  recreated or hidden; windows with a fixed position are never moved. */
+    bool relayout(uint32_t screen_rows, uint32_t screen_cols);
+    bool has_geometry(void) const { return m_has_geometry; }
+    const ncurses_window_geometry_t& get_geometry(void) const { return m_geometry; }
+
+    void set_frame_commit_mode(bool enabled) { m_refresh_state.frame_commit_mode = enabled; }
+    bool get_frame_commit_mode(void) const { return m_refresh_state.frame_commit_mode; }
+
+    /* copies any pending window changes to the virtual screen without flushing the
+     *  terminal; returns true if the window had changes to stage */
+    bool stage_frame(void);
+
+    /* marks the whole window as changed so that the next refresh or frame redraws it,
+     *  e.g. after another window that covered it was removed */
+    void touch_window(void);
+
+    /* returns the number of field refreshes deferred since the previous call */
+    uint64_t collect_deferred_refreshes(void);
+
+    /* when a renderer limits the bytes sent per frame, higher priority windows are
+     *  drawn first and the lowest priority ones are deferred to a later frame */
+    void set_render_priority(int32_t priority);
+    int32_t get_render_priority(void) const { return m_render_priority; }
+
     bool clear_window(void);
     bool clear_window(char clear_char);
 
     bool add_title(std::string title_str);
     bool add_title(std::string title_str, vertical_alignment_e vert_alignment, horizontal_alignment_e horiz_alignment, ncurses_cpp_text_colors_e title_color);
 
+    /* the returned handle is valid (and evaluates to true) if the field was added and
+     *  drawn; it can be kept to update the field without any name lookups */
+    template <typename T>
+    ncurses_field_handle<T> add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val);
+
+    template <typename T>
+    ncurses_field_handle<T> add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color);
+
+    template <typename T>
+    ncurses_field_handle<T> get_field_handle(ncurses_string_ref field_name);
+
+    template <typename T>
+    bool add_field_thresholds(ncurses_string_ref field_name, std::pair<T, T> field_threshold_vals, ncurses_cpp_text_colors_e field_color);
+
     template <typename T>
-    bool add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val);
+    bool set_field_thresholds(ncurses_string_ref field_name, const std::vector<typename ncurses_field<T>::threshold_band_t>& field_thresholds);
 
     template <typename T>
-    bool add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color);
+    bool update_field(ncurses_string_ref field_name, const T& field_val);
 
     template <typename T>
-    bool add_field_thresholds(std::string field_name, std::pair<T, T> field_threshold_vals, ncurses_cpp_text_colors_e field_color);
+    bool update_field(ncurses_string_ref field_name, const T& field_val, ncurses_cpp_text_colors_e field_color);
 
+    /* sparklines chart the last history_len samples of a float or double metric in
+     *  width columns starting at (x, y) */
     template <typename T>
-    bool update_field(std::string field_name, T field_val);
+    ncurses_sparkline_handle<T> add_sparkline(uint32_t x, uint32_t y, std::string field_name, uint32_t width, size_t history_len);
 
     template <typename T>
-    bool update_field(std::string field_name, T field_val, ncurses_cpp_text_colors_e field_color);
+    ncurses_sparkline_handle<T> add_sparkline(uint32_t x, uint32_t y, std::string field_name, uint32_t width, size_t history_len, ncurses_cpp_text_colors_e default_color);
+
+    template <typename T>
+    ncurses_sparkline_handle<T> get_sparkline_handle(ncurses_string_ref field_name);
+
+    /* untyped lookup for update paths that carry the type with the value, e.g. the
+     *  update socket; does not allocate */
+    ncurses_field_base * find_field_base(const char * field_name, size_t field_name_len) const { return m_fields.find(field_name, field_name_len); }
+
+    /* every field in the window, including the reserved ones such as the title */
+    size_t get_field_count(void) const { return m_fields.size(); }
+    ncurses_field_base * get_field(size_t field_idx) const { return m_fields.get_field(field_idx); }
+    const std::string& get_field_name(size_t field_idx) const { return m_fields.get_field_name(field_idx); }
+
+    /* records the updates of every field, including the ones added later, under the
+     *  window's name; nullptr stops recording */
+    void set_update_recorder(ncurses_update_recorder * update_recorder);
+
+protected:
+
+    /* window subtypes that draw their own contents use these */
+    ncurses_backend_window * get_backend_window(void) const { return m_window.get(); }
+    uint32_t get_height(void) const { return m_height; }
+    uint32_t get_width(void) const { return m_width; }
+    bool get_outline_window(void) const { return m_outline_window; }
+
+    /* redraws everything inside the outline after relayout() gave the window a new
+     *  backend window; subtypes that draw their own contents extend this */
+    virtual void redraw_contents(void);
+
+    /* called by cleanup_window() once the fields are gone; subtypes that keep
+     *  handles to their fields drop them here */
+    virtual void handle_fields_cleared(void) { }
+
+    /* refreshes the window now or, in frame commit mode, leaves it for the next frame */
+    void refresh_window(void);
 
 private:
 
     template <typename T>
-    bool _add_field(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color);
+    ncurses_field_handle<T> _add_field(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color);
+
+    /* returns nullptr if there is no field with the name or it has a different type */
+    template <typename T>
+    ncurses_field<T> * find_field(ncurses_string_ref field_name);
+
+    template <typename T>
+    ncurses_sparkline_field<T> * find_sparkline(ncurses_string_ref field_name);
 
     bool valid_field_coords(uint32_t x, uint32_t y);
-    bool field_name_in_use(std::string field_name);
+    bool field_name_in_use(ncurses_string_ref field_name);
+    void register_recorded_field(size_t field_idx);
 
     std::string                                               m_window_name;
 
-    WINDOW *                                                  m_window;
+    std::unique_ptr<ncurses_backend_window>                   m_window;
     uint32_t                                                  m_height;
     uint32_t                                                  m_width;
+    uint32_t                                                  m_row;
+    uint32_t                                                  m_column;
+    bool                                                      m_has_geometry;
+    ncurses_window_geometry_t                                 m_geometry;
     bool                                                      m_outline_window;
-    std::map<std::string, ncurses_field<std::string>>         m_str_fields;
-    std::map<std::string, ncurses_field<int32_t>>             m_int32_fields;
-    std::map<std::string, ncurses_field<uint32_t>>            m_uint32_fields;
-    std::map<std::string, ncurses_field<float>>               m_float_fields;
-    std::map<std::string, ncurses_field<double>>              m_double_fields;
+    int32_t                                                   m_render_priority;
+    ncurses_refresh_state_t                                   m_refresh_state;
+    ncurses_field_table                                       m_fields;
+    ncurses_update_recorder *                                 m_update_recorder;
 };
 
 
@@ -158,23 +281,175 @@ private:
  *  helps the linker resolve the template versions */
 
 template <typename T>
-bool ncurses_window::add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val)
+ncurses_field_handle<T> ncurses_window::add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val)
 {
-    return add_field<T>(x, y, field_name, format_str, default_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
+    return add_field<T>(x, y, std::move(field_name), std::move(format_str), default_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
 }
 
 template <typename T>
-bool ncurses_window::add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color)
+ncurses_field_handle<T> ncurses_window::add_field(uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color)
 {
-    return _add_field<T>(false, x, y, field_name, format_str, default_val, default_color);
+    return _add_field<T>(false, x, y, std::move(field_name), std::move(format_str), default_val, default_color);
 }
 
 template <typename T>
-bool ncurses_window::update_field(std::string field_name, T field_val)
+bool ncurses_window::update_field(ncurses_string_ref field_name, const T& field_val)
 {
     return update_field<T>(field_name, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
 }
 
+template <typename T>
+bool ncurses_window::update_field(ncurses_string_ref field_name, const T& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    ncurses_field<T> * field = find_field<T>(field_name);
+    if (nullptr != m_window &&
+        nullptr != field)
+    {
+        ret = field->update_field(field_val, field_color);
+    }
+
+    return ret;
+}
+
+template <typename T>
+ncurses_field_handle<T> ncurses_window::get_field_handle(ncurses_string_ref field_name)
+{
+    return ncurses_field_handle<T>(find_field<T>(field_name));
+}
+
+template <typename T>
+bool ncurses_window::add_field_thresholds(ncurses_string_ref field_name, std::pair<T, T> field_threshold_vals, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    ncurses_field<T> * field = find_field<T>(field_name);
+    if (nullptr != field)
+    {
+        ret = field->add_field_thresholds(field_threshold_vals, field_color);
+    }
+
+    return ret;
+}
+
+template <typename T>
+bool ncurses_window::set_field_thresholds(ncurses_string_ref field_name, const std::vector<typename ncurses_field<T>::threshold_band_t>& field_thresholds)
+{
+    bool ret = false;
+
+    ncurses_field<T> * field = find_field<T>(field_name);
+    if (nullptr != field)
+    {
+        ret = field->set_field_thresholds(field_thresholds);
+    }
+
+    return ret;
+}
+
+template <typename T>
+ncurses_field_handle<T> ncurses_window::_add_field(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color)
+{
+    ncurses_field_handle<T> ret;
+
+    if ( (!is_reserved_field(field_name) || allow_reserved_fields) &&
+         valid_field_coords(x, y) &&
+         !field_name_in_use(field_name) )
+    {
+        /* the field is only stored if its format compiles for the field type */
+        std::unique_ptr<ncurses_field<T>> new_field(new ncurses_field<T>());
+        if (new_field->create_field(m_window.get(), x, y, format_str, default_val, default_color))
+        {
+            ncurses_field<T> * field = new_field.get();
+            field->set_refresh_state(&m_refresh_state);
+            m_fields.insert(std::move(field_name), std::move(new_field));
+
+            if (field->update_field(default_val))
+            {
+                ret = ncurses_field_handle<T>(field);
+            }
+
+            if (nullptr != m_update_recorder)
+            {
+                register_recorded_field(m_fields.size() - 1);
+            }
+        }
+    }
+
+    return ret;
+}
+
+template <typename T>
+ncurses_field<T> * ncurses_window::find_field(ncurses_string_ref field_name)
+{
+    ncurses_field_base * field = m_fields.find(field_name.data(), field_name.size());
+    if (nullptr != field &&
+        ncurses_field_value_traits<T>::type == field->get_field_type())
+    {
+        return static_cast<ncurses_field<T> *>(field);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template <typename T>
+ncurses_sparkline_handle<T> ncurses_window::add_sparkline(uint32_t x, uint32_t y, std::string field_name, uint32_t width, size_t history_len)
+{
+    return add_sparkline<T>(x, y, std::move(field_name), width, history_len, NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+template <typename T>
+ncurses_sparkline_handle<T> ncurses_window::add_sparkline(uint32_t x, uint32_t y, std::string field_name, uint32_t width, size_t history_len, ncurses_cpp_text_colors_e default_color)
+{
+    ncurses_sparkline_handle<T> ret;
+
+    if (!is_reserved_field(field_name) &&
+        width > 0 &&
+        valid_field_coords(x + width - 1, y) &&
+        !field_name_in_use(field_name))
+    {
+        std::unique_ptr<ncurses_sparkline_field<T>> new_field(new ncurses_sparkline_field<T>());
+        ncurses_sparkline_field<T> * field = new_field.get();
+        field->set_refresh_state(&m_refresh_state);
+
+        if (field->create_field(m_window.get(), x, y, width, history_len, default_color))
+        {
+            m_fields.insert(std::move(field_name), std::move(new_field));
+            ret = ncurses_sparkline_handle<T>(field);
+
+            if (nullptr != m_update_recorder)
+            {
+                register_recorded_field(m_fields.size() - 1);
+            }
+        }
+    }
+
+    return ret;
+}
+
+template <typename T>
+ncurses_sparkline_handle<T> ncurses_window::get_sparkline_handle(ncurses_string_ref field_name)
+{
+    return ncurses_sparkline_handle<T>(find_sparkline<T>(field_name));
+}
+
+template <typename T>
+ncurses_sparkline_field<T> * ncurses_window::find_sparkline(ncurses_string_ref field_name)
+{
+    ncurses_field_base * field = m_fields.find(field_name.data(), field_name.size());
+    if (nullptr != field &&
+        ncurses_sparkline_field<T>::get_series_type() == field->get_field_type())
+    {
+        return static_cast<ncurses_sparkline_field<T> *>(field);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 }; /* end of the ncurses_cpp namespace */
 
 #endif // __NCURSES_WINDOW_H__
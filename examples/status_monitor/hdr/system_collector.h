@@ -0,0 +1,200 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     system_collector.h
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Low-overhead collector for system statistics from /proc.
+ *
+ * @section  DESCRIPTION
+ *
+ * Defines a collector that samples per-CPU utilization, memory use, the load
+ *  average and per-interface network and per-disk I/O rates. The /proc files
+ *  are opened once and re-read with pread() into buffers that are allocated
+ *  when they are opened; the text is parsed in place into fixed-size arrays, so
+ *  taking a sample never allocates and is cheap enough to run at 10 Hz on small
+ *  ARM boards.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+#ifndef __SYSTEM_COLLECTOR_H__
+#define __SYSTEM_COLLECTOR_H__
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* anything past these limits is left out of the snapshot */
+const uint32_t SYSTEM_COLLECTOR_MAX_CPUS = 256;
+const uint32_t SYSTEM_COLLECTOR_MAX_INTERFACES = 16;
+const uint32_t SYSTEM_COLLECTOR_MAX_DISKS = 16;
+
+/* longer interface and disk names are truncated */
+const size_t SYSTEM_COLLECTOR_NAME_CAPACITY = 31;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct system_interface_stats_t
+{
+    char                                                      name[SYSTEM_COLLECTOR_NAME_CAPACITY + 1];
+    uint64_t                                                  rx_bytes;
+    uint64_t                                                  tx_bytes;
+    double                                                    rx_bytes_per_sec;
+    double                                                    tx_bytes_per_sec;
+};
+
+struct system_disk_stats_t
+{
+    char                                                      name[SYSTEM_COLLECTOR_NAME_CAPACITY + 1];
+    uint64_t                                                  read_bytes;
+    uint64_t                                                  write_bytes;
+    uint64_t                                                  io_time_ms;
+    double                                                    read_bytes_per_sec;
+    double                                                    write_bytes_per_sec;
+    float                                                     busy_pct;
+};
+
+/* rates and utilizations cover the time since the previous sample and are zero
+ *  after the first one */
+struct system_snapshot_t
+{
+    /* the utilization of all CPUs together, then of each CPU */
+    float                                                     cpu_pct;
+    uint32_t                                                  num_cpus;
+    float                                                     per_cpu_pct[SYSTEM_COLLECTOR_MAX_CPUS];
+
+    uint64_t                                                  mem_total_kb;
+    uint64_t                                                  mem_available_kb;
+    uint64_t                                                  swap_total_kb;
+    uint64_t                                                  swap_free_kb;
+    float                                                     mem_used_pct;
+    float                                                     swap_used_pct;
+
+    float                                                     load_avg[3];
+
+    uint32_t                                                  num_interfaces;
+    system_interface_stats_t                                  interfaces[SYSTEM_COLLECTOR_MAX_INTERFACES];
+
+    uint32_t                                                  num_disks;
+    system_disk_stats_t                                       disks[SYSTEM_COLLECTOR_MAX_DISKS];
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION DECLARATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                            CLASS DECLARATION
+ *****************************************************************************/
+
+class system_collector
+{
+public:
+
+    system_collector(void);
+    virtual ~system_collector(void);
+
+    /* opens the /proc files and allocates the read buffers; returns false if none of
+     *  the files could be opened. sources that are missing are left out of the
+     *  snapshot. */
+    bool open_sources(void);
+    void close_sources(void);
+
+    /* re-reads every open source and updates the snapshot; never allocates */
+    bool sample(void);
+
+    const system_snapshot_t& get_snapshot(void) const { return m_snapshot; }
+    uint64_t get_sample_count(void) const { return m_sample_count; }
+
+private:
+
+    typedef enum {
+        SOURCE_STAT = 0,
+        SOURCE_MEMINFO,
+        SOURCE_LOADAVG,
+        SOURCE_NET_DEV,
+        SOURCE_DISKSTATS,
+        NUM_SOURCES
+    } source_e;
+
+    struct cpu_counters_t
+    {
+        uint64_t                                              busy;
+        uint64_t                                              total;
+    };
+
+    /* reads the whole file into its buffer; returns the end of the text or nullptr */
+    const char * read_source(source_e source);
+
+    void parse_stat(const char * text, const char * end);
+    void parse_meminfo(const char * text, const char * end);
+    void parse_loadavg(const char * text, const char * end);
+    void parse_net_dev(const char * text, const char * end, double elapsed_sec);
+    void parse_diskstats(const char * text, const char * end, double elapsed_sec);
+
+    int                                                       m_fds[NUM_SOURCES];
+    std::vector<char>                                         m_buffers[NUM_SOURCES];
+
+    /* cumulative CPU counters from the previous sample: all CPUs, then each CPU */
+    cpu_counters_t                                            m_prev_cpu[SYSTEM_COLLECTOR_MAX_CPUS + 1];
+
+    /* the previous interface and disk entries, to match up by name */
+    system_interface_stats_t                                  m_prev_interfaces[SYSTEM_COLLECTOR_MAX_INTERFACES];
+    uint32_t                                                  m_prev_num_interfaces;
+    system_disk_stats_t                                       m_prev_disks[SYSTEM_COLLECTOR_MAX_DISKS];
+    uint32_t                                                  m_prev_num_disks;
+
+    std::chrono::steady_clock::time_point                     m_prev_sample_time;
+    uint64_t                                                  m_sample_count;
+    system_snapshot_t                                         m_snapshot;
+};
+
+}; /* end of the ncurses_cpp namespace */
+
+#endif // __SYSTEM_COLLECTOR_H__
@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_color_gradient.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Maps a numeric value onto a range of colors.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the ncurses_color_gradient class. See the header for details.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "ncurses_color_gradient.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static uint8_t blend_level(uint8_t from, uint8_t to, double fraction)
+{
+    return static_cast<uint8_t>(std::lround(from + (static_cast<double>(to) - from) * fraction));
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_color_gradient::ncurses_color_gradient(void)
+  : m_min_value(0.0),
+    m_steps_per_unit(0.0),
+    m_last_step(0.0)
+{ }
+
+ncurses_color_gradient::~ncurses_color_gradient(void)
+{
+    release_pairs();
+}
+
+bool ncurses_color_gradient::create_gradient(double min_value, double max_value, const std::vector<ncurses_color_t>& stops, ncurses_color_t background)
+{
+    return create_gradient(min_value, max_value, stops, background, NCURSES_CPP_GRADIENT_DEFAULT_STEPS);
+}
+
+bool ncurses_color_gradient::create_gradient(double min_value, double max_value, const std::vector<ncurses_color_t>& stops, ncurses_color_t background, size_t num_steps)
+{
+    bool ret = false;
+
+    /* also rejects NaN limits */
+    if (!(max_value > min_value) ||
+        stops.empty() ||
+        0 == num_steps)
+    {
+        return ret;
+    }
+
+    std::vector<uint8_t> stop_rgb(stops.size() * 3, 0);
+    for (size_t stop = 0; stop < stops.size(); ++stop)
+    {
+        if (!get_color_rgb(stops[stop], stop_rgb[stop * 3], stop_rgb[stop * 3 + 1], stop_rgb[stop * 3 + 2]))
+        {
+            return ret;
+        }
+    }
+
+    release_pairs();
+
+    ncurses_color_pair_cache& pair_cache = get_color_pair_cache();
+    for (size_t step = 0; step < num_steps; ++step)
+    {
+        /* the center of the step, measured in stop intervals */
+        double position = 1 == num_steps ? 0.0 : static_cast<double>(step) * (stops.size() - 1) / (num_steps - 1);
+        size_t from = std::min(static_cast<size_t>(position), stops.size() - 1);
+        size_t to = std::min(from + 1, stops.size() - 1);
+        double fraction = position - from;
+
+        ncurses_color_t step_color = ncurses_rgb(blend_level(stop_rgb[from * 3], stop_rgb[to * 3], fraction),
+                                                 blend_level(stop_rgb[from * 3 + 1], stop_rgb[to * 3 + 1], fraction),
+                                                 blend_level(stop_rgb[from * 3 + 2], stop_rgb[to * 3 + 2], fraction));
+        m_step_colors.push_back(pair_cache.pin_pair(step_color, background));
+    }
+
+    m_min_value = min_value;
+    m_steps_per_unit = num_steps / (max_value - min_value);
+    m_last_step = static_cast<double>(num_steps - 1);
+    ret = true;
+
+    return ret;
+}
+
+void ncurses_color_gradient::release_pairs(void)
+{
+    ncurses_color_pair_cache& pair_cache = get_color_pair_cache();
+    for (auto iter = m_step_colors.begin(); iter != m_step_colors.end(); ++iter)
+    {
+        pair_cache.unpin_pair(*iter);
+    }
+    m_step_colors.clear();
+}
+
+} /* end ncurses_cpp namespace */
@@ -45,6 +45,10 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
 #include <ncurses.h>
 
 #include "ncurses_colors.h"
@@ -56,6 +60,18 @@ namespace ncurses_cpp {
  *                                 CONSTANTS
  *****************************************************************************/
 
+/* the first 16 colors of the xterm palette; the rest are a 6x6x6 cube and a gray ramp */
+const uint8_t XTERM_BASE_COLORS[16][3] = {
+    {   0,   0,   0 }, { 205,   0,   0 }, {   0, 205,   0 }, { 205, 205,   0 },
+    {   0,   0, 238 }, { 205,   0, 205 }, {   0, 205, 205 }, { 229, 229, 229 },
+    { 127, 127, 127 }, { 255,   0,   0 }, {   0, 255,   0 }, { 255, 255,   0 },
+    {  92,  92, 255 }, { 255,   0, 255 }, {   0, 255, 255 }, { 255, 255, 255 }
+};
+const uint8_t XTERM_CUBE_LEVELS[6] = { 0, 95, 135, 175, 215, 255 };
+const int XTERM_CUBE_START = 16;
+const int XTERM_GRAY_START = 232;
+const int XTERM_PALETTE_SIZE = 256;
+
 /******************************************************************************
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
@@ -68,6 +84,119 @@ namespace ncurses_cpp {
  *                           FUNCTION IMPLEMENTATION
  *****************************************************************************/
 
+static int get_squared_distance(const uint8_t rgb[3], uint8_t red, uint8_t green, uint8_t blue)
+{
+    int red_diff = static_cast<int>(rgb[0]) - red;
+    int green_diff = static_cast<int>(rgb[1]) - green;
+    int blue_diff = static_cast<int>(rgb[2]) - blue;
+    return red_diff * red_diff + green_diff * green_diff + blue_diff * blue_diff;
+}
+
+static int get_nearest_base_color(uint8_t red, uint8_t green, uint8_t blue, int num_base_colors)
+{
+    int ret = 0;
+    int best_distance = get_squared_distance(XTERM_BASE_COLORS[0], red, green, blue);
+
+    for (int color = 1; color < num_base_colors; ++color)
+    {
+        int distance = get_squared_distance(XTERM_BASE_COLORS[color], red, green, blue);
+        if (distance < best_distance)
+        {
+            best_distance = distance;
+            ret = color;
+        }
+    }
+
+    return ret;
+}
+
+static int get_nearest_cube_level(uint8_t level)
+{
+    int ret = 0;
+    for (int idx = 1; idx < 6; ++idx)
+    {
+        if (std::abs(static_cast<int>(XTERM_CUBE_LEVELS[idx]) - level) < std::abs(static_cast<int>(XTERM_CUBE_LEVELS[ret]) - level))
+        {
+            ret = idx;
+        }
+    }
+
+    return ret;
+}
+
+/* the nearest entry of the 6x6x6 cube or of the gray ramp */
+static int get_nearest_256_color(uint8_t red, uint8_t green, uint8_t blue)
+{
+    int red_idx = get_nearest_cube_level(red);
+    int green_idx = get_nearest_cube_level(green);
+    int blue_idx = get_nearest_cube_level(blue);
+    uint8_t cube_rgb[3] = { XTERM_CUBE_LEVELS[red_idx], XTERM_CUBE_LEVELS[green_idx], XTERM_CUBE_LEVELS[blue_idx] };
+
+    int gray_idx = std::min(23, std::max(0, ((red + green + blue) / 3 - 3) / 10));
+    uint8_t gray_level = static_cast<uint8_t>(8 + gray_idx * 10);
+    uint8_t gray_rgb[3] = { gray_level, gray_level, gray_level };
+
+    if (get_squared_distance(gray_rgb, red, green, blue) < get_squared_distance(cube_rgb, red, green, blue))
+    {
+        return XTERM_GRAY_START + gray_idx;
+    }
+    else
+    {
+        return XTERM_CUBE_START + red_idx * 36 + green_idx * 6 + blue_idx;
+    }
+}
+
+bool get_color_rgb(ncurses_color_t color, uint8_t& red, uint8_t& green, uint8_t& blue)
+{
+    bool ret = true;
+
+    if (0 != (color & NCURSES_CPP_COLOR_RGB_FLAG))
+    {
+        red = static_cast<uint8_t>(color >> 16);
+        green = static_cast<uint8_t>(color >> 8);
+        blue = static_cast<uint8_t>(color);
+    }
+    else if (color >= 0 &&
+             color < XTERM_CUBE_START)
+    {
+        red = XTERM_BASE_COLORS[color][0];
+        green = XTERM_BASE_COLORS[color][1];
+        blue = XTERM_BASE_COLORS[color][2];
+    }
+    else if (color >= XTERM_CUBE_START &&
+             color < XTERM_GRAY_START)
+    {
+        int cube_idx = color - XTERM_CUBE_START;
+        red = XTERM_CUBE_LEVELS[cube_idx / 36];
+        green = XTERM_CUBE_LEVELS[(cube_idx / 6) % 6];
+        blue = XTERM_CUBE_LEVELS[cube_idx % 6];
+    }
+    else if (color >= XTERM_GRAY_START &&
+             color < XTERM_PALETTE_SIZE)
+    {
+        red = static_cast<uint8_t>(8 + (color - XTERM_GRAY_START) * 10);
+        green = red;
+        blue = red;
+    }
+    else
+    {
+        ret = false;
+    }
+
+    return ret;
+}
+
+ncurses_color_pair_cache& get_color_pair_cache(void)
+{
+    static ncurses_color_pair_cache s_color_pair_cache;
+    return s_color_pair_cache;
+}
+
+ncurses_cpp_text_colors_e get_color_pair(ncurses_color_t foreground, ncurses_color_t background)
+{
+    return get_color_pair_cache().pin_pair(foreground, background);
+}
+
 bool init_colors(int text_background_color)
 {
     static bool init_complete = false;
@@ -75,18 +204,21 @@ bool init_colors(int text_background_color)
     if (!init_complete)
     {
         printf("Configuring ncurses_cpp colors\n");
-        start_color();
-        init_pair(NCURSES_CPP_TXT_COLOR_BLACK,    COLOR_BLACK,    text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_RED,      COLOR_RED,      text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_GREEN,    COLOR_GREEN,    text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_YELLOW,   COLOR_YELLOW,   text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_BLUE,     COLOR_BLUE,     text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_MAGENTA,  COLOR_MAGENTA,  text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_CYAN,     COLOR_CYAN,     text_background_color);
-        init_pair(NCURSES_CPP_TXT_COLOR_WHITE,    COLOR_WHITE,    text_background_color);
         init_complete = true;
     }
 
+    /* every screen has its own pairs, so they are set up each time one is opened */
+    start_color();
+    init_pair(NCURSES_CPP_TXT_COLOR_BLACK,    COLOR_BLACK,    text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_RED,      COLOR_RED,      text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_GREEN,    COLOR_GREEN,    text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_YELLOW,   COLOR_YELLOW,   text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_BLUE,     COLOR_BLUE,     text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_MAGENTA,  COLOR_MAGENTA,  text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_CYAN,     COLOR_CYAN,     text_background_color);
+    init_pair(NCURSES_CPP_TXT_COLOR_WHITE,    COLOR_WHITE,    text_background_color);
+    get_color_pair_cache().attach_screen(COLOR_PAIRS, COLORS, text_background_color);
+
     return init_complete;
 }
 
@@ -100,4 +232,365 @@ bool init_colors(void)
  *                           CLASS IMPLEMENTATION
  *****************************************************************************/
 
+const int ncurses_color_pair_cache::MAX_PAIRS;
+
+ncurses_color_pair_cache::ncurses_color_pair_cache(void)
+  : m_screen_attached(false),
+    m_default_colors_enabled(false),
+    m_max_pair(MAX_PAIRS - 1),
+    m_num_colors(XTERM_PALETTE_SIZE),
+    m_named_background(COLOR_BLACK),
+    m_pairs_by_key(NUM_RESOLVED_COLORS * NUM_RESOLVED_COLORS, 0),
+    m_slots(MAX_PAIRS),
+    m_lru_head(-1),
+    m_lru_tail(-1)
+{
+    m_stats = ncurses_color_pair_stats_t();
+
+    for (int pair = 0; pair < MAX_PAIRS; ++pair)
+    {
+        slot_t& slot = m_slots[pair];
+        slot.foreground = NCURSES_CPP_COLOR_DEFAULT;
+        slot.background = NCURSES_CPP_COLOR_DEFAULT;
+        slot.in_use = false;
+        slot.pin_count = 0;
+        slot.prev = -1;
+        slot.next = -1;
+    }
+
+    attach_screen(MAX_PAIRS, XTERM_PALETTE_SIZE, COLOR_BLACK);
+    m_screen_attached = false;
+}
+
+ncurses_color_pair_cache::~ncurses_color_pair_cache(void)
+{ }
+
+void ncurses_color_pair_cache::attach_screen(int max_pairs, int num_colors, ncurses_color_t named_background)
+{
+    /* the named pairs no longer match their old keys if the background changed */
+    for (short color = COLOR_BLACK; color <= COLOR_WHITE; ++color)
+    {
+        int16_t& named_pair = m_pairs_by_key[get_key(static_cast<short>(resolve_color(color)), m_named_background)];
+        if (named_pair == NCURSES_CPP_TXT_COLOR_BLACK + color)
+        {
+            named_pair = 0;
+        }
+    }
+
+    m_screen_attached = true;
+    m_default_colors_enabled = false;
+    m_num_colors = num_colors;
+    m_named_background = static_cast<short>(named_background);
+    m_max_pair = std::min(max_pairs, MAX_PAIRS) - 1;
+
+    /* keep the recently used pairs at the front, then the free ones */
+    std::vector<int16_t> lru_order;
+    for (int16_t pair = m_lru_head; pair >= 0; pair = m_slots[pair].next)
+    {
+        lru_order.push_back(pair);
+    }
+    for (int pair = FIRST_DYNAMIC_PAIR; pair < MAX_PAIRS; ++pair)
+    {
+        if (!m_slots[pair].in_use &&
+            0 == m_slots[pair].pin_count &&
+            std::find(lru_order.begin(), lru_order.end(), pair) == lru_order.end())
+        {
+            lru_order.push_back(static_cast<int16_t>(pair));
+        }
+    }
+
+    m_lru_head = -1;
+    m_lru_tail = -1;
+    for (int pair = FIRST_DYNAMIC_PAIR; pair < MAX_PAIRS; ++pair)
+    {
+        slot_t& slot = m_slots[pair];
+        slot.prev = -1;
+        slot.next = -1;
+
+        if (slot.in_use &&
+            pair > m_max_pair)
+        {
+            /* does not fit on this screen; a pinned pair is requested again after its
+             *  owner sees it unpinned, so it only loses its colors */
+            unmap_slot(pair);
+            slot.in_use = false;
+        }
+        else if (slot.in_use)
+        {
+            /* the pair may have been handed out for a terminal with more colors */
+            unmap_slot(pair);
+            slot.foreground = static_cast<short>(resolve_color(slot.foreground));
+            slot.background = static_cast<short>(resolve_color(slot.background));
+            if (0 == m_pairs_by_key[get_key(slot.foreground, slot.background)])
+            {
+                m_pairs_by_key[get_key(slot.foreground, slot.background)] = static_cast<int16_t>(pair);
+            }
+            init_curses_pair(pair);
+        }
+    }
+
+    for (size_t idx = 0; idx < lru_order.size(); ++idx)
+    {
+        int pair = lru_order[idx];
+        if (pair <= m_max_pair &&
+            0 == m_slots[pair].pin_count)
+        {
+            link_slot_back(pair);
+        }
+    }
+
+    for (short color = COLOR_BLACK; color <= COLOR_WHITE; ++color)
+    {
+        m_pairs_by_key[get_key(resolve_color(color), m_named_background)] = NCURSES_CPP_TXT_COLOR_BLACK + color;
+    }
+}
+
+ncurses_cpp_text_colors_e ncurses_color_pair_cache::get_pair(ncurses_color_t foreground, ncurses_color_t background)
+{
+    return find_pair(foreground, background, false);
+}
+
+ncurses_cpp_text_colors_e ncurses_color_pair_cache::pin_pair(ncurses_color_t foreground, ncurses_color_t background)
+{
+    return find_pair(foreground, background, true);
+}
+
+void ncurses_color_pair_cache::unpin_pair(ncurses_cpp_text_colors_e pair)
+{
+    if (pair >= FIRST_DYNAMIC_PAIR &&
+        pair < MAX_PAIRS &&
+        m_slots[pair].pin_count > 0)
+    {
+        if (0 == --m_slots[pair].pin_count &&
+            pair <= m_max_pair)
+        {
+            if (m_slots[pair].in_use)
+            {
+                link_slot_front(pair);
+            }
+            else
+            {
+                link_slot_back(pair);
+            }
+        }
+    }
+}
+
+bool ncurses_color_pair_cache::get_pair_colors(ncurses_cpp_text_colors_e pair, short& foreground, short& background) const
+{
+    bool ret = false;
+
+    if (pair >= NCURSES_CPP_TXT_COLOR_BLACK &&
+        pair <= NCURSES_CPP_TXT_COLOR_WHITE)
+    {
+        foreground = static_cast<short>(pair - NCURSES_CPP_TXT_COLOR_BLACK);
+        background = m_named_background;
+        ret = true;
+    }
+    else if (pair >= FIRST_DYNAMIC_PAIR &&
+             pair < MAX_PAIRS &&
+             m_slots[pair].in_use)
+    {
+        foreground = m_slots[pair].foreground;
+        background = m_slots[pair].background;
+        ret = true;
+    }
+
+    return ret;
+}
+
+ncurses_color_t ncurses_color_pair_cache::resolve_color(ncurses_color_t color) const
+{
+    uint8_t red = 0, green = 0, blue = 0;
+
+    if (color < 0 ||
+        (0 == (color & NCURSES_CPP_COLOR_RGB_FLAG) && color < std::min(m_num_colors, XTERM_PALETTE_SIZE)))
+    {
+        return color < 0 ? NCURSES_CPP_COLOR_DEFAULT : color;
+    }
+    else if (!get_color_rgb(color, red, green, blue) ||
+             m_num_colors < 8)
+    {
+        return NCURSES_CPP_COLOR_DEFAULT;
+    }
+    else if (m_num_colors >= XTERM_PALETTE_SIZE)
+    {
+        return get_nearest_256_color(red, green, blue);
+    }
+    else
+    {
+        return get_nearest_base_color(red, green, blue, std::min(m_num_colors, XTERM_CUBE_START));
+    }
+}
+
+ncurses_cpp_text_colors_e ncurses_color_pair_cache::find_pair(ncurses_color_t foreground, ncurses_color_t background, bool pin)
+{
+    short resolved_foreground = static_cast<short>(resolve_color(foreground));
+    short resolved_background = static_cast<short>(resolve_color(background));
+    size_t key = get_key(resolved_foreground, resolved_background);
+    int pair = m_pairs_by_key[key];
+
+    if (0 == pair &&
+        resolved_foreground < 0 &&
+        resolved_background < 0)
+    {
+        return NCURSES_CPP_TXT_COLOR_DEFAULT;
+    }
+    else if (0 != pair)
+    {
+        m_stats.hit_count++;
+        if (pair >= FIRST_DYNAMIC_PAIR)
+        {
+            slot_t& slot = m_slots[pair];
+            if (pin)
+            {
+                if (0 == slot.pin_count++)
+                {
+                    unlink_slot(pair);
+                }
+            }
+            else if (0 == slot.pin_count &&
+                     m_lru_head != pair)
+            {
+                unlink_slot(pair);
+                link_slot_front(pair);
+            }
+        }
+
+        return static_cast<ncurses_cpp_text_colors_e>(pair);
+    }
+
+    m_stats.miss_count++;
+    if (m_lru_tail < 0)
+    {
+        /* every pair is pinned; settle for the nearest named color */
+        m_stats.exhausted_count++;
+
+        uint8_t red = 0, green = 0, blue = 0;
+        if (resolved_foreground < 0 ||
+            !get_color_rgb(resolved_foreground, red, green, blue))
+        {
+            return NCURSES_CPP_TXT_COLOR_DEFAULT;
+        }
+        return static_cast<ncurses_cpp_text_colors_e>(NCURSES_CPP_TXT_COLOR_BLACK + get_nearest_base_color(red, green, blue, 8));
+    }
+
+    pair = m_lru_tail;
+    slot_t& slot = m_slots[pair];
+    if (slot.in_use)
+    {
+        unmap_slot(pair);
+        m_stats.eviction_count++;
+    }
+
+    slot.foreground = resolved_foreground;
+    slot.background = resolved_background;
+    slot.in_use = true;
+    m_pairs_by_key[key] = static_cast<int16_t>(pair);
+    init_curses_pair(pair);
+
+    unlink_slot(pair);
+    if (pin)
+    {
+        slot.pin_count = 1;
+    }
+    else
+    {
+        link_slot_front(pair);
+    }
+
+    return static_cast<ncurses_cpp_text_colors_e>(pair);
+}
+
+size_t ncurses_color_pair_cache::get_key(short foreground, short background)
+{
+    return static_cast<size_t>(foreground + 1) * NUM_RESOLVED_COLORS + static_cast<size_t>(background + 1);
+}
+
+void ncurses_color_pair_cache::unmap_slot(int pair)
+{
+    int16_t& mapped_pair = m_pairs_by_key[get_key(m_slots[pair].foreground, m_slots[pair].background)];
+    if (mapped_pair == pair)
+    {
+        mapped_pair = 0;
+    }
+}
+
+void ncurses_color_pair_cache::unlink_slot(int pair)
+{
+    slot_t& slot = m_slots[pair];
+
+    if (slot.prev >= 0)
+    {
+        m_slots[slot.prev].next = slot.next;
+    }
+    else if (m_lru_head == pair)
+    {
+        m_lru_head = slot.next;
+    }
+
+    if (slot.next >= 0)
+    {
+        m_slots[slot.next].prev = slot.prev;
+    }
+    else if (m_lru_tail == pair)
+    {
+        m_lru_tail = slot.prev;
+    }
+
+    slot.prev = -1;
+    slot.next = -1;
+}
+
+void ncurses_color_pair_cache::link_slot_front(int pair)
+{
+    slot_t& slot = m_slots[pair];
+
+    slot.prev = -1;
+    slot.next = m_lru_head;
+    if (m_lru_head >= 0)
+    {
+        m_slots[m_lru_head].prev = static_cast<int16_t>(pair);
+    }
+    else
+    {
+        m_lru_tail = static_cast<int16_t>(pair);
+    }
+    m_lru_head = static_cast<int16_t>(pair);
+}
+
+void ncurses_color_pair_cache::link_slot_back(int pair)
+{
+    slot_t& slot = m_slots[pair];
+
+    slot.next = -1;
+    slot.prev = m_lru_tail;
+    if (m_lru_tail >= 0)
+    {
+        m_slots[m_lru_tail].next = static_cast<int16_t>(pair);
+    }
+    else
+    {
+        m_lru_head = static_cast<int16_t>(pair);
+    }
+    m_lru_tail = static_cast<int16_t>(pair);
+}
+
+void ncurses_color_pair_cache::init_curses_pair(int pair)
+{
+    if (m_screen_attached)
+    {
+        /* only a pair that asks for the terminal's default colors turns them on,
+         *  because doing so also changes how uncolored text looks */
+        if (!m_default_colors_enabled &&
+            (m_slots[pair].foreground < 0 || m_slots[pair].background < 0))
+        {
+            use_default_colors();
+            m_default_colors_enabled = true;
+        }
+
+        init_pair(static_cast<short>(pair), m_slots[pair].foreground, m_slots[pair].background);
+    }
+}
+
 } /* end ncurses_cpp namespace */
@@ -0,0 +1,629 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_diff_backend.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend that diffs whole frames and writes its own output.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the diff rendering backend. The changed cells of a frame are
+ *  grouped by the window that staged them; each group is rendered into a
+ *  scratch buffer so that its exact cost is known before it is committed to the
+ *  frame output. A group that does not fit the byte budget is dropped, leaving
+ *  its cells different from the front buffer so they are picked up again by the
+ *  next frame.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include <ncurses.h>
+
+#include "ncurses_diff_backend.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static const char * get_terminal_cap(const char * cap_name)
+{
+    /* tigetstr() takes a non-const name in older curses releases */
+    const char * ret = tigetstr(const_cast<char *>(cap_name));
+
+    if (reinterpret_cast<const char *>(-1) == ret ||
+        (nullptr != ret && '\0' == ret[0]))
+    {
+        ret = nullptr;
+    }
+
+    return ret;
+}
+
+static size_t get_parm_cap_len(const char * cap, uint32_t count)
+{
+    return strlen(tiparm(cap, static_cast<int>(count)));
+}
+
+static bool cells_equal(const ncurses_memory_cell_t& lhs, const ncurses_memory_cell_t& rhs)
+{
+    return lhs.ch == rhs.ch && lhs.color == rhs.color;
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_diff_backend::ncurses_diff_backend(void)
+  : ncurses_diff_backend(nullptr, nullptr)
+{ }
+
+ncurses_diff_backend::ncurses_diff_backend(FILE * term_out, FILE * term_in)
+  : ncurses_memory_backend(0, 0),
+    m_terminal(term_out, term_in),
+    m_term_out(nullptr != term_out && nullptr != term_in ? term_out : stdout),
+    m_caps(),
+    m_num_batches(0),
+    m_cursor_known(false),
+    m_cursor_x(0),
+    m_cursor_y(0),
+    m_color_known(false),
+    m_current_color(NCURSES_CPP_TXT_COLOR_DEFAULT),
+    m_current_foreground(-1),
+    m_current_background(-1),
+    m_frame_byte_budget(0),
+    m_has_deferred_output(false),
+    m_bytes_written(0),
+    m_deferred_window_count(0)
+{ }
+
+ncurses_diff_backend::~ncurses_diff_backend(void)
+{
+    close_screen();
+}
+
+bool ncurses_diff_backend::open_screen(void)
+{
+    if (!m_terminal.open_screen())
+    {
+        return false;
+    }
+
+    /* let curses clear the screen once; it never writes to the terminal again until
+     *  the screen is closed, so the front buffer stays in step with the terminal */
+    m_terminal.get_screen_window()->refresh();
+    load_terminal_caps();
+
+    /* every other cursor movement is optional */
+    if (nullptr == m_caps.cursor_address)
+    {
+        m_terminal.close_screen();
+        return false;
+    }
+
+    resize_screen(m_terminal.get_rows(), m_terminal.get_cols());
+    m_cell_owners.assign(m_pending_cells.size(), nullptr);
+    m_cursor_known = false;
+    m_color_known = false;
+    m_has_deferred_output = false;
+
+    return ncurses_memory_backend::open_screen();
+}
+
+void ncurses_diff_backend::close_screen(void)
+{
+    ncurses_memory_backend::close_screen();
+
+    /* curses does not know what was written behind its back; make sure the terminal
+     *  is back to the default colors before it takes over again */
+    if (m_color_known &&
+        NCURSES_CPP_TXT_COLOR_DEFAULT != m_current_color)
+    {
+        m_frame_output.clear();
+        set_color(NCURSES_CPP_TXT_COLOR_DEFAULT, m_frame_output);
+        write_output(m_frame_output);
+    }
+
+    m_terminal.close_screen();
+}
+
+void ncurses_diff_backend::handle_resize(void)
+{
+    /* the terminal contents are unknown after a resize; start over from a cleared
+     *  screen, which matches the blank front buffer */
+    resize_screen(m_terminal.get_rows(), m_terminal.get_cols());
+    m_cell_owners.assign(m_pending_cells.size(), nullptr);
+
+    m_frame_output.clear();
+    if (nullptr != m_caps.clear_screen)
+    {
+        if (m_color_known &&
+            NCURSES_CPP_TXT_COLOR_DEFAULT != m_current_color)
+        {
+            set_color(NCURSES_CPP_TXT_COLOR_DEFAULT, m_frame_output);
+        }
+        m_frame_output.append(m_caps.clear_screen);
+    }
+    write_output(m_frame_output);
+
+    m_cursor_known = false;
+    m_has_deferred_output = false;
+}
+
+void ncurses_diff_backend::load_terminal_caps(void)
+{
+    m_caps.cursor_address = get_terminal_cap("cup");
+    m_caps.clear_screen = get_terminal_cap("clear");
+    m_caps.carriage_return = get_terminal_cap("cr");
+    m_caps.cursor_right = get_terminal_cap("cuf1");
+    m_caps.cursor_left = get_terminal_cap("cub1");
+    m_caps.cursor_down = get_terminal_cap("cud1");
+    m_caps.cursor_up = get_terminal_cap("cuu1");
+    m_caps.parm_right_cursor = get_terminal_cap("cuf");
+    m_caps.parm_left_cursor = get_terminal_cap("cub");
+    m_caps.parm_down_cursor = get_terminal_cap("cud");
+    m_caps.parm_up_cursor = get_terminal_cap("cuu");
+    m_caps.set_a_foreground = get_terminal_cap("setaf");
+    m_caps.set_a_background = get_terminal_cap("setab");
+    m_caps.orig_pair = get_terminal_cap("op");
+    m_caps.exit_attribute_mode = get_terminal_cap("sgr0");
+
+    /* a line feed may also return the carriage depending on the tty settings */
+    if (nullptr != m_caps.cursor_down &&
+        0 == strcmp(m_caps.cursor_down, "\n"))
+    {
+        m_caps.cursor_down = nullptr;
+    }
+
+    if (!has_colors())
+    {
+        m_caps.set_a_foreground = nullptr;
+        m_caps.set_a_background = nullptr;
+    }
+}
+
+void ncurses_diff_backend::stage_cells(const ncurses_backend_window * window, uint32_t begin_y, uint32_t begin_x, uint32_t row, const ncurses_memory_cell_t * cells, uint32_t num_cells)
+{
+    ncurses_memory_backend::stage_cells(window, begin_y, begin_x, row, cells, num_cells);
+
+    uint32_t screen_y = begin_y + row;
+    if (screen_y >= m_rows || begin_x >= m_cols)
+    {
+        return;
+    }
+
+    num_cells = std::min(num_cells, m_cols - begin_x);
+    auto owners_begin = m_cell_owners.begin() + static_cast<size_t>(screen_y) * m_cols + begin_x;
+    std::fill(owners_begin, owners_begin + num_cells, window);
+}
+
+void ncurses_diff_backend::release_window(const ncurses_backend_window * window)
+{
+    /* the cells stay on the screen until another window is staged over them */
+    std::replace(m_cell_owners.begin(), m_cell_owners.end(), window, static_cast<const ncurses_backend_window *>(nullptr));
+}
+
+ncurses_diff_backend::window_batch_t& ncurses_diff_backend::get_window_batch(const ncurses_backend_window * window)
+{
+    for (size_t i = 0; i < m_num_batches; ++i)
+    {
+        if (m_batches[i].window == window)
+        {
+            return m_batches[i];
+        }
+    }
+
+    if (m_num_batches == m_batches.size())
+    {
+        m_batches.push_back(window_batch_t());
+    }
+
+    window_batch_t& ret = m_batches[m_num_batches++];
+    ret.window = window;
+    ret.priority = nullptr != window ? window->get_priority() : 0;
+    ret.cells.clear();
+
+    return ret;
+}
+
+void ncurses_diff_backend::commit_frame(void)
+{
+    m_num_batches = 0;
+
+    /* group the changed cells by the window that staged them */
+    const ncurses_backend_window * last_window = nullptr;
+    window_batch_t * last_batch = nullptr;
+    size_t last_cell = m_pending_cells.size() - 1;
+
+    for (uint32_t y = 0; y < m_rows; ++y)
+    {
+        if (!m_pending_dirty_rows[y])
+        {
+            continue;
+        }
+        m_pending_dirty_rows[y] = false;
+
+        size_t row_start = static_cast<size_t>(y) * m_cols;
+        for (size_t i = row_start; i < row_start + m_cols; ++i)
+        {
+            if (cells_equal(m_visible_cells[i], m_pending_cells[i]))
+            {
+                continue;
+            }
+
+            /* writing the bottom right cell scrolls terminals with automatic margins;
+             *  like curses without insert capabilities, leave it alone */
+            if (i == last_cell)
+            {
+                m_visible_cells[i] = m_pending_cells[i];
+                continue;
+            }
+
+            if (nullptr == last_batch ||
+                m_cell_owners[i] != last_window)
+            {
+                last_window = m_cell_owners[i];
+                last_batch = &get_window_batch(last_window);
+            }
+            last_batch->cells.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    /* highest priority first; equal priorities keep the staging order (spelled out
+     *  rather than using std::stable_sort, which allocates a scratch buffer) */
+    m_batch_order.resize(m_num_batches);
+    for (size_t i = 0; i < m_num_batches; ++i)
+    {
+        m_batch_order[i] = i;
+    }
+    std::sort(m_batch_order.begin(), m_batch_order.end(), [this](size_t lhs, size_t rhs) {
+        return m_batches[lhs].priority > m_batches[rhs].priority ||
+               (m_batches[lhs].priority == m_batches[rhs].priority && lhs < rhs);
+    });
+
+    m_frame_output.clear();
+    m_has_deferred_output = false;
+    bool budget_exhausted = false;
+
+    for (auto iter = m_batch_order.begin(); iter != m_batch_order.end(); ++iter)
+    {
+        const window_batch_t& batch = m_batches[*iter];
+
+        if (!budget_exhausted)
+        {
+            bool cursor_known = m_cursor_known;
+            uint32_t cursor_x = m_cursor_x;
+            uint32_t cursor_y = m_cursor_y;
+            bool color_known = m_color_known;
+            ncurses_cpp_text_colors_e current_color = m_current_color;
+            short current_foreground = m_current_foreground;
+            short current_background = m_current_background;
+
+            m_batch_output.clear();
+            emit_batch(batch, m_batch_output);
+
+            if (0 == m_frame_byte_budget ||
+                m_frame_output.empty() ||
+                m_frame_output.size() + m_batch_output.size() <= m_frame_byte_budget)
+            {
+                m_frame_output.append(m_batch_output);
+                for (auto cell = batch.cells.begin(); cell != batch.cells.end(); ++cell)
+                {
+                    m_visible_cells[*cell] = m_pending_cells[*cell];
+                }
+                m_cells_written += batch.cells.size();
+                continue;
+            }
+
+            /* the output for this window is thrown away, so is the state it left */
+            m_cursor_known = cursor_known;
+            m_cursor_x = cursor_x;
+            m_cursor_y = cursor_y;
+            m_color_known = color_known;
+            m_current_color = current_color;
+            m_current_foreground = current_foreground;
+            m_current_background = current_background;
+            budget_exhausted = true;
+        }
+
+        /* the cells still differ from the front buffer; the next frame retries them */
+        for (auto cell = batch.cells.begin(); cell != batch.cells.end(); ++cell)
+        {
+            m_pending_dirty_rows[*cell / m_cols] = true;
+        }
+        m_has_deferred_output = true;
+        m_deferred_window_count++;
+    }
+
+    write_output(m_frame_output);
+    m_frame_count++;
+}
+
+void ncurses_diff_backend::emit_batch(const window_batch_t& batch, std::string& out)
+{
+    for (auto iter = batch.cells.begin(); iter != batch.cells.end(); ++iter)
+    {
+        uint32_t x = *iter % m_cols;
+        uint32_t y = *iter / m_cols;
+        const ncurses_memory_cell_t& cell = m_pending_cells[*iter];
+
+        move_cursor(x, y, out);
+        set_color(cell.color, out);
+
+        /* the cursor position is only tracked for single column characters */
+        unsigned char ch = static_cast<unsigned char>(cell.ch);
+        out.push_back(ch >= 0x20 && ch < 0x7f ? cell.ch : '?');
+
+        /* past the last column the cursor position depends on the terminal */
+        m_cursor_x = x + 1;
+        m_cursor_known = (m_cursor_x < m_cols);
+    }
+}
+
+void ncurses_diff_backend::move_cursor(uint32_t x, uint32_t y, std::string& out)
+{
+    if (m_cursor_known &&
+        m_cursor_x == x &&
+        m_cursor_y == y)
+    {
+        return;
+    }
+
+    /* absolute addressing always works; relative moves are often much shorter */
+    m_best_move.assign(tiparm(m_caps.cursor_address, static_cast<int>(y), static_cast<int>(x)));
+
+    if (m_cursor_known)
+    {
+        m_candidate_move.clear();
+        if (add_vertical_move(m_cursor_y, y, m_candidate_move) &&
+            add_horizontal_move(m_cursor_x, x, y, m_cursor_y == y, m_candidate_move) &&
+            m_candidate_move.size() < m_best_move.size())
+        {
+            m_best_move.swap(m_candidate_move);
+        }
+
+        if (nullptr != m_caps.carriage_return)
+        {
+            m_candidate_move.assign(m_caps.carriage_return);
+            if (add_vertical_move(m_cursor_y, y, m_candidate_move) &&
+                add_horizontal_move(0, x, y, false, m_candidate_move) &&
+                m_candidate_move.size() < m_best_move.size())
+            {
+                m_best_move.swap(m_candidate_move);
+            }
+        }
+    }
+
+    out.append(m_best_move);
+    m_cursor_x = x;
+    m_cursor_y = y;
+    m_cursor_known = true;
+}
+
+bool ncurses_diff_backend::add_vertical_move(uint32_t from_y, uint32_t to_y, std::string& out) const
+{
+    if (from_y == to_y)
+    {
+        return true;
+    }
+
+    const char * step_cap = from_y < to_y ? m_caps.cursor_down : m_caps.cursor_up;
+    const char * parm_cap = from_y < to_y ? m_caps.parm_down_cursor : m_caps.parm_up_cursor;
+    uint32_t count = from_y < to_y ? to_y - from_y : from_y - to_y;
+
+    size_t step_len = nullptr != step_cap ? count * strlen(step_cap) : SIZE_MAX;
+    size_t parm_len = nullptr != parm_cap ? get_parm_cap_len(parm_cap, count) : SIZE_MAX;
+
+    if (SIZE_MAX == step_len &&
+        SIZE_MAX == parm_len)
+    {
+        return false;
+    }
+
+    if (step_len <= parm_len)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            out.append(step_cap);
+        }
+    }
+    else
+    {
+        out.append(tiparm(parm_cap, static_cast<int>(count)));
+    }
+
+    return true;
+}
+
+bool ncurses_diff_backend::add_horizontal_move(uint32_t from_x, uint32_t to_x, uint32_t y, bool allow_overwrite, std::string& out) const
+{
+    if (from_x == to_x)
+    {
+        return true;
+    }
+
+    const char * step_cap = from_x < to_x ? m_caps.cursor_right : m_caps.cursor_left;
+    const char * parm_cap = from_x < to_x ? m_caps.parm_right_cursor : m_caps.parm_left_cursor;
+    uint32_t count = from_x < to_x ? to_x - from_x : from_x - to_x;
+
+    size_t step_len = nullptr != step_cap ? count * strlen(step_cap) : SIZE_MAX;
+    size_t parm_len = nullptr != parm_cap ? get_parm_cap_len(parm_cap, count) : SIZE_MAX;
+
+    /* moving right can also be done by writing out what is already on the screen, as
+     *  long as it does not need a color change */
+    size_t overwrite_len = SIZE_MAX;
+    const ncurses_memory_cell_t * row_cells = &m_visible_cells[static_cast<size_t>(y) * m_cols];
+    if (allow_overwrite &&
+        from_x < to_x &&
+        m_color_known &&
+        count < std::min(step_len, parm_len))
+    {
+        overwrite_len = count;
+        for (uint32_t x = from_x; x < to_x; ++x)
+        {
+            unsigned char ch = static_cast<unsigned char>(row_cells[x].ch);
+            if (row_cells[x].color != m_current_color ||
+                ch < 0x20 || ch >= 0x7f)
+            {
+                overwrite_len = SIZE_MAX;
+                break;
+            }
+        }
+    }
+
+    size_t best_len = std::min(overwrite_len, std::min(step_len, parm_len));
+    if (SIZE_MAX == best_len)
+    {
+        return false;
+    }
+
+    if (overwrite_len == best_len)
+    {
+        for (uint32_t x = from_x; x < to_x; ++x)
+        {
+            out.push_back(row_cells[x].ch);
+        }
+    }
+    else if (step_len == best_len)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            out.append(step_cap);
+        }
+    }
+    else
+    {
+        out.append(tiparm(parm_cap, static_cast<int>(count)));
+    }
+
+    return true;
+}
+
+void ncurses_diff_backend::set_color(ncurses_cpp_text_colors_e color, std::string& out)
+{
+    short foreground = -1;
+    short background = -1;
+
+    if (nullptr == m_caps.set_a_foreground ||
+        !get_color_pair_cache().get_pair_colors(color, foreground, background))
+    {
+        /* monochrome terminal, or a pair without colors */
+        color = NCURSES_CPP_TXT_COLOR_DEFAULT;
+        foreground = -1;
+        background = -1;
+    }
+
+    if (m_color_known &&
+        m_current_color == color &&
+        m_current_foreground == foreground &&
+        m_current_background == background)
+    {
+        return;
+    }
+
+    if (NCURSES_CPP_TXT_COLOR_DEFAULT == color)
+    {
+        /* a terminal with neither capability never leaves its default colors */
+        const char * reset_cap = nullptr != m_caps.orig_pair ? m_caps.orig_pair : m_caps.exit_attribute_mode;
+        if (nullptr != reset_cap)
+        {
+            out.append(reset_cap);
+        }
+    }
+    else
+    {
+        bool set_foreground = !m_color_known ||
+                              m_current_foreground != foreground;
+        bool set_background = !m_color_known ||
+                              m_current_background != background;
+
+        /* a default color can only be restored together with the other one */
+        if (((set_background && background < 0) || (set_foreground && foreground < 0)) &&
+            nullptr != m_caps.orig_pair)
+        {
+            out.append(m_caps.orig_pair);
+            set_foreground = foreground >= 0;
+            set_background = background >= 0;
+        }
+
+        if (set_foreground &&
+            foreground >= 0)
+        {
+            out.append(tiparm(m_caps.set_a_foreground, static_cast<int>(foreground)));
+        }
+
+        if (set_background &&
+            background >= 0 &&
+            nullptr != m_caps.set_a_background)
+        {
+            out.append(tiparm(m_caps.set_a_background, static_cast<int>(background)));
+        }
+    }
+
+    m_current_color = color;
+    m_current_foreground = foreground;
+    m_current_background = background;
+    m_color_known = true;
+}
+
+void ncurses_diff_backend::write_output(const std::string& output)
+{
+    if (!output.empty())
+    {
+        fwrite(output.data(), 1, output.size(), m_term_out);
+        fflush(m_term_out);
+        m_bytes_written += output.size();
+    }
+}
+
+} /* end ncurses_cpp namespace */
@@ -48,8 +48,7 @@
  *****************************************************************************/
 
 #include <algorithm>
-
-#include <ncurses.h>
+#include <cstring>
 
 #include "ncurses_field.h"
 
@@ -60,6 +59,11 @@ namespace ncurses_cpp {
  *                                 CONSTANTS
  *****************************************************************************/
 
+/* up to this many band endpoints a numeric lookup compares against every point
+ *  instead of running a binary search with unpredictable branches */
+const size_t SMALL_THRESHOLD_POINT_COUNT = 16;
+
+
 /******************************************************************************
  *                              ENUMS & TYPEDEFS
  *****************************************************************************/
@@ -72,6 +76,28 @@ namespace ncurses_cpp {
  *                           FUNCTION IMPLEMENTATION
  *****************************************************************************/
 
+/* fields are only drawn from the UI thread, so every field renders into the same
+ *  scratch buffer before it is compared against the field's on-screen image */
+static char s_render_scratch[NCURSES_CPP_FIELD_RENDER_CAPACITY];
+
+template <typename T>
+static ncurses_cpp_text_colors_e get_gradient_color(const ncurses_color_gradient& gradient, const T& field_val, std::true_type is_arithmetic)
+{
+    (void)is_arithmetic;
+
+    return gradient.get_color(static_cast<double>(field_val));
+}
+
+template <typename T>
+static ncurses_cpp_text_colors_e get_gradient_color(const ncurses_color_gradient& gradient, const T& field_val, std::false_type is_arithmetic)
+{
+    (void)gradient;
+    (void)field_val;
+    (void)is_arithmetic;
+
+    return NCURSES_CPP_TXT_COLOR_DEFAULT;
+}
+
 /******************************************************************************
  *                           CLASS IMPLEMENTATION
  *****************************************************************************/
@@ -81,7 +107,14 @@ ncurses_field<T>::ncurses_field(void)
   : m_window(nullptr),
     m_x(0),
     m_y(0),
-    m_default_color(NCURSES_CPP_TXT_COLOR_DEFAULT)
+    m_default_color(NCURSES_CPP_TXT_COLOR_DEFAULT),
+    m_threshold_index_valid(false),
+    m_refresh_state(nullptr),
+    m_rendered_len(0),
+    m_rendered_color(NCURSES_CPP_TXT_COLOR_DEFAULT),
+    m_rendered_valid(false),
+    m_write_count(0),
+    m_skip_count(0)
 { }
 
 template <typename T>
@@ -89,24 +122,26 @@ ncurses_field<T>::~ncurses_field(void)
 { }
 
 template <typename T>
-bool ncurses_field<T>::create_field(WINDOW * window, uint32_t x, uint32_t y, std::string format_str, T default_val)
+bool ncurses_field<T>::create_field(ncurses_backend_window * window, uint32_t x, uint32_t y, std::string format_str, T default_val)
 {
     return create_field(window, x, y, format_str, default_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
 }
 
 template <typename T>
-bool ncurses_field<T>::create_field(WINDOW * window, uint32_t x, uint32_t y, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color)
+bool ncurses_field<T>::create_field(ncurses_backend_window * window, uint32_t x, uint32_t y, std::string format_str, T default_val, ncurses_cpp_text_colors_e default_color)
 {
     bool ret = false;
 
-    if (nullptr != window)
+    if (nullptr != window &&
+        m_format.compile(format_str, ncurses_field_value_traits<T>::type))
     {
         m_window = window;
         m_x = x;
         m_y = y;
-        m_format_str = format_str;
         m_current_value = default_val;
         m_default_color = default_color;
+        m_rendered_valid = false;
+        ret = true;
     }
 
     return ret;
@@ -120,72 +155,150 @@ bool ncurses_field<T>::update_field(void)
 }
 
 template <typename T>
-bool ncurses_field<T>::update_field(T field_val)
+bool ncurses_field<T>::update_field(const T& field_val)
 {
     return update_field(field_val, m_default_color);
 }
 
-template <>
-bool ncurses_field<std::string>::update_field(std::string field_val, ncurses_cpp_text_colors_e field_color)
+template <typename T>
+bool ncurses_field<T>::update_field(const T& field_val, ncurses_cpp_text_colors_e field_color)
 {
     bool ret = false;
-    ncurses_cpp_text_colors_e threshold_color = get_color_based_on_thresholds(field_val);
-    if (NCURSES_CPP_TXT_COLOR_DEFAULT == field_color &&
-        NCURSES_CPP_TXT_COLOR_DEFAULT != threshold_color)
+    record_field_update(field_val, field_color);
+
+    if (NCURSES_CPP_TXT_COLOR_DEFAULT == field_color)
     {
-        field_color = threshold_color;
+        field_color = get_value_color(field_val);
     }
 
+    m_current_value = field_val;
+
     if (nullptr != m_window)
     {
-        if (NCURSES_CPP_TXT_COLOR_DEFAULT != field_color)
-        {
-            wattron(m_window, COLOR_PAIR(field_color));
-        }
+        ret = draw_text(format_value(field_val), field_color);
+    }
 
-        if (OK == mvwprintw(m_window, m_y, m_x, m_format_str.c_str(), field_val.c_str()))
-        {
-            wrefresh(m_window);
-            ret = true;
-        }
+    return ret;
+}
 
-        if (NCURSES_CPP_TXT_COLOR_DEFAULT != field_color)
-        {
-            wattroff(m_window, COLOR_PAIR(field_color));
-        }
+template <typename T>
+bool ncurses_field<T>::update_field(T&& field_val)
+{
+    return update_field(std::move(field_val), m_default_color);
+}
+
+template <typename T>
+bool ncurses_field<T>::update_field(T&& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+    record_field_update(field_val, field_color);
+
+    if (NCURSES_CPP_TXT_COLOR_DEFAULT == field_color)
+    {
+        field_color = get_value_color(field_val);
+    }
+
+    /* swapped rather than move assigned so that the caller gets the old storage back */
+    std::swap(m_current_value, field_val);
+
+    if (nullptr != m_window)
+    {
+        ret = draw_text(format_value(m_current_value), field_color);
     }
 
     return ret;
 }
 
 template <typename T>
-bool ncurses_field<T>::update_field(T field_val, ncurses_cpp_text_colors_e field_color)
+bool ncurses_field<T>::apply_update(const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color)
 {
     bool ret = false;
-    ncurses_cpp_text_colors_e threshold_color = get_color_based_on_thresholds(field_val);
-    if (NCURSES_CPP_TXT_COLOR_DEFAULT == field_color &&
-        NCURSES_CPP_TXT_COLOR_DEFAULT != threshold_color)
+
+    if (ncurses_field_value_traits<T>::type == field_val.type)
     {
-        field_color = threshold_color;
+        /* load into a member so that string values reuse their storage; the storage
+         *  is swapped with the current value instead of being copied into it */
+        ncurses_field_value_traits<T>::load(field_val, m_applied_value);
+        ret = update_field(std::move(m_applied_value), field_color);
     }
 
-    if (nullptr != m_window)
+    return ret;
+}
+
+template <typename T>
+bool ncurses_field<T>::get_value(ncurses_field_value_t& field_val) const
+{
+    ncurses_field_value_traits<T>::store(field_val, m_current_value);
+    return true;
+}
+
+template <typename T>
+bool ncurses_field<T>::move_to_window(ncurses_backend_window * window)
+{
+    /* keep the color the value was last drawn with, which may have come with the
+     *  update rather than from the thresholds */
+    ncurses_cpp_text_colors_e field_color = m_rendered_valid ? m_rendered_color : get_value_color(m_current_value);
+    if (!m_rendered_valid &&
+        NCURSES_CPP_TXT_COLOR_DEFAULT == field_color)
     {
-        if (NCURSES_CPP_TXT_COLOR_DEFAULT != field_color)
-        {
-            wattron(m_window, COLOR_PAIR(field_color));
-        }
+        field_color = m_default_color;
+    }
 
-        if (OK == mvwprintw(m_window, m_y, m_x, m_format_str.c_str(), field_val))
-        {
-            wrefresh(m_window);
-            ret = true;
-        }
+    m_window = window;
+    m_rendered_valid = false;
 
-        if (NCURSES_CPP_TXT_COLOR_DEFAULT != field_color)
-        {
-            wattroff(m_window, COLOR_PAIR(field_color));
-        }
+    return nullptr != m_window && draw_text(format_value(m_current_value), field_color);
+}
+
+template <typename T>
+void ncurses_field<T>::record_field_update(const T& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    /* the color is recorded as requested, before the thresholds resolve it */
+    if (is_recorded())
+    {
+        ncurses_field_value_t recorded_val;
+        ncurses_field_value_traits<T>::store(recorded_val, field_val);
+        record_update(recorded_val, field_color);
+    }
+}
+
+template <typename T>
+size_t ncurses_field<T>::format_value(const T& field_val)
+{
+    return m_format.render(field_val, s_render_scratch, sizeof(s_render_scratch));
+}
+
+template <typename T>
+bool ncurses_field<T>::draw_text(size_t text_len, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    /* most values do not change between updates; leave the terminal alone if the
+     *  field would be redrawn with exactly what is already on the screen */
+    if (m_rendered_valid &&
+        m_rendered_color == field_color &&
+        m_rendered_len == text_len &&
+        memcmp(m_rendered_text, s_render_scratch, text_len) == 0)
+    {
+        m_skip_count++;
+        return true;
+    }
+
+    if (m_window->draw_text(m_x, m_y, s_render_scratch, text_len, field_color))
+    {
+        memcpy(m_rendered_text, s_render_scratch, text_len);
+        m_rendered_len = text_len;
+        m_rendered_color = field_color;
+        m_rendered_valid = true;
+        m_write_count++;
+
+        refresh_window();
+        ret = true;
+    }
+    else
+    {
+        /* the screen may hold a partial write; make sure the next update redraws */
+        m_rendered_valid = false;
     }
 
     return ret;
@@ -202,11 +315,13 @@ bool ncurses_field<T>::add_field_thresholds(std::pair<T, T> field_threshold_vals
         new_threshold.threshold = field_threshold_vals;
         new_threshold.color = field_color;
 
-        auto found_match = std::find(m_threshold_vals.begin(), m_threshold_vals.end(), new_threshold);
-        if (found_match == m_threshold_vals.end())
+        /* the list is kept sorted, so only the bands with the same range need to be
+         *  checked for a duplicate */
+        auto range = std::equal_range(m_threshold_vals.begin(), m_threshold_vals.end(), new_threshold, ncurses_field<T>::compare_threshold_vals);
+        if (std::find(range.first, range.second, new_threshold) == range.second)
         {
-            m_threshold_vals.push_back(new_threshold);
-            std::sort(m_threshold_vals.begin(), m_threshold_vals.end(), ncurses_field<T>::compare_threshold_vals);
+            m_threshold_vals.insert(range.second, new_threshold);
+            m_threshold_index_valid = false;
 
             ret = true;
         }
@@ -215,6 +330,54 @@ bool ncurses_field<T>::add_field_thresholds(std::pair<T, T> field_threshold_vals
     return ret;
 }
 
+template <typename T>
+bool ncurses_field<T>::set_field_thresholds(const std::vector<threshold_band_t>& field_thresholds)
+{
+    bool ret = true;
+
+    m_threshold_vals.clear();
+    m_threshold_vals.reserve(field_thresholds.size());
+
+    for (auto iter = field_thresholds.begin(); iter != field_thresholds.end(); ++iter)
+    {
+        if (iter->first.first < iter->first.second)
+        {
+            field_thresholds_t new_threshold;
+            new_threshold.threshold = iter->first;
+            new_threshold.color = iter->second;
+            m_threshold_vals.push_back(new_threshold);
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    /* a stable sort keeps the caller's order between bands with the same range,
+     *  matching what repeated add_field_thresholds() calls would produce */
+    std::stable_sort(m_threshold_vals.begin(), m_threshold_vals.end(), ncurses_field<T>::compare_threshold_vals);
+
+    auto new_end = m_threshold_vals.begin();
+    for (auto iter = m_threshold_vals.begin(); iter != m_threshold_vals.end(); ++iter)
+    {
+        bool duplicate = false;
+        for (auto prev = m_threshold_vals.begin(); prev != new_end && !duplicate; ++prev)
+        {
+            duplicate = (*prev == *iter);
+        }
+
+        if (!duplicate)
+        {
+            *new_end++ = *iter;
+        }
+    }
+    m_threshold_vals.erase(new_end, m_threshold_vals.end());
+
+    m_threshold_index_valid = false;
+
+    return ret;
+}
+
 template <typename T>
 bool ncurses_field<T>::compare_threshold_vals(const field_thresholds_t& a, const field_thresholds_t& b)
 {
@@ -229,28 +392,163 @@ bool ncurses_field<T>::compare_threshold_vals(const field_thresholds_t& a, const
 }
 
 template <typename T>
-ncurses_cpp_text_colors_e ncurses_field<T>::get_color_based_on_thresholds(T field_val)
+void ncurses_field<T>::rebuild_threshold_index(void)
 {
-    ncurses_cpp_text_colors_e ret = NCURSES_CPP_TXT_COLOR_DEFAULT;
-
+    m_threshold_points.clear();
     for (auto iter = m_threshold_vals.begin(); iter != m_threshold_vals.end(); ++iter)
     {
-        if (iter->threshold.first <= field_val &&
-            field_val <= iter->threshold.second)
+        m_threshold_points.push_back(iter->threshold.first);
+        m_threshold_points.push_back(iter->threshold.second);
+    }
+
+    std::sort(m_threshold_points.begin(), m_threshold_points.end());
+    m_threshold_points.erase(std::unique(m_threshold_points.begin(), m_threshold_points.end()), m_threshold_points.end());
+
+    /* gap i lies between points i-1 and i; the outer gaps are unbounded and can
+     *  never be covered by a band */
+    size_t num_points = m_threshold_points.size();
+    m_threshold_point_colors.assign(num_points, NCURSES_CPP_TXT_COLOR_DEFAULT);
+    m_threshold_gap_colors.assign(num_points + 1, NCURSES_CPP_TXT_COLOR_DEFAULT);
+
+    for (size_t i = 0; i < num_points; ++i)
+    {
+        const T& point = m_threshold_points[i];
+        for (auto iter = m_threshold_vals.begin(); iter != m_threshold_vals.end(); ++iter)
+        {
+            if (iter->threshold.first <= point &&
+                point <= iter->threshold.second)
+            {
+                m_threshold_point_colors[i] = iter->color;
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 1; i < num_points; ++i)
+    {
+        const T& gap_start = m_threshold_points[i - 1];
+        const T& gap_end = m_threshold_points[i];
+        for (auto iter = m_threshold_vals.begin(); iter != m_threshold_vals.end(); ++iter)
         {
-            ret = iter->color;
-            break;
+            if (iter->threshold.first <= gap_start &&
+                gap_end <= iter->threshold.second)
+            {
+                m_threshold_gap_colors[i] = iter->color;
+                break;
+            }
         }
     }
 
+    m_threshold_index_valid = true;
+}
+
+template <typename T>
+size_t ncurses_field<T>::count_points_below(const std::vector<T>& points, const T& field_val, std::true_type is_arithmetic)
+{
+    (void)is_arithmetic;
+
+    size_t ret = 0;
+
+    if (points.size() <= SMALL_THRESHOLD_POINT_COUNT)
+    {
+        /* the comparison results are summed rather than branched on */
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            ret += static_cast<size_t>(points[i] < field_val);
+        }
+    }
+    else
+    {
+        /* binary search where each step advances the base by a multiple of the
+         *  comparison result instead of branching on the value */
+        size_t base = 0;
+        size_t remaining = points.size();
+        while (remaining > 1)
+        {
+            size_t half = remaining / 2;
+            base += half * static_cast<size_t>(points[base + half - 1] < field_val);
+            remaining -= half;
+        }
+
+        ret = base + static_cast<size_t>(points[base] < field_val);
+    }
+
     return ret;
 }
 
+template <typename T>
+size_t ncurses_field<T>::count_points_below(const std::vector<T>& points, const T& field_val, std::false_type is_arithmetic)
+{
+    (void)is_arithmetic;
+
+    return std::lower_bound(points.begin(), points.end(), field_val) - points.begin();
+}
+
+template <typename T>
+ncurses_cpp_text_colors_e ncurses_field<T>::get_color_based_on_thresholds(const T& field_val)
+{
+    if (!m_threshold_index_valid)
+    {
+        /* deferred so that a run of add_field_thresholds() calls only rebuilds once */
+        rebuild_threshold_index();
+    }
+
+    size_t idx = count_points_below(m_threshold_points, field_val, typename std::is_arithmetic<T>::type());
+
+    /* an explicit equality test keeps NaN out of every band */
+    if (idx < m_threshold_points.size() &&
+        m_threshold_points[idx] == field_val)
+    {
+        return m_threshold_point_colors[idx];
+    }
+    else
+    {
+        return m_threshold_gap_colors[idx];
+    }
+}
+
+template <typename T>
+ncurses_cpp_text_colors_e ncurses_field<T>::get_value_color(const T& field_val)
+{
+    ncurses_cpp_text_colors_e ret = get_color_based_on_thresholds(field_val);
+
+    if (NCURSES_CPP_TXT_COLOR_DEFAULT == ret &&
+        nullptr != m_color_gradient)
+    {
+        ret = get_gradient_color(*m_color_gradient, field_val, typename std::is_arithmetic<T>::type());
+    }
+
+    return ret;
+}
+
+template <typename T>
+void ncurses_field<T>::refresh_window(void)
+{
+    if (nullptr != m_refresh_state &&
+        m_refresh_state->frame_commit_mode)
+    {
+        /* the field contents are already in the window buffer; the owning
+         *  ncurses_ui pushes them to the terminal with the rest of the frame */
+        m_refresh_state->deferred_refresh_count++;
+    }
+    else
+    {
+        m_window->refresh();
+    }
+}
+
 /* explicit instantiations of the ncurses_field class */
 template class ncurses_field<std::string>;
 template class ncurses_field<int32_t>;
 template class ncurses_field<uint32_t>;
 template class ncurses_field<float>;
 template class ncurses_field<double>;
+template class ncurses_field<int64_t>;
+template class ncurses_field<uint64_t>;
+template class ncurses_field<bool>;
+template class ncurses_field<std::chrono::nanoseconds>;
+template class ncurses_field<std::chrono::microseconds>;
+template class ncurses_field<std::chrono::milliseconds>;
+template class ncurses_field<std::chrono::seconds>;
 
 } /* end ncurses_cpp namespace */
@@ -0,0 +1,632 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_field_format.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Implements a pre-compiled printf-style format for ncurses fields.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements a pre-compiled printf-style format for ncurses fields. Integer,
+ *  string and fixed-point conversions are rendered directly; the output is
+ *  identical to printf. Exponent and hex-float conversions, as well as
+ *  fixed-point values that printf would have to round at an exact tie, are
+ *  handed to snprintf with the single pre-built conversion.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cctype>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "ncurses_field_format.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const int DEFAULT_FLOAT_PRECISION = 6;
+
+/* limits of the fixed-point fast path; larger values go through snprintf */
+const int MAX_FAST_FIXED_PRECISION = 9;
+const double MAX_FAST_FIXED_SCALED_VALUE = 1.0e15;
+
+const double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+const uint64_t INTEGER_POWERS_OF_TEN[] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull,
+                                           1000000ull, 10000000ull, 100000000ull, 1000000000ull };
+
+const char LOWER_DIGITS[] = "0123456789abcdef";
+const char UPPER_DIGITS[] = "0123456789ABCDEF";
+
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+/* bounded writer into the caller's buffer; always leaves room for the NUL */
+struct ncurses_field_format::output_t
+{
+    output_t(char * out_buf, size_t out_buf_size)
+      : buf(out_buf),
+        buf_size(out_buf_size),
+        len(0)
+    { }
+
+    void put(const char * text, size_t text_len)
+    {
+        if (0 == text_len)
+        {
+            return;
+        }
+
+        size_t available = buf_size - 1 - len;
+        size_t num_chars = text_len < available ? text_len : available;
+        memcpy(buf + len, text, num_chars);
+        len += num_chars;
+    }
+
+    void put(const std::string& text)
+    {
+        put(text.data(), text.size());
+    }
+
+    void fill(char fill_char, size_t count)
+    {
+        size_t available = buf_size - 1 - len;
+        size_t num_chars = count < available ? count : available;
+        memset(buf + len, fill_char, num_chars);
+        len += num_chars;
+    }
+
+    size_t finish(void)
+    {
+        buf[len] = '\0';
+        return len;
+    }
+
+    char *                                                    buf;
+    size_t                                                    buf_size;
+    size_t                                                    len;
+};
+
+ncurses_field_format::ncurses_field_format(void)
+  : m_compiled(false),
+    m_has_conversion(false)
+{
+    memset(&m_conversion, 0, sizeof(m_conversion));
+}
+
+ncurses_field_format::~ncurses_field_format(void)
+{ }
+
+bool ncurses_field_format::compile(const std::string& format_str, ncurses_field_type_e field_type)
+{
+    m_compiled = false;
+    m_has_conversion = false;
+    m_prefix.clear();
+    m_suffix.clear();
+    m_fallback_spec.clear();
+
+    std::string * literal = &m_prefix;
+    size_t idx = 0;
+
+    while (idx < format_str.size())
+    {
+        char ch = format_str[idx++];
+        if ('%' != ch)
+        {
+            literal->push_back(ch);
+            continue;
+        }
+
+        if (idx >= format_str.size())
+        {
+            return false;
+        }
+
+        if ('%' == format_str[idx])
+        {
+            literal->push_back('%');
+            idx++;
+            continue;
+        }
+
+        /* a field formats exactly one value */
+        if (m_has_conversion)
+        {
+            return false;
+        }
+
+        conversion_t conversion;
+        memset(&conversion, 0, sizeof(conversion));
+        conversion.precision = -1;
+
+        size_t spec_start = idx - 1;
+        bool parsing_flags = true;
+        while (parsing_flags && idx < format_str.size())
+        {
+            switch (format_str[idx])
+            {
+            case '-': conversion.left_justify = true;   idx++; break;
+            case '+': conversion.force_sign = true;     idx++; break;
+            case ' ': conversion.space_sign = true;     idx++; break;
+            case '0': conversion.zero_pad = true;       idx++; break;
+            case '#': conversion.alternate_form = true; idx++; break;
+            default:  parsing_flags = false;                   break;
+            }
+        }
+
+        while (idx < format_str.size() && isdigit(static_cast<unsigned char>(format_str[idx])))
+        {
+            conversion.width = conversion.width * 10 + (format_str[idx++] - '0');
+        }
+
+        if (idx < format_str.size() && '.' == format_str[idx])
+        {
+            idx++;
+            conversion.precision = 0;
+            while (idx < format_str.size() && isdigit(static_cast<unsigned char>(format_str[idx])))
+            {
+                conversion.precision = conversion.precision * 10 + (format_str[idx++] - '0');
+            }
+        }
+
+        /* the value type is known, so length modifiers carry no information */
+        size_t spec_len_before_modifiers = idx - spec_start;
+        while (idx < format_str.size() && strchr("hlLqjzt", format_str[idx]) != nullptr)
+        {
+            idx++;
+        }
+
+        /* '*' widths and precisions would need extra arguments and are rejected here */
+        if (idx >= format_str.size() ||
+            !specifier_matches_type(format_str[idx], field_type))
+        {
+            return false;
+        }
+
+        conversion.specifier = format_str[idx++];
+
+        m_fallback_spec = format_str.substr(spec_start, spec_len_before_modifiers);
+        m_fallback_spec.push_back(conversion.specifier);
+
+        m_conversion = conversion;
+        m_has_conversion = true;
+        literal = &m_suffix;
+    }
+
+    m_compiled = true;
+    return m_compiled;
+}
+
+size_t ncurses_field_format::render(const std::string& field_val, char * buf, size_t buf_size) const
+{
+    return render_text(field_val.data(), field_val.size(), buf, buf_size);
+}
+
+size_t ncurses_field_format::render(int32_t field_val, char * buf, size_t buf_size) const
+{
+    /* printf reads the same bits as an unsigned int for the unsigned conversions */
+    if ('d' == m_conversion.specifier || 'i' == m_conversion.specifier)
+    {
+        return render_signed(field_val, buf, buf_size);
+    }
+    else
+    {
+        return render_unsigned(static_cast<uint32_t>(field_val), buf, buf_size);
+    }
+}
+
+size_t ncurses_field_format::render(uint32_t field_val, char * buf, size_t buf_size) const
+{
+    /* printf reads the same bits as an int for the signed conversions */
+    if ('d' == m_conversion.specifier || 'i' == m_conversion.specifier)
+    {
+        return render_signed(static_cast<int32_t>(field_val), buf, buf_size);
+    }
+    else
+    {
+        return render_unsigned(field_val, buf, buf_size);
+    }
+}
+
+size_t ncurses_field_format::render(float field_val, char * buf, size_t buf_size) const
+{
+    /* printf promotes float arguments to double as well */
+    return render_floating(field_val, buf, buf_size);
+}
+
+size_t ncurses_field_format::render(double field_val, char * buf, size_t buf_size) const
+{
+    return render_floating(field_val, buf, buf_size);
+}
+
+size_t ncurses_field_format::render(int64_t field_val, char * buf, size_t buf_size) const
+{
+    if ('d' == m_conversion.specifier || 'i' == m_conversion.specifier)
+    {
+        return render_signed(field_val, buf, buf_size);
+    }
+    else
+    {
+        return render_unsigned(static_cast<uint64_t>(field_val), buf, buf_size);
+    }
+}
+
+size_t ncurses_field_format::render(uint64_t field_val, char * buf, size_t buf_size) const
+{
+    if ('d' == m_conversion.specifier || 'i' == m_conversion.specifier)
+    {
+        return render_signed(static_cast<int64_t>(field_val), buf, buf_size);
+    }
+    else
+    {
+        return render_unsigned(field_val, buf, buf_size);
+    }
+}
+
+size_t ncurses_field_format::render(bool field_val, char * buf, size_t buf_size) const
+{
+    if ('s' == m_conversion.specifier)
+    {
+        return field_val ? render_text("true", 4, buf, buf_size) : render_text("false", 5, buf, buf_size);
+    }
+    else
+    {
+        return render_unsigned(field_val ? 1 : 0, buf, buf_size);
+    }
+}
+
+size_t ncurses_field_format::render_text(const char * text, size_t text_len, char * buf, size_t buf_size) const
+{
+    if (0 == buf_size)
+    {
+        return 0;
+    }
+
+    output_t out(buf, buf_size);
+    out.put(m_prefix);
+
+    if (m_has_conversion)
+    {
+        if (m_conversion.precision >= 0 &&
+            static_cast<size_t>(m_conversion.precision) < text_len)
+        {
+            text_len = m_conversion.precision;
+        }
+
+        put_padded(out, nullptr, 0, 0, text, text_len, false);
+    }
+
+    out.put(m_suffix);
+    return out.finish();
+}
+
+size_t ncurses_field_format::render_signed(int64_t field_val, char * buf, size_t buf_size) const
+{
+    if (0 == buf_size)
+    {
+        return 0;
+    }
+
+    output_t out(buf, buf_size);
+    out.put(m_prefix);
+
+    if (m_has_conversion)
+    {
+        /* negate in unsigned arithmetic so that the minimum value does not overflow */
+        bool negative = field_val < 0;
+        uint64_t magnitude = negative ? (~static_cast<uint64_t>(field_val) + 1) : static_cast<uint64_t>(field_val);
+        put_integer(out, negative, magnitude);
+    }
+
+    out.put(m_suffix);
+    return out.finish();
+}
+
+size_t ncurses_field_format::render_unsigned(uint64_t field_val, char * buf, size_t buf_size) const
+{
+    if (0 == buf_size)
+    {
+        return 0;
+    }
+
+    output_t out(buf, buf_size);
+    out.put(m_prefix);
+
+    if (m_has_conversion)
+    {
+        if ('c' == m_conversion.specifier)
+        {
+            char ch = static_cast<char>(field_val);
+            put_padded(out, nullptr, 0, 0, &ch, 1, false);
+        }
+        else
+        {
+            put_integer(out, false, field_val);
+        }
+    }
+
+    out.put(m_suffix);
+    return out.finish();
+}
+
+size_t ncurses_field_format::render_floating(double field_val, char * buf, size_t buf_size) const
+{
+    if (0 == buf_size)
+    {
+        return 0;
+    }
+
+    output_t out(buf, buf_size);
+    out.put(m_prefix);
+
+    if (m_has_conversion)
+    {
+        bool rendered = false;
+        if ('f' == m_conversion.specifier || 'F' == m_conversion.specifier)
+        {
+            rendered = put_fixed_point(out, field_val);
+        }
+
+        if (!rendered)
+        {
+            size_t available = out.buf_size - out.len;
+            int num_chars = snprintf(out.buf + out.len, available, m_fallback_spec.c_str(), field_val);
+            if (num_chars > 0)
+            {
+                out.len += static_cast<size_t>(num_chars) < available ? num_chars : available - 1;
+            }
+        }
+    }
+
+    out.put(m_suffix);
+    return out.finish();
+}
+
+void ncurses_field_format::put_integer(output_t& out, bool negative, uint64_t magnitude) const
+{
+    uint32_t base = 10;
+    const char * digit_chars = LOWER_DIGITS;
+
+    switch (m_conversion.specifier)
+    {
+    case 'o':
+        base = 8;
+        break;
+    case 'x':
+        base = 16;
+        break;
+    case 'X':
+        base = 16;
+        digit_chars = UPPER_DIGITS;
+        break;
+    default:
+        break;
+    }
+
+    /* digits are produced least significant first */
+    char reversed_digits[24];
+    size_t num_digits = 0;
+    if (!(0 == magnitude && 0 == m_conversion.precision))
+    {
+        do
+        {
+            reversed_digits[num_digits++] = digit_chars[magnitude % base];
+            magnitude /= base;
+        } while (magnitude > 0);
+    }
+
+    char digits[24];
+    for (size_t i = 0; i < num_digits; ++i)
+    {
+        digits[i] = reversed_digits[num_digits - 1 - i];
+    }
+
+    char prefix[2];
+    size_t prefix_len = 0;
+    bool is_signed_conversion = ('d' == m_conversion.specifier || 'i' == m_conversion.specifier);
+
+    if (is_signed_conversion)
+    {
+        if (negative)
+        {
+            prefix[prefix_len++] = '-';
+        }
+        else if (m_conversion.force_sign)
+        {
+            prefix[prefix_len++] = '+';
+        }
+        else if (m_conversion.space_sign)
+        {
+            prefix[prefix_len++] = ' ';
+        }
+    }
+
+    size_t num_zeros = 0;
+    if (m_conversion.precision > 0 &&
+        static_cast<size_t>(m_conversion.precision) > num_digits)
+    {
+        num_zeros = m_conversion.precision - num_digits;
+    }
+
+    if (m_conversion.alternate_form)
+    {
+        if ('o' == m_conversion.specifier &&
+            0 == num_zeros &&
+            (0 == num_digits || '0' != digits[0]))
+        {
+            num_zeros = 1;
+        }
+        else if (('x' == m_conversion.specifier || 'X' == m_conversion.specifier) &&
+                 num_digits > 0 &&
+                 !(1 == num_digits && '0' == digits[0]))
+        {
+            prefix[prefix_len++] = '0';
+            prefix[prefix_len++] = m_conversion.specifier;
+        }
+    }
+
+    /* the '0' flag is ignored for integers when a precision is given */
+    put_padded(out, prefix, prefix_len, num_zeros, digits, num_digits, m_conversion.zero_pad && m_conversion.precision < 0);
+}
+
+bool ncurses_field_format::put_fixed_point(output_t& out, double field_val) const
+{
+    int precision = m_conversion.precision < 0 ? DEFAULT_FLOAT_PRECISION : m_conversion.precision;
+    if (!std::isfinite(field_val) ||
+        precision > MAX_FAST_FIXED_PRECISION)
+    {
+        return false;
+    }
+
+    bool negative = std::signbit(field_val);
+    double scaled = std::fabs(field_val) * POWERS_OF_TEN[precision];
+    if (scaled >= MAX_FAST_FIXED_SCALED_VALUE)
+    {
+        return false;
+    }
+
+    /* the scaling multiply is off by at most half an ulp; if that could move the
+     *  value across a rounding tie, let printf round the exact binary value */
+    double whole = std::floor(scaled);
+    double fraction = scaled - whole;
+    if (std::fabs(fraction - 0.5) <= scaled * 4 * DBL_EPSILON)
+    {
+        return false;
+    }
+
+    uint64_t rounded = static_cast<uint64_t>(whole) + (fraction > 0.5 ? 1 : 0);
+    uint64_t integer_part = rounded / INTEGER_POWERS_OF_TEN[precision];
+    uint64_t fraction_part = rounded % INTEGER_POWERS_OF_TEN[precision];
+
+    char reversed_digits[24];
+    size_t num_integer_digits = 0;
+    do
+    {
+        reversed_digits[num_integer_digits++] = '0' + (integer_part % 10);
+        integer_part /= 10;
+    } while (integer_part > 0);
+
+    char body[48];
+    size_t body_len = 0;
+    for (size_t i = 0; i < num_integer_digits; ++i)
+    {
+        body[body_len++] = reversed_digits[num_integer_digits - 1 - i];
+    }
+
+    if (precision > 0 || m_conversion.alternate_form)
+    {
+        body[body_len++] = '.';
+    }
+
+    for (int i = precision - 1; i >= 0; --i)
+    {
+        body[body_len + i] = '0' + (fraction_part % 10);
+        fraction_part /= 10;
+    }
+    body_len += precision;
+
+    char prefix[1];
+    size_t prefix_len = 0;
+    if (negative)
+    {
+        prefix[prefix_len++] = '-';
+    }
+    else if (m_conversion.force_sign)
+    {
+        prefix[prefix_len++] = '+';
+    }
+    else if (m_conversion.space_sign)
+    {
+        prefix[prefix_len++] = ' ';
+    }
+
+    put_padded(out, prefix, prefix_len, 0, body, body_len, m_conversion.zero_pad);
+    return true;
+}
+
+void ncurses_field_format::put_padded(output_t& out, const char * prefix, size_t prefix_len, size_t num_zeros, const char * body, size_t body_len, bool zero_fill) const
+{
+    size_t content_len = prefix_len + num_zeros + body_len;
+    size_t padding = 0;
+    if (m_conversion.width > 0 &&
+        static_cast<size_t>(m_conversion.width) > content_len)
+    {
+        padding = m_conversion.width - content_len;
+    }
+
+    if (m_conversion.left_justify)
+    {
+        out.put(prefix, prefix_len);
+        out.fill('0', num_zeros);
+        out.put(body, body_len);
+        out.fill(' ', padding);
+    }
+    else if (zero_fill)
+    {
+        out.put(prefix, prefix_len);
+        out.fill('0', padding + num_zeros);
+        out.put(body, body_len);
+    }
+    else
+    {
+        out.fill(' ', padding);
+        out.put(prefix, prefix_len);
+        out.fill('0', num_zeros);
+        out.put(body, body_len);
+    }
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,209 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_field_table.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Name-indexed storage for the fields of an ncurses_window.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the ncurses_field_table. The hash index uses linear probing over
+ *  a power-of-two slot array that is kept at most half full; fields are never
+ *  removed individually, so no tombstones are needed.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstring>
+
+#include "ncurses_field_table.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const size_t INITIAL_FIELD_TABLE_SLOTS = 16;
+
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+const uint64_t FNV_PRIME = 1099511628211ull;
+
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_field_table::ncurses_field_table(void)
+{
+    rebuild_slots(INITIAL_FIELD_TABLE_SLOTS);
+}
+
+ncurses_field_table::~ncurses_field_table(void)
+{ }
+
+bool ncurses_field_table::insert(std::string field_name, std::unique_ptr<ncurses_field_base> field)
+{
+    bool ret = false;
+
+    if (nullptr != field)
+    {
+        uint64_t hash = hash_name(field_name.data(), field_name.size());
+        size_t slot_idx = find_slot(field_name.data(), field_name.size(), hash);
+        if (EMPTY_SLOT == m_slots[slot_idx].entry_idx)
+        {
+            entry_t entry;
+            entry.hash = hash;
+            entry.name = std::move(field_name);
+            entry.field = std::move(field);
+            m_entries.push_back(std::move(entry));
+
+            m_slots[slot_idx].hash_tag = static_cast<uint32_t>(hash >> 32);
+            m_slots[slot_idx].entry_idx = static_cast<uint32_t>(m_entries.size() - 1);
+
+            /* keep the index at most half full so that probe sequences stay short */
+            if (m_entries.size() * 2 > m_slots.size())
+            {
+                rebuild_slots(m_slots.size() * 2);
+            }
+
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+ncurses_field_base * ncurses_field_table::find(const std::string& field_name) const
+{
+    return find(field_name.data(), field_name.size());
+}
+
+ncurses_field_base * ncurses_field_table::find(const char * field_name, size_t field_name_len) const
+{
+    size_t slot_idx = find_slot(field_name, field_name_len, hash_name(field_name, field_name_len));
+    uint32_t entry_idx = m_slots[slot_idx].entry_idx;
+
+    if (EMPTY_SLOT != entry_idx)
+    {
+        return m_entries[entry_idx].field.get();
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+void ncurses_field_table::clear(void)
+{
+    m_entries.clear();
+    rebuild_slots(INITIAL_FIELD_TABLE_SLOTS);
+}
+
+uint64_t ncurses_field_table::hash_name(const char * field_name, size_t field_name_len)
+{
+    /* FNV-1a; field names are short, so a simple byte-wise hash is sufficient */
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < field_name_len; ++i)
+    {
+        hash ^= static_cast<unsigned char>(field_name[i]);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+size_t ncurses_field_table::find_slot(const char * field_name, size_t field_name_len, uint64_t hash) const
+{
+    size_t slot_mask = m_slots.size() - 1;
+    size_t slot_idx = static_cast<size_t>(hash) & slot_mask;
+    uint32_t hash_tag = static_cast<uint32_t>(hash >> 32);
+
+    while (EMPTY_SLOT != m_slots[slot_idx].entry_idx)
+    {
+        const slot_t& slot = m_slots[slot_idx];
+        if (hash_tag == slot.hash_tag)
+        {
+            const entry_t& entry = m_entries[slot.entry_idx];
+            if (hash == entry.hash &&
+                field_name_len == entry.name.size() &&
+                0 == memcmp(field_name, entry.name.data(), field_name_len))
+            {
+                break;
+            }
+        }
+
+        slot_idx = (slot_idx + 1) & slot_mask;
+    }
+
+    return slot_idx;
+}
+
+void ncurses_field_table::rebuild_slots(size_t num_slots)
+{
+    slot_t empty_slot;
+    empty_slot.hash_tag = 0;
+    empty_slot.entry_idx = EMPTY_SLOT;
+    m_slots.assign(num_slots, empty_slot);
+
+    size_t slot_mask = num_slots - 1;
+    for (size_t entry_idx = 0; entry_idx < m_entries.size(); ++entry_idx)
+    {
+        size_t slot_idx = static_cast<size_t>(m_entries[entry_idx].hash) & slot_mask;
+        while (EMPTY_SLOT != m_slots[slot_idx].entry_idx)
+        {
+            slot_idx = (slot_idx + 1) & slot_mask;
+        }
+
+        m_slots[slot_idx].hash_tag = static_cast<uint32_t>(m_entries[entry_idx].hash >> 32);
+        m_slots[slot_idx].entry_idx = static_cast<uint32_t>(entry_idx);
+    }
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,665 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_layout.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Parses layout files that describe windows and their fields.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the layout file parser and builds windows from the parsed
+ *  descriptions.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ncurses_layout.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const char DIGEST_TOKEN_SEPARATOR = '\x1f';
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+struct layout_name_t
+{
+    const char *                                              name;
+    int                                                       value;
+};
+
+const layout_name_t FIELD_TYPE_NAMES[] = {
+    { "string", NCURSES_CPP_FIELD_TYPE_STRING },
+    { "int32", NCURSES_CPP_FIELD_TYPE_INT32 },
+    { "uint32", NCURSES_CPP_FIELD_TYPE_UINT32 },
+    { "float", NCURSES_CPP_FIELD_TYPE_FLOAT },
+    { "double", NCURSES_CPP_FIELD_TYPE_DOUBLE },
+    { "int64", NCURSES_CPP_FIELD_TYPE_INT64 },
+    { "uint64", NCURSES_CPP_FIELD_TYPE_UINT64 },
+    { "bool", NCURSES_CPP_FIELD_TYPE_BOOL },
+    { "nanoseconds", NCURSES_CPP_FIELD_TYPE_NANOSECONDS },
+    { "microseconds", NCURSES_CPP_FIELD_TYPE_MICROSECONDS },
+    { "milliseconds", NCURSES_CPP_FIELD_TYPE_MILLISECONDS },
+    { "seconds", NCURSES_CPP_FIELD_TYPE_SECONDS }
+};
+
+const layout_name_t COLOR_NAMES[] = {
+    { "default", NCURSES_CPP_TXT_COLOR_DEFAULT },
+    { "black", NCURSES_CPP_TXT_COLOR_BLACK },
+    { "red", NCURSES_CPP_TXT_COLOR_RED },
+    { "green", NCURSES_CPP_TXT_COLOR_GREEN },
+    { "yellow", NCURSES_CPP_TXT_COLOR_YELLOW },
+    { "blue", NCURSES_CPP_TXT_COLOR_BLUE },
+    { "magenta", NCURSES_CPP_TXT_COLOR_MAGENTA },
+    { "cyan", NCURSES_CPP_TXT_COLOR_CYAN },
+    { "white", NCURSES_CPP_TXT_COLOR_WHITE }
+};
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static bool find_name(const layout_name_t * names, size_t num_names, const std::string& token, int& value)
+{
+    for (size_t name_idx = 0; name_idx < num_names; ++name_idx)
+    {
+        if (token == names[name_idx].name)
+        {
+            value = names[name_idx].value;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* splits a line into tokens; fails on an unterminated quoted token */
+static bool tokenize_line(const char * line, const char * line_end, std::vector<std::string>& tokens)
+{
+    tokens.clear();
+
+    const char * pos = line;
+    while (pos < line_end)
+    {
+        if (' ' == *pos || '\t' == *pos || '\r' == *pos)
+        {
+            pos++;
+        }
+        else if ('#' == *pos)
+        {
+            break;
+        }
+        else if ('"' == *pos)
+        {
+            tokens.push_back(std::string());
+            for (pos++; pos < line_end && '"' != *pos; pos++)
+            {
+                if ('\\' == *pos && pos + 1 < line_end)
+                {
+                    pos++;
+                }
+                tokens.back().push_back(*pos);
+            }
+
+            if (pos == line_end)
+            {
+                return false;
+            }
+            pos++;
+        }
+        else
+        {
+            const char * token_start = pos;
+            while (pos < line_end && ' ' != *pos && '\t' != *pos && '\r' != *pos && '#' != *pos)
+            {
+                pos++;
+            }
+            tokens.push_back(std::string(token_start, pos));
+        }
+    }
+
+    return true;
+}
+
+static bool parse_integer(const std::string& token, int64_t min_val, int64_t max_val, int64_t& value)
+{
+    char * end = nullptr;
+    errno = 0;
+    long long parsed = strtoll(token.c_str(), &end, 0);
+    if (0 != errno || token.empty() || '\0' != *end || parsed < min_val || parsed > max_val)
+    {
+        return false;
+    }
+
+    value = parsed;
+    return true;
+}
+
+static bool parse_uint32(const std::string& token, uint32_t& value)
+{
+    int64_t parsed = 0;
+    bool ret = parse_integer(token, 0, UINT32_MAX, parsed);
+    value = static_cast<uint32_t>(parsed);
+    return ret;
+}
+
+/* N, P% or P%+N / P%-N */
+static bool parse_extent(const std::string& token, ncurses_window_extent_t& extent)
+{
+    int64_t percent = 0;
+    int64_t offset = 0;
+
+    size_t percent_pos = token.find('%');
+    if (std::string::npos == percent_pos)
+    {
+        if (!parse_integer(token, 0, INT16_MAX, offset))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        std::string offset_token = token.substr(percent_pos + 1);
+        if (!parse_integer(token.substr(0, percent_pos), 0, 100, percent) ||
+            (!offset_token.empty() &&
+             (('+' != offset_token[0] && '-' != offset_token[0]) ||
+              !parse_integer(offset_token, INT16_MIN, INT16_MAX, offset))))
+        {
+            return false;
+        }
+    }
+
+    extent.fraction = static_cast<float>(percent) / 100.0f;
+    extent.offset = static_cast<int32_t>(offset);
+    return true;
+}
+
+static bool parse_value(ncurses_field_type_e field_type, const std::string& token, ncurses_field_value_t& field_val)
+{
+    bool ret = true;
+    int64_t int_val = 0;
+    char * end = nullptr;
+
+    field_val.type = field_type;
+    field_val.uint64_val = 0;
+    field_val.str_len = 0;
+
+    errno = 0;
+    switch (field_type)
+    {
+        case NCURSES_CPP_FIELD_TYPE_STRING:
+            ncurses_field_value_traits<std::string>::store(field_val, token);
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_INT32:
+            ret = parse_integer(token, INT32_MIN, INT32_MAX, int_val);
+            field_val.int32_val = static_cast<int32_t>(int_val);
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_UINT32:
+            ret = parse_integer(token, 0, UINT32_MAX, int_val);
+            field_val.uint32_val = static_cast<uint32_t>(int_val);
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_FLOAT:
+            field_val.float_val = strtof(token.c_str(), &end);
+            ret = !token.empty() && '\0' == *end && 0 == errno;
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_DOUBLE:
+            field_val.double_val = strtod(token.c_str(), &end);
+            ret = !token.empty() && '\0' == *end && 0 == errno;
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_UINT64:
+            /* strtoull() accepts a leading minus sign, which is never wanted here */
+            field_val.uint64_val = strtoull(token.c_str(), &end, 0);
+            ret = !token.empty() && '-' != token[0] && '\0' == *end && 0 == errno;
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_BOOL:
+            ret = "true" == token || "false" == token || "1" == token || "0" == token;
+            field_val.bool_val = "true" == token || "1" == token;
+            break;
+
+        case NCURSES_CPP_FIELD_TYPE_INT64:
+        case NCURSES_CPP_FIELD_TYPE_NANOSECONDS:
+        case NCURSES_CPP_FIELD_TYPE_MICROSECONDS:
+        case NCURSES_CPP_FIELD_TYPE_MILLISECONDS:
+        case NCURSES_CPP_FIELD_TYPE_SECONDS:
+            ret = parse_integer(token, INT64_MIN, INT64_MAX, int_val);
+            field_val.int64_val = int_val;
+            break;
+
+        default:
+            ret = false;
+            break;
+    }
+
+    return ret;
+}
+
+template <typename T>
+static bool add_layout_field(ncurses_window& window, const ncurses_layout_field_t& field_desc)
+{
+    T default_val;
+    ncurses_field_value_traits<T>::load(field_desc.default_val, default_val);
+
+    if (!window.add_field<T>(field_desc.x, field_desc.y, field_desc.name, field_desc.format, default_val))
+    {
+        return false;
+    }
+
+    if (field_desc.bands.empty())
+    {
+        return true;
+    }
+
+    std::vector<typename ncurses_field<T>::threshold_band_t> bands;
+    bands.reserve(field_desc.bands.size());
+    for (auto iter = field_desc.bands.begin(); iter != field_desc.bands.end(); ++iter)
+    {
+        T low;
+        T high;
+        ncurses_field_value_traits<T>::load(iter->low, low);
+        ncurses_field_value_traits<T>::load(iter->high, high);
+        bands.push_back(std::make_pair(std::make_pair(low, high), iter->color));
+    }
+
+    return window.set_field_thresholds<T>(field_desc.name, bands);
+}
+
+static bool add_any_field(ncurses_window& window, const ncurses_layout_field_t& field_desc)
+{
+    switch (field_desc.type)
+    {
+        case NCURSES_CPP_FIELD_TYPE_STRING:
+            return add_layout_field<std::string>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_INT32:
+            return add_layout_field<int32_t>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_UINT32:
+            return add_layout_field<uint32_t>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_FLOAT:
+            return add_layout_field<float>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_DOUBLE:
+            return add_layout_field<double>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_INT64:
+            return add_layout_field<int64_t>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_UINT64:
+            return add_layout_field<uint64_t>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_BOOL:
+            return add_layout_field<bool>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_NANOSECONDS:
+            return add_layout_field<std::chrono::nanoseconds>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_MICROSECONDS:
+            return add_layout_field<std::chrono::microseconds>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_MILLISECONDS:
+            return add_layout_field<std::chrono::milliseconds>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_SECONDS:
+            return add_layout_field<std::chrono::seconds>(window, field_desc);
+        case NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES:
+            return window.add_sparkline<float>(field_desc.x, field_desc.y, field_desc.name, field_desc.width, field_desc.history_len).is_valid();
+        case NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES:
+            return window.add_sparkline<double>(field_desc.x, field_desc.y, field_desc.name, field_desc.width, field_desc.history_len).is_valid();
+    }
+
+    return false;
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_layout::ncurses_layout(void)
+  : m_in_window(false)
+{ }
+
+ncurses_layout::~ncurses_layout(void)
+{ }
+
+bool ncurses_layout::parse_file(const std::string& layout_path)
+{
+    std::string layout_text;
+
+    int fd = open(layout_path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat layout_stat;
+    if (fd < 0 ||
+        0 != fstat(fd, &layout_stat))
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        m_windows.clear();
+        m_error = "unable to open " + layout_path;
+        return false;
+    }
+
+    /* read the whole file at once; it may still grow while it is being read */
+    layout_text.resize(static_cast<size_t>(layout_stat.st_size) + 1);
+    size_t text_len = 0;
+    ssize_t bytes_read = 0;
+    while ((bytes_read = read(fd, &layout_text[text_len], layout_text.size() - text_len)) > 0)
+    {
+        text_len += static_cast<size_t>(bytes_read);
+        if (text_len == layout_text.size())
+        {
+            layout_text.resize(layout_text.size() * 2);
+        }
+    }
+    close(fd);
+    layout_text.resize(text_len);
+
+    return parse(layout_text);
+}
+
+bool ncurses_layout::parse(const std::string& layout_text)
+{
+    m_windows.clear();
+    m_in_window = false;
+    m_error.clear();
+
+    std::vector<std::string> tokens;
+    const char * line = layout_text.data();
+    const char * text_end = line + layout_text.size();
+    for (size_t line_num = 1; line < text_end; ++line_num)
+    {
+        const char * line_end = static_cast<const char *>(memchr(line, '\n', text_end - line));
+        if (nullptr == line_end)
+        {
+            line_end = text_end;
+        }
+
+        if (!tokenize_line(line, line_end, tokens))
+        {
+            set_error(line_num, "unterminated quote");
+        }
+        else if (!tokens.empty())
+        {
+            parse_line(tokens, line_num);
+        }
+
+        if (!m_error.empty())
+        {
+            m_windows.clear();
+            return false;
+        }
+
+        line = line_end + 1;
+    }
+
+    if (m_in_window)
+    {
+        m_error = "window " + m_windows.back().name + " has no end";
+        m_windows.clear();
+        return false;
+    }
+
+    return true;
+}
+
+const ncurses_layout_window_t * ncurses_layout::find_window(const std::string& window_name) const
+{
+    for (auto iter = m_windows.begin(); iter != m_windows.end(); ++iter)
+    {
+        if (window_name == iter->name)
+        {
+            return &(*iter);
+        }
+    }
+
+    return nullptr;
+}
+
+bool ncurses_layout::set_error(size_t line_num, const std::string& message)
+{
+    m_error = "line " + std::to_string(line_num) + ": " + message;
+    return false;
+}
+
+bool ncurses_layout::parse_line(std::vector<std::string>& tokens, size_t line_num)
+{
+    const std::string& keyword = tokens[0];
+
+    if ("window" == keyword)
+    {
+        ncurses_layout_window_t window_desc;
+        if (m_in_window)
+        {
+            return set_error(line_num, "window " + m_windows.back().name + " has no end");
+        }
+        else if (tokens.size() < 6 || tokens.size() > 7 ||
+                 (7 == tokens.size() && "no_outline" != tokens[6]))
+        {
+            return set_error(line_num, "expected: window NAME HEIGHT WIDTH ROW COLUMN [no_outline]");
+        }
+        else if (!parse_extent(tokens[2], window_desc.geometry.height) ||
+                 !parse_extent(tokens[3], window_desc.geometry.width) ||
+                 !parse_extent(tokens[4], window_desc.geometry.row) ||
+                 !parse_extent(tokens[5], window_desc.geometry.column))
+        {
+            return set_error(line_num, "invalid window geometry");
+        }
+        else if (nullptr != find_window(tokens[1]))
+        {
+            return set_error(line_num, "duplicate window " + tokens[1]);
+        }
+
+        window_desc.name = tokens[1];
+        window_desc.outline = 6 == tokens.size();
+        m_windows.push_back(std::move(window_desc));
+        m_in_window = true;
+    }
+    else if (!m_in_window)
+    {
+        return set_error(line_num, keyword + " outside of a window");
+    }
+    else if ("title" == keyword)
+    {
+        if (2 != tokens.size())
+        {
+            return set_error(line_num, "expected: title TEXT");
+        }
+
+        m_windows.back().title = tokens[1];
+    }
+    else if ("field" == keyword)
+    {
+        ncurses_layout_field_t field_desc;
+        int field_type = 0;
+        if (7 != tokens.size())
+        {
+            return set_error(line_num, "expected: field TYPE NAME X Y FORMAT DEFAULT");
+        }
+        else if (!find_name(FIELD_TYPE_NAMES, sizeof(FIELD_TYPE_NAMES) / sizeof(FIELD_TYPE_NAMES[0]), tokens[1], field_type))
+        {
+            return set_error(line_num, "unknown field type " + tokens[1]);
+        }
+        else if (!parse_uint32(tokens[3], field_desc.x) ||
+                 !parse_uint32(tokens[4], field_desc.y))
+        {
+            return set_error(line_num, "invalid field position");
+        }
+        else if (!parse_value(static_cast<ncurses_field_type_e>(field_type), tokens[6], field_desc.default_val))
+        {
+            return set_error(line_num, "invalid " + tokens[1] + " value " + tokens[6]);
+        }
+
+        field_desc.type = static_cast<ncurses_field_type_e>(field_type);
+        field_desc.name = tokens[2];
+        field_desc.format = tokens[5];
+        field_desc.width = 0;
+        field_desc.history_len = 0;
+        m_windows.back().fields.push_back(std::move(field_desc));
+    }
+    else if ("band" == keyword)
+    {
+        ncurses_layout_band_t band;
+        int band_color = 0;
+        std::vector<ncurses_layout_field_t>& fields = m_windows.back().fields;
+        if (4 != tokens.size())
+        {
+            return set_error(line_num, "expected: band LOW HIGH COLOR");
+        }
+        else if (fields.empty() ||
+                 fields.back().type > NCURSES_CPP_FIELD_TYPE_SECONDS)
+        {
+            return set_error(line_num, "band does not follow a field");
+        }
+        else if (!parse_value(fields.back().type, tokens[1], band.low) ||
+                 !parse_value(fields.back().type, tokens[2], band.high))
+        {
+            return set_error(line_num, "invalid band range");
+        }
+        else if (!find_name(COLOR_NAMES, sizeof(COLOR_NAMES) / sizeof(COLOR_NAMES[0]), tokens[3], band_color))
+        {
+            return set_error(line_num, "unknown color " + tokens[3]);
+        }
+
+        band.color = static_cast<ncurses_cpp_text_colors_e>(band_color);
+        fields.back().bands.push_back(band);
+    }
+    else if ("sparkline" == keyword)
+    {
+        ncurses_layout_field_t field_desc;
+        int64_t history_len = 0;
+        if (7 != tokens.size() ||
+            ("float" != tokens[1] && "double" != tokens[1]))
+        {
+            return set_error(line_num, "expected: sparkline float|double NAME X Y WIDTH HISTORY");
+        }
+        else if (!parse_uint32(tokens[3], field_desc.x) ||
+                 !parse_uint32(tokens[4], field_desc.y) ||
+                 !parse_uint32(tokens[5], field_desc.width) ||
+                 !parse_integer(tokens[6], 1, INT64_MAX, history_len))
+        {
+            return set_error(line_num, "invalid sparkline geometry");
+        }
+
+        field_desc.type = "float" == tokens[1] ? NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES : NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES;
+        field_desc.name = tokens[2];
+        field_desc.default_val.type = field_desc.type;
+        field_desc.default_val.uint64_val = 0;
+        field_desc.history_len = static_cast<size_t>(history_len);
+        m_windows.back().fields.push_back(std::move(field_desc));
+    }
+    else if ("end" == keyword)
+    {
+        if (1 != tokens.size())
+        {
+            return set_error(line_num, "expected: end");
+        }
+
+        m_in_window = false;
+    }
+    else
+    {
+        return set_error(line_num, "unknown statement " + keyword);
+    }
+
+    /* the digest ignores the whitespace and comments around the tokens */
+    std::string& digest = m_windows.back().digest;
+    for (auto iter = tokens.begin(); iter != tokens.end(); ++iter)
+    {
+        digest += *iter;
+        digest += DIGEST_TOKEN_SEPARATOR;
+    }
+    digest += '\n';
+
+    return true;
+}
+
+std::shared_ptr<ncurses_window> ncurses_layout::build_window(const ncurses_layout_window_t& window_desc, const ncurses_window * previous_window, bool frame_commit_mode, std::string& error)
+{
+    std::shared_ptr<ncurses_window> window(new ncurses_window(window_desc.name, window_desc.outline));
+    window->set_frame_commit_mode(frame_commit_mode);
+
+    if (!window->create_window(window_desc.geometry))
+    {
+        error = "window " + window_desc.name + " does not fit on the screen";
+        return nullptr;
+    }
+
+    if (!window_desc.title.empty() &&
+        !window->add_title(window_desc.title))
+    {
+        error = "unable to add the title of window " + window_desc.name;
+        return nullptr;
+    }
+
+    ncurses_field_value_t field_val;
+    for (auto iter = window_desc.fields.begin(); iter != window_desc.fields.end(); ++iter)
+    {
+        if (!add_any_field(*window, *iter))
+        {
+            error = "unable to add field " + iter->name + " to window " + window_desc.name;
+            return nullptr;
+        }
+
+        if (nullptr != previous_window)
+        {
+            const ncurses_field_base * previous_field = previous_window->find_field_base(iter->name.data(), iter->name.size());
+            if (nullptr != previous_field &&
+                previous_field->get_value(field_val) &&
+                field_val.type == iter->type)
+            {
+                window->find_field_base(iter->name.data(), iter->name.size())->apply_update(field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
+            }
+        }
+    }
+
+    return window;
+}
+
+} /* end ncurses_cpp namespace */
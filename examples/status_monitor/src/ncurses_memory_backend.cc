@@ -0,0 +1,377 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_memory_backend.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend that keeps the screen as a grid of cells.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the in-memory rendering backend. Every window tracks which of its
+ *  rows changed so that staging and committing a frame only copy the rows that
+ *  were actually drawn on, mirroring what curses does for a real terminal.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+
+#include <ncurses.h>
+
+#include "ncurses_memory_backend.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const ncurses_memory_cell_t BLANK_CELL = { ' ', NCURSES_CPP_TXT_COLOR_DEFAULT };
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static bool cells_equal(const ncurses_memory_cell_t& lhs, const ncurses_memory_cell_t& rhs)
+{
+    return lhs.ch == rhs.ch && lhs.color == rhs.color;
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+class ncurses_memory_window : public ncurses_backend_window
+{
+public:
+
+    ncurses_memory_window(ncurses_memory_backend * backend, uint32_t height, uint32_t width, uint32_t begin_y, uint32_t begin_x)
+      : m_backend(backend),
+        m_height(height),
+        m_width(width),
+        m_begin_y(begin_y),
+        m_begin_x(begin_x),
+        m_cells(static_cast<size_t>(height) * width, BLANK_CELL),
+        m_dirty_rows(height, true)
+    { }
+
+    virtual ~ncurses_memory_window(void)
+    {
+        m_backend->release_window(this);
+    }
+
+    bool draw_text(uint32_t x, uint32_t y, const char * text, size_t text_len, ncurses_cpp_text_colors_e text_color) override
+    {
+        if (x >= m_width || y >= m_height)
+        {
+            return false;
+        }
+
+        /* wrap onto the following lines like waddnstr() does */
+        for (size_t i = 0; i < text_len; ++i)
+        {
+            if (x >= m_width)
+            {
+                x = 0;
+                y++;
+                if (y >= m_height)
+                {
+                    return false;
+                }
+            }
+
+            ncurses_memory_cell_t& cell = m_cells[static_cast<size_t>(y) * m_width + x];
+            cell.ch = text[i];
+            cell.color = text_color;
+            m_dirty_rows[y] = true;
+            x++;
+        }
+
+        return true;
+    }
+
+    void draw_outline(void) override
+    {
+        if (m_height < 2 || m_width < 2)
+        {
+            return;
+        }
+
+        for (uint32_t x = 1; x + 1 < m_width; ++x)
+        {
+            set_cell(x, 0, '-');
+            set_cell(x, m_height - 1, '-');
+        }
+
+        for (uint32_t y = 1; y + 1 < m_height; ++y)
+        {
+            set_cell(0, y, '|');
+            set_cell(m_width - 1, y, '|');
+        }
+
+        set_cell(0, 0, '+');
+        set_cell(m_width - 1, 0, '+');
+        set_cell(0, m_height - 1, '+');
+        set_cell(m_width - 1, m_height - 1, '+');
+    }
+
+    void refresh(void) override
+    {
+        if (stage())
+        {
+            m_backend->commit_frame();
+        }
+    }
+
+    bool stage(void) override
+    {
+        bool ret = false;
+
+        for (uint32_t y = 0; y < m_height; ++y)
+        {
+            if (m_dirty_rows[y])
+            {
+                m_backend->stage_cells(this, m_begin_y, m_begin_x, y, &m_cells[static_cast<size_t>(y) * m_width], m_width);
+                m_dirty_rows[y] = false;
+                ret = true;
+            }
+        }
+
+        return ret;
+    }
+
+    void touch(void) override
+    {
+        std::fill(m_dirty_rows.begin(), m_dirty_rows.end(), true);
+    }
+
+private:
+
+    void set_cell(uint32_t x, uint32_t y, char ch)
+    {
+        ncurses_memory_cell_t& cell = m_cells[static_cast<size_t>(y) * m_width + x];
+        cell.ch = ch;
+        cell.color = NCURSES_CPP_TXT_COLOR_DEFAULT;
+        m_dirty_rows[y] = true;
+    }
+
+    ncurses_memory_backend *                                  m_backend;
+    uint32_t                                                  m_height;
+    uint32_t                                                  m_width;
+    uint32_t                                                  m_begin_y;
+    uint32_t                                                  m_begin_x;
+    std::vector<ncurses_memory_cell_t>                        m_cells;
+    std::vector<bool>                                         m_dirty_rows;
+};
+
+ncurses_memory_backend::ncurses_memory_backend(uint32_t rows, uint32_t cols)
+  : m_rows(rows),
+    m_cols(cols),
+    m_requested_rows(rows),
+    m_requested_cols(cols),
+    m_pending_cells(static_cast<size_t>(rows) * cols, BLANK_CELL),
+    m_visible_cells(static_cast<size_t>(rows) * cols, BLANK_CELL),
+    m_pending_dirty_rows(rows, false),
+    m_frame_count(0),
+    m_cells_written(0)
+{ }
+
+ncurses_memory_backend::~ncurses_memory_backend(void)
+{
+    close_screen();
+}
+
+bool ncurses_memory_backend::open_screen(void)
+{
+    if (nullptr == m_screen_window)
+    {
+        m_screen_window.reset(new ncurses_memory_window(this, m_rows, m_cols, 0, 0));
+    }
+
+    return true;
+}
+
+void ncurses_memory_backend::close_screen(void)
+{
+    m_screen_window.reset();
+}
+
+void ncurses_memory_backend::resize_screen(uint32_t rows, uint32_t cols)
+{
+    m_rows = rows;
+    m_cols = cols;
+    m_pending_cells.assign(static_cast<size_t>(rows) * cols, BLANK_CELL);
+    m_visible_cells.assign(static_cast<size_t>(rows) * cols, BLANK_CELL);
+    m_pending_dirty_rows.assign(rows, false);
+
+    if (nullptr != m_screen_window)
+    {
+        m_screen_window.reset();
+        m_screen_window.reset(new ncurses_memory_window(this, m_rows, m_cols, 0, 0));
+    }
+}
+
+void ncurses_memory_backend::handle_resize(void)
+{
+    resize_screen(m_requested_rows, m_requested_cols);
+}
+
+void ncurses_memory_backend::set_screen_size(uint32_t rows, uint32_t cols)
+{
+    m_requested_rows = rows;
+    m_requested_cols = cols;
+    push_char(KEY_RESIZE);
+}
+
+std::unique_ptr<ncurses_backend_window> ncurses_memory_backend::create_window(uint32_t height, uint32_t width, uint32_t begin_y, uint32_t begin_x)
+{
+    std::unique_ptr<ncurses_backend_window> ret;
+
+    /* like newwin(), refuse windows that do not fit on the screen */
+    if (height > 0 && width > 0 &&
+        begin_y < m_rows && height <= m_rows - begin_y &&
+        begin_x < m_cols && width <= m_cols - begin_x)
+    {
+        ret.reset(new ncurses_memory_window(this, height, width, begin_y, begin_x));
+    }
+
+    return ret;
+}
+
+void ncurses_memory_backend::stage_cells(const ncurses_backend_window * window, uint32_t begin_y, uint32_t begin_x, uint32_t row, const ncurses_memory_cell_t * cells, uint32_t num_cells)
+{
+    (void)window;
+
+    uint32_t screen_y = begin_y + row;
+    if (screen_y >= m_rows || begin_x >= m_cols)
+    {
+        return;
+    }
+
+    num_cells = std::min(num_cells, m_cols - begin_x);
+    std::copy(cells, cells + num_cells, m_pending_cells.begin() + static_cast<size_t>(screen_y) * m_cols + begin_x);
+    m_pending_dirty_rows[screen_y] = true;
+}
+
+void ncurses_memory_backend::commit_frame(void)
+{
+    for (uint32_t y = 0; y < m_rows; ++y)
+    {
+        if (!m_pending_dirty_rows[y])
+        {
+            continue;
+        }
+
+        size_t row_start = static_cast<size_t>(y) * m_cols;
+        for (size_t i = row_start; i < row_start + m_cols; ++i)
+        {
+            if (!cells_equal(m_visible_cells[i], m_pending_cells[i]))
+            {
+                m_visible_cells[i] = m_pending_cells[i];
+                m_cells_written++;
+            }
+        }
+
+        m_pending_dirty_rows[y] = false;
+    }
+
+    m_frame_count++;
+}
+
+int ncurses_memory_backend::read_char(void)
+{
+    int ret = ERR;
+
+    if (!m_input_queue.empty())
+    {
+        ret = m_input_queue.front();
+        m_input_queue.pop_front();
+    }
+
+    return ret;
+}
+
+void ncurses_memory_backend::push_char(int ch)
+{
+    m_input_queue.push_back(ch);
+}
+
+char ncurses_memory_backend::get_char(uint32_t x, uint32_t y) const
+{
+    if (x >= m_cols || y >= m_rows)
+    {
+        return BLANK_CELL.ch;
+    }
+
+    return m_visible_cells[static_cast<size_t>(y) * m_cols + x].ch;
+}
+
+ncurses_cpp_text_colors_e ncurses_memory_backend::get_color(uint32_t x, uint32_t y) const
+{
+    if (x >= m_cols || y >= m_rows)
+    {
+        return BLANK_CELL.color;
+    }
+
+    return m_visible_cells[static_cast<size_t>(y) * m_cols + x].color;
+}
+
+std::string ncurses_memory_backend::get_row_text(uint32_t y) const
+{
+    std::string ret;
+
+    if (y < m_rows)
+    {
+        ret.reserve(m_cols);
+        for (uint32_t x = 0; x < m_cols; ++x)
+        {
+            ret.push_back(m_visible_cells[static_cast<size_t>(y) * m_cols + x].ch);
+        }
+    }
+
+    return ret;
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,304 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_shm_reader.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    User interface side of the shared-memory telemetry segment.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements slot lookup and the reader half of the seqlock protocol.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstring>
+
+#include "ncurses_shm_reader.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* a slot that is rewritten faster than it can be copied is tried again at the
+ *  next poll rather than holding up the frame */
+const uint32_t SHM_READ_ATTEMPTS = 4;
+
+const std::chrono::milliseconds DEFAULT_SHM_POLL_INTERVAL(50);
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_shm_reader::ncurses_shm_reader(void)
+  : m_unresolved_count(0),
+    m_scanned_slot_count(0),
+    m_poll_interval(DEFAULT_SHM_POLL_INTERVAL),
+    m_read_value(),
+    m_read_color(0),
+    m_applied_count(0),
+    m_retry_count(0),
+    m_rejected_count(0)
+{ }
+
+ncurses_shm_reader::~ncurses_shm_reader(void)
+{
+    close_segment();
+}
+
+bool ncurses_shm_reader::open_segment(const std::string& segment_name)
+{
+    return open_segment(segment_name, NCURSES_SHM_DEFAULT_SLOT_CAPACITY);
+}
+
+bool ncurses_shm_reader::open_segment(const std::string& segment_name, uint32_t slot_capacity)
+{
+    close_segment();
+    return m_segment.open_segment(segment_name, slot_capacity);
+}
+
+void ncurses_shm_reader::close_segment(void)
+{
+    m_segment.close_segment();
+
+    /* keep the bindings so that they resolve against the next segment */
+    for (auto iter = m_bindings.begin(); iter != m_bindings.end(); ++iter)
+    {
+        iter->slot = nullptr;
+        iter->last_sequence = 0;
+    }
+    m_unresolved_count = m_bindings.size();
+    m_scanned_slot_count = 0;
+}
+
+bool ncurses_shm_reader::bind(const std::string& slot_name, ncurses_field_base * field)
+{
+    bool ret = false;
+
+    if (!slot_name.empty() &&
+        slot_name.size() < NCURSES_SHM_NAME_CAPACITY)
+    {
+        binding_t binding;
+        memset(binding.slot_name, 0, sizeof(binding.slot_name));
+        memcpy(binding.slot_name, slot_name.data(), slot_name.size());
+        binding.field = field;
+        binding.slot = nullptr;
+        binding.last_sequence = 0;
+
+        /* slots that were already scanned are not scanned again */
+        if (m_segment.is_open())
+        {
+            int32_t slot_idx = m_segment.find_slot(binding.slot_name);
+            if (slot_idx >= 0 &&
+                static_cast<uint32_t>(slot_idx) < m_scanned_slot_count)
+            {
+                binding.slot = m_segment.get_slot(static_cast<uint32_t>(slot_idx));
+            }
+        }
+
+        if (nullptr == binding.slot)
+        {
+            m_unresolved_count++;
+        }
+
+        m_bindings.push_back(binding);
+        ret = true;
+    }
+
+    return ret;
+}
+
+void ncurses_shm_reader::rebind_field(const ncurses_field_base * old_field, ncurses_field_base * new_field)
+{
+    for (auto iter = m_bindings.begin(); iter != m_bindings.end(); )
+    {
+        if (old_field != iter->field)
+        {
+            ++iter;
+        }
+        else if (nullptr != new_field)
+        {
+            iter->field = new_field;
+            iter->last_sequence = 0;
+            ++iter;
+        }
+        else
+        {
+            if (nullptr == iter->slot)
+            {
+                m_unresolved_count--;
+            }
+            iter = m_bindings.erase(iter);
+        }
+    }
+}
+
+void ncurses_shm_reader::clear_bindings(void)
+{
+    m_bindings.clear();
+    m_unresolved_count = 0;
+}
+
+void ncurses_shm_reader::resolve_bindings(void)
+{
+    /* slots are claimed in order and named right after the claim, so scanning stops
+     *  at the first slot that a producer is still naming */
+    uint32_t num_claimed = m_segment.get_claimed_slot_count();
+    for (; m_scanned_slot_count < num_claimed && m_unresolved_count > 0; ++m_scanned_slot_count)
+    {
+        const ncurses_shm_slot_t * slot = m_segment.get_slot(m_scanned_slot_count);
+        if (NCURSES_SHM_SLOT_NAMED != slot->state.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        for (auto iter = m_bindings.begin(); iter != m_bindings.end(); ++iter)
+        {
+            if (nullptr == iter->slot &&
+                0 == strncmp(iter->slot_name, slot->name, NCURSES_SHM_NAME_CAPACITY))
+            {
+                iter->slot = slot;
+                m_unresolved_count--;
+            }
+        }
+    }
+}
+
+bool ncurses_shm_reader::read_slot(const ncurses_shm_slot_t& slot, uint32_t& sequence)
+{
+    for (uint32_t attempt = 0; attempt < SHM_READ_ATTEMPTS; ++attempt)
+    {
+        if (0 == (sequence & 1))
+        {
+            m_read_value.type = static_cast<ncurses_field_type_e>(slot.value_type);
+            m_read_color = slot.color;
+            memcpy(&m_read_value.uint64_val, &slot.value, sizeof(slot.value));
+            if (NCURSES_CPP_FIELD_TYPE_STRING == m_read_value.type)
+            {
+                uint32_t str_len = slot.str_len;
+                if (str_len > NCURSES_CPP_FIELD_VALUE_STR_CAPACITY)
+                {
+                    str_len = NCURSES_CPP_FIELD_VALUE_STR_CAPACITY;
+                }
+                memcpy(m_read_value.str_val, slot.str_val, str_len);
+                m_read_value.str_val[str_len] = '\0';
+                m_read_value.str_len = static_cast<uint8_t>(str_len);
+            }
+
+            /* the copy only counts if no write started while it was being made */
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint32_t sequence_after = slot.sequence.load(std::memory_order_relaxed);
+            if (sequence_after == sequence)
+            {
+                return true;
+            }
+            sequence = sequence_after;
+        }
+        else
+        {
+            sequence = slot.sequence.load(std::memory_order_acquire);
+        }
+
+        m_retry_count++;
+    }
+
+    return false;
+}
+
+size_t ncurses_shm_reader::poll(void)
+{
+    size_t ret = 0;
+
+    if (!m_segment.is_open())
+    {
+        return ret;
+    }
+
+    if (m_unresolved_count > 0)
+    {
+        resolve_bindings();
+    }
+
+    for (auto iter = m_bindings.begin(); iter != m_bindings.end(); ++iter)
+    {
+        if (nullptr == iter->slot)
+        {
+            continue;
+        }
+
+        /* a slot that has never been written still has sequence 0 */
+        uint32_t sequence = iter->slot->sequence.load(std::memory_order_acquire);
+        if (sequence == iter->last_sequence ||
+            !read_slot(*iter->slot, sequence))
+        {
+            continue;
+        }
+
+        iter->last_sequence = sequence;
+
+        /* the color comes from another process; only the named colors mean the same
+         *  thing on both sides, as with the update socket */
+        if (m_read_color <= NCURSES_CPP_TXT_COLOR_WHITE &&
+            iter->field->apply_update(m_read_value, static_cast<ncurses_cpp_text_colors_e>(m_read_color)))
+        {
+            ret++;
+        }
+        else
+        {
+            m_rejected_count++;
+        }
+    }
+
+    m_applied_count += ret;
+    return ret;
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,257 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_shm_segment.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Layout and mapping of the shared-memory telemetry segment.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the mapping of the telemetry segment. Whichever process opens a
+ *  segment first creates and sizes it; the others wait briefly for the creator
+ *  to publish the header before they use it.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ncurses_shm_segment.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* how long to wait for another process that is still creating the segment */
+const uint32_t SHM_OPEN_ATTEMPTS = 100;
+const std::chrono::milliseconds SHM_OPEN_RETRY_INTERVAL(1);
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+bool ncurses_shm_segment::remove_segment(const std::string& segment_name)
+{
+    return 0 == shm_unlink(get_object_name(segment_name).c_str());
+}
+
+ncurses_shm_segment::ncurses_shm_segment(void)
+  : m_header(nullptr),
+    m_slots(nullptr),
+    m_mapped_size(0)
+{ }
+
+ncurses_shm_segment::~ncurses_shm_segment(void)
+{
+    close_segment();
+}
+
+bool ncurses_shm_segment::open_segment(const std::string& segment_name, uint32_t slot_capacity)
+{
+    close_segment();
+
+    std::string object_name = get_object_name(segment_name);
+
+    int fd = shm_open(object_name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0660);
+    if (fd >= 0)
+    {
+        size_t segment_size = sizeof(ncurses_shm_header_t) + slot_capacity * sizeof(ncurses_shm_slot_t);
+        if (slot_capacity > 0 &&
+            0 == ftruncate(fd, segment_size))
+        {
+            void * addr = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (MAP_FAILED != addr)
+            {
+                /* the new segment is zero filled, so every slot starts out free; the
+                 *  magic number is written last to tell other processes it is ready */
+                m_header = static_cast<ncurses_shm_header_t *>(addr);
+                m_header->version = NCURSES_SHM_VERSION;
+                m_header->slot_size = sizeof(ncurses_shm_slot_t);
+                m_header->slot_capacity = slot_capacity;
+                m_header->slots_claimed.store(0, std::memory_order_relaxed);
+                m_header->magic.store(NCURSES_SHM_MAGIC, std::memory_order_release);
+
+                m_slots = static_cast<ncurses_shm_slot_t *>(static_cast<void *>(static_cast<char *>(addr) + sizeof(ncurses_shm_header_t)));
+                m_mapped_size = segment_size;
+            }
+        }
+
+        if (!is_open())
+        {
+            shm_unlink(object_name.c_str());
+        }
+        close(fd);
+    }
+    else if (EEXIST == errno)
+    {
+        fd = shm_open(object_name.c_str(), O_RDWR | O_CLOEXEC, 0);
+        if (fd >= 0)
+        {
+            map_existing(fd);
+            close(fd);
+        }
+    }
+
+    return is_open();
+}
+
+void ncurses_shm_segment::close_segment(void)
+{
+    if (nullptr != m_header)
+    {
+        munmap(m_header, m_mapped_size);
+        m_header = nullptr;
+        m_slots = nullptr;
+        m_mapped_size = 0;
+    }
+}
+
+uint32_t ncurses_shm_segment::get_claimed_slot_count(void) const
+{
+    uint32_t ret = 0;
+
+    if (nullptr != m_header)
+    {
+        /* writers that failed to claim a slot in a full segment leave the count past
+         *  the capacity */
+        ret = m_header->slots_claimed.load(std::memory_order_acquire);
+        if (ret > m_header->slot_capacity)
+        {
+            ret = m_header->slot_capacity;
+        }
+    }
+
+    return ret;
+}
+
+int32_t ncurses_shm_segment::find_slot(const char * slot_name) const
+{
+    uint32_t num_claimed = get_claimed_slot_count();
+    for (uint32_t slot_idx = 0; slot_idx < num_claimed; ++slot_idx)
+    {
+        const ncurses_shm_slot_t& slot = m_slots[slot_idx];
+        if (NCURSES_SHM_SLOT_NAMED == slot.state.load(std::memory_order_acquire) &&
+            0 == strncmp(slot.name, slot_name, NCURSES_SHM_NAME_CAPACITY))
+        {
+            return static_cast<int32_t>(slot_idx);
+        }
+    }
+
+    return -1;
+}
+
+std::string ncurses_shm_segment::get_object_name(const std::string& segment_name)
+{
+    return (!segment_name.empty() && '/' == segment_name[0]) ? segment_name : "/" + segment_name;
+}
+
+bool ncurses_shm_segment::map_existing(int fd)
+{
+    /* the creator may not have sized the segment or written its header yet */
+    struct stat segment_stat;
+    uint32_t attempt = 0;
+    for (; attempt < SHM_OPEN_ATTEMPTS; ++attempt)
+    {
+        if (0 != fstat(fd, &segment_stat))
+        {
+            return false;
+        }
+
+        if (static_cast<size_t>(segment_stat.st_size) >= sizeof(ncurses_shm_header_t))
+        {
+            break;
+        }
+        std::this_thread::sleep_for(SHM_OPEN_RETRY_INTERVAL);
+    }
+
+    if (SHM_OPEN_ATTEMPTS == attempt)
+    {
+        return false;
+    }
+
+    size_t segment_size = static_cast<size_t>(segment_stat.st_size);
+    void * addr = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == addr)
+    {
+        return false;
+    }
+
+    ncurses_shm_header_t * header = static_cast<ncurses_shm_header_t *>(addr);
+    for (attempt = 0; attempt < SHM_OPEN_ATTEMPTS && NCURSES_SHM_MAGIC != header->magic.load(std::memory_order_acquire); ++attempt)
+    {
+        std::this_thread::sleep_for(SHM_OPEN_RETRY_INTERVAL);
+    }
+
+    if (NCURSES_SHM_MAGIC != header->magic.load(std::memory_order_acquire) ||
+        NCURSES_SHM_VERSION != header->version ||
+        sizeof(ncurses_shm_slot_t) != header->slot_size ||
+        segment_size < sizeof(ncurses_shm_header_t) + static_cast<size_t>(header->slot_capacity) * sizeof(ncurses_shm_slot_t))
+    {
+        munmap(addr, segment_size);
+        return false;
+    }
+
+    m_header = header;
+    m_slots = static_cast<ncurses_shm_slot_t *>(static_cast<void *>(static_cast<char *>(addr) + sizeof(ncurses_shm_header_t)));
+    m_mapped_size = segment_size;
+
+    return true;
+}
+
+} /* end ncurses_cpp namespace */
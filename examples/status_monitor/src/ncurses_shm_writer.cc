@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_shm_writer.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Producer side of the shared-memory telemetry segment.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements slot claims and the writer half of the seqlock protocol.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstring>
+
+#include "ncurses_shm_writer.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_shm_writer::ncurses_shm_writer(void)
+{ }
+
+ncurses_shm_writer::~ncurses_shm_writer(void)
+{
+    close_segment();
+}
+
+bool ncurses_shm_writer::open_segment(const std::string& segment_name, uint32_t slot_capacity)
+{
+    return m_segment.open_segment(segment_name, slot_capacity);
+}
+
+void ncurses_shm_writer::close_segment(void)
+{
+    m_segment.close_segment();
+}
+
+ncurses_shm_slot_t * ncurses_shm_writer::claim(const std::string& slot_name, ncurses_field_type_e value_type)
+{
+    if (!m_segment.is_open() ||
+        slot_name.empty() ||
+        slot_name.size() >= NCURSES_SHM_NAME_CAPACITY)
+    {
+        return nullptr;
+    }
+
+    int32_t existing_idx = m_segment.find_slot(slot_name.c_str());
+    if (existing_idx >= 0)
+    {
+        ncurses_shm_slot_t * slot = m_segment.get_slot(static_cast<uint32_t>(existing_idx));
+        return static_cast<uint32_t>(value_type) == slot->value_type ? slot : nullptr;
+    }
+
+    uint32_t slot_idx = m_segment.get_header()->slots_claimed.fetch_add(1, std::memory_order_acq_rel);
+    if (slot_idx >= m_segment.get_slot_capacity())
+    {
+        return nullptr;
+    }
+
+    /* readers ignore the slot until it is marked as named */
+    ncurses_shm_slot_t * slot = m_segment.get_slot(slot_idx);
+    memset(slot->name, 0, sizeof(slot->name));
+    memcpy(slot->name, slot_name.data(), slot_name.size());
+    slot->value_type = static_cast<uint32_t>(value_type);
+    slot->color = NCURSES_CPP_TXT_COLOR_DEFAULT;
+    slot->state.store(NCURSES_SHM_SLOT_NAMED, std::memory_order_release);
+
+    return slot;
+}
+
+void ncurses_shm_writer::write_slot(ncurses_shm_slot_t * slot, const ncurses_field_value_t& slot_val, ncurses_cpp_text_colors_e slot_color)
+{
+    /* a producer that died in the middle of a write leaves an odd sequence behind;
+     *  its successor simply finishes that write */
+    uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    if (0 == (sequence & 1))
+    {
+        sequence++;
+        slot->sequence.store(sequence, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot->color = static_cast<uint32_t>(slot_color);
+    memcpy(&slot->value, &slot_val.uint64_val, sizeof(slot->value));
+    if (NCURSES_CPP_FIELD_TYPE_STRING == slot_val.type)
+    {
+        slot->str_len = slot_val.str_len;
+        memcpy(slot->str_val, slot_val.str_val, slot_val.str_len + 1);
+    }
+
+    slot->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,213 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_socket_client.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Producer side of the field update socket.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements batch encoding and sending for the update socket.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "ncurses_socket_client.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_socket_client::ncurses_socket_client(void)
+  : m_fd(-1),
+    m_batch(NCURSES_SOCKET_BATCH_HEADER_LEN + NCURSES_SOCKET_MAX_BATCH_LEN),
+    m_batch_len(NCURSES_SOCKET_BATCH_HEADER_LEN),
+    m_pending_update_count(0)
+{ }
+
+ncurses_socket_client::~ncurses_socket_client(void)
+{
+    close_socket();
+}
+
+bool ncurses_socket_client::connect_socket(const std::string& socket_path)
+{
+    close_socket();
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.empty() ||
+        socket_path.size() >= sizeof(addr.sun_path))
+    {
+        return false;
+    }
+    memcpy(addr.sun_path, socket_path.data(), socket_path.size());
+
+    m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_fd >= 0 &&
+        0 != connect(m_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)))
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+
+    return is_connected();
+}
+
+void ncurses_socket_client::close_socket(void)
+{
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+
+    m_batch_len = NCURSES_SOCKET_BATCH_HEADER_LEN;
+    m_pending_update_count = 0;
+}
+
+bool ncurses_socket_client::add_record(const std::string& window_name, const std::string& field_name, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    if (window_name.size() > NCURSES_SOCKET_MAX_NAME_LEN ||
+        field_name.size() > NCURSES_SOCKET_MAX_NAME_LEN)
+    {
+        return false;
+    }
+
+    size_t value_len = NCURSES_CPP_FIELD_TYPE_STRING == field_val.type ? 1 + field_val.str_len : NCURSES_SOCKET_VALUE_LEN;
+    size_t record_len = NCURSES_SOCKET_RECORD_HEADER_LEN + window_name.size() + field_name.size() + value_len;
+    if (m_batch_len + record_len > m_batch.size() &&
+        !flush())
+    {
+        return false;
+    }
+
+    uint8_t * record = m_batch.data() + m_batch_len;
+    record[0] = static_cast<uint8_t>(field_val.type);
+    record[1] = static_cast<uint8_t>(field_color);
+    record[2] = static_cast<uint8_t>(window_name.size());
+    record[3] = static_cast<uint8_t>(field_name.size());
+    record += NCURSES_SOCKET_RECORD_HEADER_LEN;
+
+    memcpy(record, window_name.data(), window_name.size());
+    record += window_name.size();
+    memcpy(record, field_name.data(), field_name.size());
+    record += field_name.size();
+
+    if (NCURSES_CPP_FIELD_TYPE_STRING == field_val.type)
+    {
+        record[0] = field_val.str_len;
+        memcpy(record + 1, field_val.str_val, field_val.str_len);
+    }
+    else
+    {
+        memcpy(record, &field_val.uint64_val, NCURSES_SOCKET_VALUE_LEN);
+    }
+
+    m_batch_len += record_len;
+    m_pending_update_count++;
+
+    return true;
+}
+
+bool ncurses_socket_client::flush(void)
+{
+    if (m_fd < 0)
+    {
+        return false;
+    }
+
+    if (0 == m_pending_update_count)
+    {
+        return true;
+    }
+
+    uint32_t payload_len = static_cast<uint32_t>(m_batch_len - NCURSES_SOCKET_BATCH_HEADER_LEN);
+    memcpy(m_batch.data(), &payload_len, sizeof(payload_len));
+
+    /* MSG_NOSIGNAL turns a server that went away into an error instead of SIGPIPE */
+    size_t sent_len = 0;
+    while (sent_len < m_batch_len)
+    {
+        ssize_t bytes_sent = send(m_fd, m_batch.data() + sent_len, m_batch_len - sent_len, MSG_NOSIGNAL);
+        if (bytes_sent < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            close_socket();
+            return false;
+        }
+
+        sent_len += static_cast<size_t>(bytes_sent);
+    }
+
+    m_batch_len = NCURSES_SOCKET_BATCH_HEADER_LEN;
+    m_pending_update_count = 0;
+
+    return true;
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,427 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_socket_server.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Receives field update batches on a Unix-domain socket.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the connection handling and batch decoding of the update socket.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "ncurses_socket_server.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* ready descriptors handled per service() call; the rest wait for the next pass of
+ *  the event loop so that keyboard input is checked in between */
+const size_t MAX_EVENTS_PER_SERVICE = 64;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static bool fill_socket_address(const std::string& socket_path, struct sockaddr_un& addr)
+{
+    bool ret = false;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (!socket_path.empty() &&
+        socket_path.size() < sizeof(addr.sun_path))
+    {
+        memcpy(addr.sun_path, socket_path.data(), socket_path.size());
+        ret = true;
+    }
+
+    return ret;
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_socket_server::ncurses_socket_server(void)
+  : m_listen_fd(-1),
+    m_epoll_fd(-1),
+    m_max_clients(NCURSES_SOCKET_DEFAULT_MAX_CLIENTS),
+    m_events(MAX_EVENTS_PER_SERVICE),
+    m_record(),
+    m_refused_client_count(0),
+    m_bytes_read(0),
+    m_batch_count(0),
+    m_record_count(0),
+    m_rejected_record_count(0),
+    m_protocol_error_count(0)
+{ }
+
+ncurses_socket_server::~ncurses_socket_server(void)
+{
+    close_socket();
+}
+
+bool ncurses_socket_server::open_socket(const std::string& socket_path)
+{
+    return open_socket(socket_path, NCURSES_SOCKET_DEFAULT_MAX_CLIENTS);
+}
+
+bool ncurses_socket_server::open_socket(const std::string& socket_path, uint32_t max_clients)
+{
+    close_socket();
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0)
+    {
+        return false;
+    }
+
+    if (!bind_socket(listen_fd, socket_path) ||
+        0 != listen(listen_fd, SOMAXCONN))
+    {
+        close(listen_fd);
+        return false;
+    }
+
+    m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+    struct epoll_event listen_event;
+    listen_event.events = EPOLLIN;
+    listen_event.data.ptr = nullptr;
+    if (m_epoll_fd < 0 ||
+        0 != epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, listen_fd, &listen_event))
+    {
+        if (m_epoll_fd >= 0)
+        {
+            close(m_epoll_fd);
+            m_epoll_fd = -1;
+        }
+        close(listen_fd);
+        unlink(socket_path.c_str());
+        return false;
+    }
+
+    m_listen_fd = listen_fd;
+    m_socket_path = socket_path;
+    m_max_clients = max_clients;
+    m_clients.reserve(max_clients);
+
+    return true;
+}
+
+bool ncurses_socket_server::bind_socket(int listen_fd, const std::string& socket_path)
+{
+    struct sockaddr_un addr;
+    if (!fill_socket_address(socket_path, addr))
+    {
+        return false;
+    }
+
+    if (0 == bind(listen_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)))
+    {
+        return true;
+    }
+    else if (EADDRINUSE != errno)
+    {
+        return false;
+    }
+
+    /* the path exists; only take it over if nobody answers on it */
+    bool stale_socket = false;
+    int probe_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe_fd >= 0)
+    {
+        stale_socket = 0 != connect(probe_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) &&
+                       ECONNREFUSED == errno;
+        close(probe_fd);
+    }
+
+    return stale_socket &&
+           0 == unlink(socket_path.c_str()) &&
+           0 == bind(listen_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
+}
+
+void ncurses_socket_server::close_socket(void)
+{
+    while (!m_clients.empty())
+    {
+        close_client(m_clients.back().get());
+    }
+
+    if (m_epoll_fd >= 0)
+    {
+        close(m_epoll_fd);
+        m_epoll_fd = -1;
+    }
+
+    if (m_listen_fd >= 0)
+    {
+        close(m_listen_fd);
+        m_listen_fd = -1;
+        unlink(m_socket_path.c_str());
+        m_socket_path.clear();
+    }
+}
+
+size_t ncurses_socket_server::service(ncurses_socket_record_handler& handler)
+{
+    size_t ret = 0;
+
+    if (m_epoll_fd >= 0)
+    {
+        int num_events = epoll_wait(m_epoll_fd, m_events.data(), static_cast<int>(m_events.size()), 0);
+        for (int event_idx = 0; event_idx < num_events; ++event_idx)
+        {
+            client_t * client = static_cast<client_t *>(m_events[event_idx].data.ptr);
+            if (nullptr == client)
+            {
+                accept_clients();
+            }
+            else if (!read_client(client, handler))
+            {
+                close_client(client);
+            }
+        }
+
+        ret = num_events > 0 ? static_cast<size_t>(num_events) : 0;
+    }
+
+    return ret;
+}
+
+void ncurses_socket_server::accept_clients(void)
+{
+    for (size_t accepted = 0; accepted < MAX_EVENTS_PER_SERVICE; ++accepted)
+    {
+        int client_fd = accept4(m_listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_fd < 0)
+        {
+            break;
+        }
+
+        if (m_clients.size() >= m_max_clients)
+        {
+            close(client_fd);
+            m_refused_client_count++;
+            continue;
+        }
+
+        std::unique_ptr<client_t> client(new client_t);
+        client->fd = client_fd;
+        client->client_idx = m_clients.size();
+        client->buffered_len = 0;
+        client->buffer.reset(new uint8_t[NCURSES_SOCKET_BUFFER_LEN]);
+
+        struct epoll_event client_event;
+        client_event.events = EPOLLIN;
+        client_event.data.ptr = client.get();
+        if (0 != epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, client_fd, &client_event))
+        {
+            close(client_fd);
+            continue;
+        }
+
+        m_clients.push_back(std::move(client));
+    }
+}
+
+void ncurses_socket_server::close_client(client_t * client)
+{
+    epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, client->fd, nullptr);
+    close(client->fd);
+
+    /* move the last client into the freed position */
+    size_t client_idx = client->client_idx;
+    if (client_idx + 1 < m_clients.size())
+    {
+        m_clients[client_idx] = std::move(m_clients.back());
+        m_clients[client_idx]->client_idx = client_idx;
+    }
+    m_clients.pop_back();
+}
+
+bool ncurses_socket_server::read_client(client_t * client, ncurses_socket_record_handler& handler)
+{
+    ssize_t bytes_read = read(client->fd, client->buffer.get() + client->buffered_len, NCURSES_SOCKET_BUFFER_LEN - client->buffered_len);
+    if (bytes_read <= 0)
+    {
+        /* zero means the client disconnected */
+        return bytes_read < 0 && (EAGAIN == errno || EINTR == errno);
+    }
+
+    m_bytes_read += static_cast<uint64_t>(bytes_read);
+    client->buffered_len += static_cast<size_t>(bytes_read);
+
+    /* decode every complete batch and keep the partial one at the end */
+    const uint8_t * buffer = client->buffer.get();
+    size_t offset = 0;
+    while (client->buffered_len - offset >= NCURSES_SOCKET_BATCH_HEADER_LEN)
+    {
+        uint32_t batch_len;
+        memcpy(&batch_len, buffer + offset, sizeof(batch_len));
+        if (batch_len > NCURSES_SOCKET_MAX_BATCH_LEN)
+        {
+            m_protocol_error_count++;
+            return false;
+        }
+
+        if (client->buffered_len - offset - NCURSES_SOCKET_BATCH_HEADER_LEN < batch_len)
+        {
+            break;
+        }
+
+        if (!decode_batch(buffer + offset + NCURSES_SOCKET_BATCH_HEADER_LEN, batch_len, handler))
+        {
+            m_protocol_error_count++;
+            return false;
+        }
+
+        m_batch_count++;
+        offset += NCURSES_SOCKET_BATCH_HEADER_LEN + batch_len;
+    }
+
+    if (offset > 0)
+    {
+        client->buffered_len -= offset;
+        memmove(client->buffer.get(), buffer + offset, client->buffered_len);
+    }
+
+    return true;
+}
+
+bool ncurses_socket_server::decode_batch(const uint8_t * batch, size_t batch_len, ncurses_socket_record_handler& handler)
+{
+    size_t pos = 0;
+    while (pos < batch_len)
+    {
+        if (batch_len - pos < NCURSES_SOCKET_RECORD_HEADER_LEN)
+        {
+            return false;
+        }
+
+        uint8_t value_type = batch[pos];
+        uint8_t color = batch[pos + 1];
+        size_t window_name_len = batch[pos + 2];
+        size_t field_name_len = batch[pos + 3];
+        pos += NCURSES_SOCKET_RECORD_HEADER_LEN;
+
+        if (value_type > NCURSES_CPP_FIELD_TYPE_SECONDS ||
+            batch_len - pos < window_name_len + field_name_len)
+        {
+            return false;
+        }
+
+        m_record.window_name = reinterpret_cast<const char *>(batch + pos);
+        m_record.window_name_len = window_name_len;
+        pos += window_name_len;
+        m_record.field_name = reinterpret_cast<const char *>(batch + pos);
+        m_record.field_name_len = field_name_len;
+        pos += field_name_len;
+
+        m_record.value.type = static_cast<ncurses_field_type_e>(value_type);
+        if (NCURSES_CPP_FIELD_TYPE_STRING == value_type)
+        {
+            if (batch_len - pos < 1 ||
+                batch[pos] > NCURSES_CPP_FIELD_VALUE_STR_CAPACITY ||
+                batch_len - pos - 1 < batch[pos])
+            {
+                return false;
+            }
+
+            m_record.value.str_len = batch[pos];
+            memcpy(m_record.value.str_val, batch + pos + 1, m_record.value.str_len);
+            m_record.value.str_val[m_record.value.str_len] = '\0';
+            pos += 1 + m_record.value.str_len;
+        }
+        else
+        {
+            if (batch_len - pos < NCURSES_SOCKET_VALUE_LEN)
+            {
+                return false;
+            }
+
+            if (NCURSES_CPP_FIELD_TYPE_BOOL == value_type)
+            {
+                /* any other byte pattern would not be a valid bool */
+                m_record.value.bool_val = 0 != batch[pos];
+            }
+            else
+            {
+                memcpy(&m_record.value.uint64_val, batch + pos, NCURSES_SOCKET_VALUE_LEN);
+            }
+            pos += NCURSES_SOCKET_VALUE_LEN;
+        }
+
+        bool record_accepted = false;
+        if (color <= NCURSES_CPP_TXT_COLOR_WHITE)
+        {
+            m_record.color = static_cast<ncurses_cpp_text_colors_e>(color);
+            record_accepted = handler.handle_socket_record(m_record);
+        }
+
+        m_record_count++;
+        if (!record_accepted)
+        {
+            m_rejected_record_count++;
+        }
+    }
+
+    return true;
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,550 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_sparkline_field.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Field that draws the recent history of a metric as a sparkline.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the sparkline field. Single samples update the summary of their
+ *  column in constant time; blocks of samples are copied into the ring and each
+ *  column they touched is summarized again with a vectorized min/max/sum
+ *  reduction over its contiguous run of samples. The reduction uses the GCC
+ *  vector extensions, which map onto SSE on x86 and NEON on ARM without any
+ *  target specific code.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "ncurses_sparkline_field.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* one character per level, lowest first; columns without samples are blank */
+const char SPARKLINE_LEVELS[] = "_.-~=+*#";
+const uint32_t NUM_SPARKLINE_LEVELS = sizeof(SPARKLINE_LEVELS) - 1;
+const char SPARKLINE_EMPTY_COLUMN = ' ';
+
+/* 128-bit vectors are native on both SSE2 and NEON */
+const size_t SPARKLINE_VECTOR_BYTES = 16;
+
+/* float sums are accumulated in vector lanes for this many samples at a time and
+ *  then moved into a double to limit the rounding error */
+const size_t SPARKLINE_SUM_BLOCK_LEN = 1024;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+template <typename T>
+ncurses_sparkline_field<T>::ncurses_sparkline_field(void)
+  : m_window(nullptr),
+    m_x(0),
+    m_y(0),
+    m_width(0),
+    m_default_color(NCURSES_CPP_TXT_COLOR_DEFAULT),
+    m_statistic(NCURSES_CPP_SPARKLINE_AVERAGE),
+    m_auto_range(true),
+    m_range_min(0),
+    m_range_max(0),
+    m_samples_per_column(1),
+    m_sample_count(0),
+    m_settled_valid(false),
+    m_settled_column_count(0),
+    m_settled_min(0.0),
+    m_settled_max(0.0),
+    m_level_range_min(0.0),
+    m_level_range_max(0.0),
+    m_refresh_state(nullptr),
+    m_rendered_color(NCURSES_CPP_TXT_COLOR_DEFAULT),
+    m_rendered_valid(false),
+    m_write_count(0)
+{ }
+
+template <typename T>
+ncurses_sparkline_field<T>::~ncurses_sparkline_field(void)
+{ }
+
+template <typename T>
+bool ncurses_sparkline_field<T>::apply_update(const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    return record_value(field_val) && redraw_field(field_color);
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::record_value(const ncurses_field_value_t& field_val)
+{
+    bool ret = false;
+
+    if (ncurses_field_value_traits<T>::type == field_val.type)
+    {
+        T sample;
+        ncurses_field_value_traits<T>::load(field_val, sample);
+        ret = append_sample(sample);
+
+        if (ret)
+        {
+            record_sample(sample, NCURSES_CPP_TXT_COLOR_DEFAULT);
+        }
+    }
+
+    return ret;
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::redraw_field(ncurses_cpp_text_colors_e field_color)
+{
+    return draw_chart(NCURSES_CPP_TXT_COLOR_DEFAULT != field_color ? field_color : m_default_color);
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::move_to_window(ncurses_backend_window * window)
+{
+    ncurses_cpp_text_colors_e field_color = m_rendered_valid ? m_rendered_color : m_default_color;
+
+    m_window = window;
+    m_rendered_valid = false;
+
+    return draw_chart(field_color);
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::create_field(ncurses_backend_window * window, uint32_t x, uint32_t y, uint32_t width, size_t history_len, ncurses_cpp_text_colors_e default_color)
+{
+    bool ret = false;
+
+    if (nullptr != window &&
+        width > 0)
+    {
+        m_window = window;
+        m_x = x;
+        m_y = y;
+        m_width = width;
+        m_default_color = default_color;
+
+        /* every allocation the field needs is made here */
+        m_samples_per_column = std::max<size_t>(1, (history_len + width - 1) / width);
+        m_history.assign(m_samples_per_column * width, T());
+        m_sample_count = 0;
+
+        column_stats_t empty_column = { T(), T(), 0.0, 0 };
+        m_columns.assign(width, empty_column);
+        m_column_values.assign(width, 0.0);
+        m_glyphs.assign(width + 1, '\0');
+        m_settled_valid = false;
+        m_rendered_glyphs.assign(width + 1, '\0');
+        m_rendered_valid = false;
+
+        ret = draw_chart(m_default_color);
+    }
+
+    return ret;
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::add_sample(const T& sample)
+{
+    return add_sample(sample, m_default_color);
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::add_sample(const T& sample, ncurses_cpp_text_colors_e field_color)
+{
+    if (!append_sample(sample))
+    {
+        return false;
+    }
+    record_sample(sample, field_color);
+
+    return redraw_field(field_color);
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::add_samples(const T * samples, size_t num_samples)
+{
+    if (nullptr == m_window ||
+        nullptr == samples)
+    {
+        return false;
+    }
+
+    size_t sample_idx = 0;
+    while (sample_idx < num_samples)
+    {
+        /* fill the rest of the current column in one go */
+        uint64_t column = m_sample_count / m_samples_per_column;
+        size_t column_start = static_cast<size_t>(column % m_width) * m_samples_per_column;
+        size_t column_fill = static_cast<size_t>(m_sample_count % m_samples_per_column);
+
+        while (sample_idx < num_samples &&
+               column_fill < m_samples_per_column)
+        {
+            if (!std::isnan(samples[sample_idx]))
+            {
+                m_history[column_start + column_fill] = samples[sample_idx];
+                column_fill++;
+                m_sample_count++;
+                record_sample(samples[sample_idx], NCURSES_CPP_TXT_COLOR_DEFAULT);
+            }
+            sample_idx++;
+        }
+
+        if (column_fill > 0)
+        {
+            reduce_samples(&m_history[column_start], column_fill, m_columns[column % m_width]);
+        }
+    }
+
+    return redraw_field(m_default_color);
+}
+
+template <typename T>
+void ncurses_sparkline_field<T>::set_statistic(ncurses_cpp_sparkline_statistic_e statistic)
+{
+    m_statistic = statistic;
+    m_settled_valid = false;
+    draw_chart(m_rendered_valid ? m_rendered_color : m_default_color);
+}
+
+template <typename T>
+void ncurses_sparkline_field<T>::set_range(T min_val, T max_val)
+{
+    m_auto_range = false;
+    m_range_min = min_val;
+    m_range_max = max_val;
+    m_settled_valid = false;
+    draw_chart(m_rendered_valid ? m_rendered_color : m_default_color);
+}
+
+template <typename T>
+void ncurses_sparkline_field<T>::set_auto_range(void)
+{
+    m_auto_range = true;
+    m_settled_valid = false;
+    draw_chart(m_rendered_valid ? m_rendered_color : m_default_color);
+}
+
+template <typename T>
+void ncurses_sparkline_field<T>::reduce_samples(const T * samples, size_t num_samples, column_stats_t& stats)
+{
+    typedef T vector_t __attribute__((vector_size(SPARKLINE_VECTOR_BYTES)));
+    const size_t NUM_LANES = sizeof(vector_t) / sizeof(T);
+
+    /* every lane starts out with the first sample, which keeps min/max correct for
+     *  lanes that never see another one */
+    vector_t zeros = {};
+    vector_t min_vec = zeros + samples[0];
+    vector_t max_vec = min_vec;
+    double sum = 0.0;
+
+    size_t idx = 0;
+    while (idx + NUM_LANES <= num_samples)
+    {
+        size_t block_end = std::min(num_samples, idx + SPARKLINE_SUM_BLOCK_LEN) / NUM_LANES * NUM_LANES;
+        if (block_end <= idx)
+        {
+            break;
+        }
+
+        vector_t sum_vec = zeros;
+        for (; idx < block_end; idx += NUM_LANES)
+        {
+            vector_t sample_vec;
+            memcpy(&sample_vec, samples + idx, sizeof(sample_vec));
+
+            min_vec = sample_vec < min_vec ? sample_vec : min_vec;
+            max_vec = sample_vec > max_vec ? sample_vec : max_vec;
+            sum_vec += sample_vec;
+        }
+
+        for (size_t lane = 0; lane < NUM_LANES; ++lane)
+        {
+            sum += sum_vec[lane];
+        }
+    }
+
+    T min_val = min_vec[0];
+    T max_val = max_vec[0];
+    for (size_t lane = 1; lane < NUM_LANES; ++lane)
+    {
+        min_val = std::min(min_val, static_cast<T>(min_vec[lane]));
+        max_val = std::max(max_val, static_cast<T>(max_vec[lane]));
+    }
+
+    for (; idx < num_samples; ++idx)
+    {
+        min_val = std::min(min_val, samples[idx]);
+        max_val = std::max(max_val, samples[idx]);
+        sum += samples[idx];
+    }
+
+    stats.min_val = min_val;
+    stats.max_val = max_val;
+    stats.sum = sum;
+    stats.count = static_cast<uint32_t>(num_samples);
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::append_sample(const T& sample)
+{
+    if (nullptr == m_window ||
+        std::isnan(sample))
+    {
+        return false;
+    }
+
+    uint64_t column = m_sample_count / m_samples_per_column;
+    size_t column_fill = static_cast<size_t>(m_sample_count % m_samples_per_column);
+    m_history[static_cast<size_t>(column % m_width) * m_samples_per_column + column_fill] = sample;
+
+    column_stats_t& stats = m_columns[column % m_width];
+    if (0 == column_fill)
+    {
+        /* the oldest column scrolls off and this one starts over */
+        stats.min_val = sample;
+        stats.max_val = sample;
+        stats.sum = sample;
+        stats.count = 1;
+    }
+    else
+    {
+        stats.min_val = std::min(stats.min_val, sample);
+        stats.max_val = std::max(stats.max_val, sample);
+        stats.sum += sample;
+        stats.count++;
+    }
+
+    m_sample_count++;
+
+    return true;
+}
+
+template <typename T>
+void ncurses_sparkline_field<T>::record_sample(const T& sample, ncurses_cpp_text_colors_e field_color)
+{
+    if (is_recorded())
+    {
+        ncurses_field_value_t recorded_val;
+        ncurses_field_value_traits<T>::store(recorded_val, sample);
+        record_update(recorded_val, field_color);
+    }
+}
+
+template <typename T>
+double ncurses_sparkline_field<T>::get_column_value(const column_stats_t& stats) const
+{
+    switch (m_statistic)
+    {
+    case NCURSES_CPP_SPARKLINE_MINIMUM: return stats.min_val;
+    case NCURSES_CPP_SPARKLINE_MAXIMUM: return stats.max_val;
+    case NCURSES_CPP_SPARKLINE_AVERAGE: break;
+    }
+
+    return stats.sum / stats.count;
+}
+
+template <typename T>
+bool ncurses_sparkline_field<T>::draw_chart(ncurses_cpp_text_colors_e field_color)
+{
+    if (nullptr == m_window)
+    {
+        return false;
+    }
+
+    /* the newest column is drawn on the right; columns before the first sample are
+     *  left blank */
+    uint64_t num_columns = (m_sample_count + m_samples_per_column - 1) / m_samples_per_column;
+    uint32_t num_shown = static_cast<uint32_t>(std::min<uint64_t>(num_columns, m_width));
+    uint32_t first_shown = m_width - num_shown;
+    uint32_t newest_col = m_width - 1;
+
+    /* the columns before the newest one only change when a column completes, so
+     *  their values and range are kept until then and a new sample costs O(1) */
+    bool relevel_all = false;
+    if (!m_settled_valid ||
+        num_columns != m_settled_column_count)
+    {
+        for (uint32_t col = first_shown; col < newest_col; ++col)
+        {
+            uint64_t column = num_columns - (m_width - col);
+            m_column_values[col] = get_column_value(m_columns[column % m_width]);
+
+            if (col == first_shown)
+            {
+                m_settled_min = m_column_values[col];
+                m_settled_max = m_column_values[col];
+            }
+            m_settled_min = std::min(m_settled_min, m_column_values[col]);
+            m_settled_max = std::max(m_settled_max, m_column_values[col]);
+        }
+
+        m_settled_column_count = num_columns;
+        m_settled_valid = true;
+        relevel_all = true;
+    }
+
+    double range_min = m_range_min;
+    double range_max = m_range_max;
+    if (num_shown > 0)
+    {
+        m_column_values[newest_col] = get_column_value(m_columns[(num_columns - 1) % m_width]);
+
+        if (m_auto_range)
+        {
+            range_min = m_column_values[newest_col];
+            range_max = m_column_values[newest_col];
+            if (num_shown > 1)
+            {
+                range_min = std::min(range_min, m_settled_min);
+                range_max = std::max(range_max, m_settled_max);
+            }
+        }
+    }
+
+    if (range_min != m_level_range_min ||
+        range_max != m_level_range_max)
+    {
+        m_level_range_min = range_min;
+        m_level_range_max = range_max;
+        relevel_all = true;
+    }
+
+    uint32_t first_leveled = relevel_all ? first_shown : std::max(first_shown, newest_col);
+    if (relevel_all)
+    {
+        std::fill(m_glyphs.begin(), m_glyphs.begin() + first_shown, SPARKLINE_EMPTY_COLUMN);
+    }
+
+    for (uint32_t col = first_leveled; col < m_width; ++col)
+    {
+        /* a flat line sits in the middle of the ramp */
+        uint32_t level = NUM_SPARKLINE_LEVELS / 2;
+        if (range_max > range_min)
+        {
+            double scaled = (m_column_values[col] - range_min) / (range_max - range_min) * (NUM_SPARKLINE_LEVELS - 1) + 0.5;
+            level = static_cast<uint32_t>(std::max(0.0, std::min(scaled, static_cast<double>(NUM_SPARKLINE_LEVELS - 1))));
+        }
+        m_glyphs[col] = SPARKLINE_LEVELS[level];
+    }
+
+    /* redraw only the runs of columns that changed since the last draw */
+    bool redraw_all = !m_rendered_valid || m_rendered_color != field_color;
+    bool ret = true;
+    bool drawn = false;
+
+    uint32_t col = redraw_all ? 0 : first_leveled;
+    while (col < m_width)
+    {
+        if (!redraw_all &&
+            m_glyphs[col] == m_rendered_glyphs[col])
+        {
+            col++;
+            continue;
+        }
+
+        uint32_t run_start = col;
+        while (col < m_width &&
+               (redraw_all || m_glyphs[col] != m_rendered_glyphs[col]))
+        {
+            col++;
+        }
+
+        if (m_window->draw_text(m_x + run_start, m_y, &m_glyphs[run_start], col - run_start, field_color))
+        {
+            memcpy(&m_rendered_glyphs[run_start], &m_glyphs[run_start], col - run_start);
+            m_write_count++;
+            drawn = true;
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    m_rendered_color = field_color;
+    m_rendered_valid = ret;
+
+    if (drawn)
+    {
+        refresh_window();
+    }
+
+    return ret;
+}
+
+template <typename T>
+void ncurses_sparkline_field<T>::refresh_window(void)
+{
+    if (nullptr != m_refresh_state &&
+        m_refresh_state->frame_commit_mode)
+    {
+        /* the chart is already in the window buffer; the owning ncurses_ui pushes it to
+         *  the terminal with the rest of the frame */
+        m_refresh_state->deferred_refresh_count++;
+    }
+    else
+    {
+        m_window->refresh();
+    }
+}
+
+/* explicit instantiations of the ncurses_sparkline_field class */
+template class ncurses_sparkline_field<float>;
+template class ncurses_sparkline_field<double>;
+
+} /* end ncurses_cpp namespace */
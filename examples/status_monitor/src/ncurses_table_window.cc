@@ -0,0 +1,394 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_table_window.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Window that shows a large table through a scrolling viewport.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the table window. Each visible row is formatted into a single
+ *  line buffer, column by column, and drawn with one call, so the work done for
+ *  a redraw depends on the size of the viewport and never on the number of rows
+ *  in the table.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <ncurses.h>
+
+#include "ncurses_table_window.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* columns are separated by this many blank characters */
+const uint32_t TABLE_COLUMN_GAP = 1;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+template <typename T>
+ncurses_table_column<T>::ncurses_table_column(const std::string& header, uint32_t width)
+  : ncurses_table_column_base(header, width)
+{ }
+
+template <typename T>
+ncurses_table_column<T>::~ncurses_table_column(void)
+{ }
+
+template <typename T>
+bool ncurses_table_column<T>::compile_format(const std::string& format_str)
+{
+    return m_format.compile(format_str, ncurses_field_value_traits<T>::type);
+}
+
+template <typename T>
+void ncurses_table_column<T>::resize(size_t num_rows)
+{
+    m_values.resize(num_rows);
+}
+
+template <typename T>
+size_t ncurses_table_column<T>::render_cell(size_t row, char * buf, size_t buf_size) const
+{
+    return m_format.render(static_cast<T>(m_values[row]), buf, buf_size);
+}
+
+/* explicit instantiations of the ncurses_table_column class */
+template class ncurses_table_column<std::string>;
+template class ncurses_table_column<int32_t>;
+template class ncurses_table_column<uint32_t>;
+template class ncurses_table_column<float>;
+template class ncurses_table_column<double>;
+template class ncurses_table_column<int64_t>;
+template class ncurses_table_column<uint64_t>;
+template class ncurses_table_column<bool>;
+template class ncurses_table_column<std::chrono::nanoseconds>;
+template class ncurses_table_column<std::chrono::microseconds>;
+template class ncurses_table_column<std::chrono::milliseconds>;
+template class ncurses_table_column<std::chrono::seconds>;
+
+ncurses_table_window::ncurses_table_window(std::string window_name)
+  : ncurses_table_window(window_name, true)
+{ }
+
+ncurses_table_window::ncurses_table_window(std::string window_name, bool outline_window)
+  : ncurses_window(window_name, outline_window),
+    m_num_rows(0),
+    m_first_row(0),
+    m_rows_drawn(0)
+{ }
+
+ncurses_table_window::~ncurses_table_window(void)
+{ }
+
+bool ncurses_table_window::create_window(uint32_t height, uint32_t width, uint32_t start_x, uint32_t start_y)
+{
+    bool ret = ncurses_window::create_window(height, width, start_x, start_y);
+
+    if (ret)
+    {
+        m_line_buf.assign(get_line_width(), ' ');
+        m_first_row = std::min(m_first_row, get_last_first_row());
+
+        draw_header();
+        draw_viewport();
+        refresh_window();
+    }
+
+    return ret;
+}
+
+void ncurses_table_window::redraw_contents(void)
+{
+    ncurses_window::redraw_contents();
+
+    /* the number of visible rows follows the new height */
+    m_line_buf.assign(get_line_width(), ' ');
+    m_first_row = std::min(m_first_row, get_last_first_row());
+
+    if (nullptr != get_backend_window())
+    {
+        draw_header();
+        draw_viewport();
+    }
+}
+
+void ncurses_table_window::set_row_count(size_t num_rows)
+{
+    size_t old_num_rows = m_num_rows;
+    size_t old_first_row = m_first_row;
+
+    for (auto iter = m_columns.begin(); iter != m_columns.end(); ++iter)
+    {
+        (*iter)->resize(num_rows);
+    }
+    m_row_colors.resize(num_rows, NCURSES_CPP_TXT_COLOR_DEFAULT);
+    m_num_rows = num_rows;
+    m_first_row = std::min(m_first_row, get_last_first_row());
+
+    /* rows added or removed below the viewport do not change the screen */
+    if (nullptr != get_backend_window() &&
+        (m_first_row != old_first_row ||
+         std::min(old_num_rows, num_rows) < m_first_row + get_visible_row_count()))
+    {
+        draw_viewport();
+        refresh_window();
+    }
+}
+
+bool ncurses_table_window::set_row_color(size_t row, ncurses_cpp_text_colors_e row_color)
+{
+    bool ret = false;
+
+    if (row < m_num_rows)
+    {
+        if (m_row_colors[row] != row_color)
+        {
+            m_row_colors[row] = row_color;
+
+            if (is_row_visible(row))
+            {
+                draw_row(row);
+                refresh_window();
+            }
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+uint32_t ncurses_table_window::get_visible_row_count(void) const
+{
+    /* the header takes the first line inside the outline */
+    uint32_t border = get_outline_window() ? 2 : 0;
+    return get_height() > border + 1 ? get_height() - border - 1 : 0;
+}
+
+bool ncurses_table_window::scroll_to(size_t first_row)
+{
+    bool ret = false;
+
+    first_row = std::min(first_row, get_last_first_row());
+    if (first_row != m_first_row)
+    {
+        m_first_row = first_row;
+
+        if (nullptr != get_backend_window())
+        {
+            draw_viewport();
+            refresh_window();
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+bool ncurses_table_window::scroll_by(int64_t num_rows)
+{
+    size_t first_row = 0;
+    if (num_rows >= 0)
+    {
+        first_row = m_first_row + static_cast<size_t>(num_rows);
+    }
+    else if (static_cast<size_t>(-num_rows) < m_first_row)
+    {
+        first_row = m_first_row - static_cast<size_t>(-num_rows);
+    }
+
+    return scroll_to(first_row);
+}
+
+bool ncurses_table_window::handle_scroll_key(int key)
+{
+    bool ret = true;
+
+    int64_t page_rows = std::max<int64_t>(1, get_visible_row_count());
+
+    switch (key)
+    {
+    case KEY_UP:
+        scroll_by(-1);
+        break;
+
+    case KEY_DOWN:
+        scroll_by(1);
+        break;
+
+    case KEY_PPAGE:
+        scroll_by(-page_rows);
+        break;
+
+    case KEY_NPAGE:
+        scroll_by(page_rows);
+        break;
+
+    case KEY_HOME:
+        scroll_to(0);
+        break;
+
+    case KEY_END:
+        scroll_to(get_last_first_row());
+        break;
+
+    default:
+        ret = false;
+        break;
+    }
+
+    return ret;
+}
+
+uint32_t ncurses_table_window::get_first_line(void) const
+{
+    return get_outline_window() ? 1 : 0;
+}
+
+uint32_t ncurses_table_window::get_line_width(void) const
+{
+    uint32_t border = get_outline_window() ? 2 : 0;
+    return get_width() > border ? get_width() - border : 0;
+}
+
+size_t ncurses_table_window::get_last_first_row(void) const
+{
+    uint32_t num_visible = get_visible_row_count();
+    return m_num_rows > num_visible ? m_num_rows - num_visible : 0;
+}
+
+bool ncurses_table_window::is_row_visible(size_t row) const
+{
+    return nullptr != get_backend_window() &&
+           row >= m_first_row &&
+           row - m_first_row < get_visible_row_count();
+}
+
+void ncurses_table_window::draw_header(void)
+{
+    if (m_line_buf.empty())
+    {
+        return;
+    }
+
+    std::fill(m_line_buf.begin(), m_line_buf.end(), ' ');
+
+    size_t pos = 0;
+    for (auto iter = m_columns.begin(); iter != m_columns.end() && pos < m_line_buf.size(); ++iter)
+    {
+        size_t len = std::min<size_t>((*iter)->get_header().size(), (*iter)->get_width());
+        len = std::min(len, m_line_buf.size() - pos);
+        memcpy(&m_line_buf[pos], (*iter)->get_header().data(), len);
+
+        pos += (*iter)->get_width() + TABLE_COLUMN_GAP;
+    }
+
+    draw_line(get_first_line(), NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+void ncurses_table_window::draw_row(size_t row)
+{
+    if (m_line_buf.empty())
+    {
+        return;
+    }
+
+    std::fill(m_line_buf.begin(), m_line_buf.end(), ' ');
+
+    size_t pos = 0;
+    for (auto iter = m_columns.begin(); iter != m_columns.end() && pos < m_line_buf.size(); ++iter)
+    {
+        /* cells that are wider than their column are cut off */
+        size_t len = (*iter)->render_cell(row, m_cell_buf.data(), m_cell_buf.size());
+        len = std::min<size_t>(len, (*iter)->get_width());
+        len = std::min(len, m_line_buf.size() - pos);
+        memcpy(&m_line_buf[pos], m_cell_buf.data(), len);
+
+        pos += (*iter)->get_width() + TABLE_COLUMN_GAP;
+    }
+
+    draw_line(get_first_line() + 1 + static_cast<uint32_t>(row - m_first_row), m_row_colors[row]);
+    m_rows_drawn++;
+}
+
+void ncurses_table_window::draw_viewport(void)
+{
+    uint32_t num_visible = get_visible_row_count();
+    for (uint32_t line = 0; line < num_visible; ++line)
+    {
+        size_t row = m_first_row + line;
+        if (row < m_num_rows)
+        {
+            draw_row(row);
+        }
+        else if (!m_line_buf.empty())
+        {
+            std::fill(m_line_buf.begin(), m_line_buf.end(), ' ');
+            draw_line(get_first_line() + 1 + line, NCURSES_CPP_TXT_COLOR_DEFAULT);
+        }
+    }
+}
+
+void ncurses_table_window::draw_line(uint32_t line, ncurses_cpp_text_colors_e line_color)
+{
+    uint32_t first_column = get_outline_window() ? 1 : 0;
+    get_backend_window()->draw_text(first_column, line, m_line_buf.data(), m_line_buf.size(), line_color);
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,334 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_task_scheduler.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Runs periodic tasks, each at its own period, on a small worker pool.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the ncurses_task_scheduler class. See the header for details.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+
+#include "ncurses_task_scheduler.h"
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* a run that starts later than this share of its period after its deadline is late */
+const int64_t LATE_PERIOD_DIVISOR = 10;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_task_scheduler::ncurses_task_scheduler(void)
+  : m_stopping(false),
+    m_run_count(0),
+    m_late_count(0),
+    m_overrun_count(0)
+{ }
+
+ncurses_task_scheduler::~ncurses_task_scheduler(void)
+{
+    stop();
+}
+
+int32_t ncurses_task_scheduler::add_task(const std::string& task_name, std::chrono::milliseconds period, task_function_t run_function)
+{
+    return add_task(task_name, period, run_function, nullptr);
+}
+
+int32_t ncurses_task_scheduler::add_task(const std::string& task_name, std::chrono::milliseconds period, task_function_t run_function, task_function_t completion_function)
+{
+    if (period.count() <= 0 ||
+        !run_function)
+    {
+        return -1;
+    }
+
+    std::unique_ptr<task_t> task(new task_t());
+    task->name = task_name;
+    task->period = period;
+    task->run_function = run_function;
+    task->completion_function = completion_function;
+    task->busy = false;
+    task->stats = ncurses_task_stats_t();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* every task has at most one deadline and one completion outstanding, so these
+     *  never grow while the tasks run */
+    m_tasks.push_back(std::move(task));
+    m_deadlines.reserve(m_tasks.size());
+    m_completed.reserve(m_tasks.size());
+    m_completing.reserve(m_tasks.size());
+
+    size_t task_idx = m_tasks.size() - 1;
+    if (!m_workers.empty())
+    {
+        schedule(task_idx, std::chrono::steady_clock::now() + m_tasks[task_idx]->period);
+    }
+
+    return static_cast<int32_t>(task_idx);
+}
+
+bool ncurses_task_scheduler::start(size_t num_workers)
+{
+    if (!m_workers.empty() ||
+        0 == num_workers)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (size_t task_idx = 0; task_idx < m_tasks.size(); ++task_idx)
+        {
+            schedule(task_idx, start_time + m_tasks[task_idx]->period);
+        }
+    }
+
+    for (size_t i = 0; i < num_workers; ++i)
+    {
+        m_workers.push_back(std::thread(&ncurses_task_scheduler::run_worker, this));
+    }
+
+    return true;
+}
+
+void ncurses_task_scheduler::stop(void)
+{
+    if (m_workers.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeup.notify_all();
+
+    for (auto iter = m_workers.begin(); iter != m_workers.end(); ++iter)
+    {
+        iter->join();
+    }
+    m_workers.clear();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = false;
+    m_deadlines.clear();
+    m_completed.clear();
+    for (auto iter = m_tasks.begin(); iter != m_tasks.end(); ++iter)
+    {
+        (*iter)->busy = false;
+    }
+}
+
+size_t ncurses_task_scheduler::run_completions(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completing.swap(m_completed);
+    }
+
+    /* the tasks stay busy until here, so the workers leave their results alone */
+    for (auto iter = m_completing.begin(); iter != m_completing.end(); ++iter)
+    {
+        (*iter)->completion_function();
+    }
+
+    size_t ret = m_completing.size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto iter = m_completing.begin(); iter != m_completing.end(); ++iter)
+    {
+        (*iter)->busy = false;
+    }
+    m_completing.clear();
+
+    return ret;
+}
+
+size_t ncurses_task_scheduler::get_task_count(void) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tasks.size();
+}
+
+std::string ncurses_task_scheduler::get_task_name(size_t task_idx) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return task_idx < m_tasks.size() ? m_tasks[task_idx]->name : std::string();
+}
+
+bool ncurses_task_scheduler::get_task_stats(size_t task_idx, ncurses_task_stats_t& stats) const
+{
+    bool ret = false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (task_idx < m_tasks.size())
+    {
+        stats = m_tasks[task_idx]->stats;
+        ret = true;
+    }
+
+    return ret;
+}
+
+uint64_t ncurses_task_scheduler::get_run_count(void) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_run_count;
+}
+
+uint64_t ncurses_task_scheduler::get_late_count(void) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_late_count;
+}
+
+uint64_t ncurses_task_scheduler::get_overrun_count(void) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_overrun_count;
+}
+
+void ncurses_task_scheduler::schedule(size_t task_idx, std::chrono::steady_clock::time_point due_time)
+{
+    /* the caller holds the lock */
+    deadline_t deadline = { due_time, task_idx };
+    m_deadlines.push_back(deadline);
+    std::push_heap(m_deadlines.begin(), m_deadlines.end());
+}
+
+void ncurses_task_scheduler::run_worker(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+        if (m_deadlines.empty())
+        {
+            m_wakeup.wait(lock);
+            continue;
+        }
+
+        auto current_time = std::chrono::steady_clock::now();
+        deadline_t deadline = m_deadlines.front();
+        if (current_time < deadline.due_time)
+        {
+            m_wakeup.wait_until(lock, deadline.due_time);
+            continue;
+        }
+
+        std::pop_heap(m_deadlines.begin(), m_deadlines.end());
+        m_deadlines.pop_back();
+
+        /* the task stays on its period; deadlines that already went by are missed */
+        task_t * task = m_tasks[deadline.task_idx].get();
+        uint64_t missed_count = static_cast<uint64_t>((current_time - deadline.due_time) / task->period);
+        schedule(deadline.task_idx, deadline.due_time + task->period * static_cast<int64_t>(missed_count + 1));
+
+        /* another worker takes over waiting for the deadline that is now on top */
+        m_wakeup.notify_one();
+
+        if (task->busy)
+        {
+            task->stats.overrun_count += missed_count + 1;
+            m_overrun_count += missed_count + 1;
+            continue;
+        }
+
+        auto start_delay = current_time - deadline.due_time;
+        task->busy = true;
+        task->stats.run_count++;
+        task->stats.start_delay_total += start_delay;
+        task->stats.start_delay_max = std::max(task->stats.start_delay_max, start_delay);
+        m_run_count++;
+        if (start_delay > task->period / LATE_PERIOD_DIVISOR)
+        {
+            task->stats.late_count++;
+            m_late_count++;
+        }
+
+        /* the functions of a task never change once it is added */
+        lock.unlock();
+        auto run_start = std::chrono::steady_clock::now();
+        task->run_function();
+        auto run_time = std::chrono::steady_clock::now() - run_start;
+        lock.lock();
+
+        task->stats.run_time_max = std::max(task->stats.run_time_max, run_time);
+        if (task->completion_function)
+        {
+            m_completed.push_back(task);
+            if (m_completion_notifier)
+            {
+                lock.unlock();
+                m_completion_notifier();
+                lock.lock();
+            }
+        }
+        else
+        {
+            task->busy = false;
+        }
+    }
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,274 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_terminal_backend.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Rendering backend that draws on a terminal through curses.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the curses rendering backend. Each backend window wraps a curses
+ *  WINDOW; staging maps onto wnoutrefresh() and committing a frame onto
+ *  doupdate().
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <unistd.h>
+
+#include <ncurses.h>
+
+#include "ncurses_colors.h"
+#include "ncurses_terminal_backend.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+class ncurses_terminal_window : public ncurses_backend_window
+{
+public:
+
+    /* the screen window (stdscr) belongs to curses and is not deleted here */
+    ncurses_terminal_window(WINDOW * window, bool owns_window)
+      : m_window(window),
+        m_owns_window(owns_window)
+    { }
+
+    virtual ~ncurses_terminal_window(void)
+    {
+        if (m_owns_window)
+        {
+            delwin(m_window);
+        }
+    }
+
+    bool draw_text(uint32_t x, uint32_t y, const char * text, size_t text_len, ncurses_cpp_text_colors_e text_color) override
+    {
+        if (NCURSES_CPP_TXT_COLOR_DEFAULT != text_color)
+        {
+            wattron(m_window, COLOR_PAIR(text_color));
+        }
+
+        bool ret = (OK == mvwaddnstr(m_window, y, x, text, text_len));
+
+        if (NCURSES_CPP_TXT_COLOR_DEFAULT != text_color)
+        {
+            wattroff(m_window, COLOR_PAIR(text_color));
+        }
+
+        return ret;
+    }
+
+    void draw_outline(void) override
+    {
+        /* use default characters for the vertical and horiziontal lines */
+        box(m_window, 0, 0);
+    }
+
+    void refresh(void) override
+    {
+        wrefresh(m_window);
+    }
+
+    bool stage(void) override
+    {
+        bool ret = false;
+
+        if (is_wintouched(m_window))
+        {
+            wnoutrefresh(m_window);
+            ret = true;
+        }
+
+        return ret;
+    }
+
+    void touch(void) override
+    {
+        touchwin(m_window);
+    }
+
+private:
+
+    WINDOW *                                                  m_window;
+    bool                                                      m_owns_window;
+};
+
+ncurses_terminal_backend::ncurses_terminal_backend(void)
+  : ncurses_terminal_backend(nullptr, nullptr)
+{ }
+
+ncurses_terminal_backend::ncurses_terminal_backend(FILE * term_out, FILE * term_in)
+  : m_term_out(term_out),
+    m_term_in(term_in),
+    m_screen(nullptr),
+    m_screen_open(false)
+{ }
+
+ncurses_terminal_backend::~ncurses_terminal_backend(void)
+{
+    close_screen();
+}
+
+bool ncurses_terminal_backend::open_screen(void)
+{
+    if (m_screen_open)
+    {
+        return true;
+    }
+
+    if (nullptr != m_term_out &&
+        nullptr != m_term_in)
+    {
+        m_screen = newterm(nullptr, m_term_out, m_term_in);
+        if (nullptr == m_screen)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        initscr();                  /* Start curses mode         */
+    }
+
+    ncurses_cpp::init_colors();     /* Start the color functionality */
+    cbreak();                       /* Line buffering disabled, Pass on
+                                     * everything to me         */
+    keypad(stdscr, TRUE);           /* I need that nifty F1     */
+    noecho();
+    curs_set(0);
+
+    /* the event loop waits for input; getch() must never block */
+    nodelay(stdscr, TRUE);
+
+    m_screen_window.reset(new ncurses_terminal_window(stdscr, false));
+    m_screen_open = true;
+
+    return true;
+}
+
+void ncurses_terminal_backend::close_screen(void)
+{
+    if (m_screen_open)
+    {
+        m_screen_window.reset();
+        endwin();                   /* End curses mode          */
+
+        if (nullptr != m_screen)
+        {
+            get_color_pair_cache().detach_screen();
+            delscreen(m_screen);
+            m_screen = nullptr;
+        }
+
+        m_screen_open = false;
+    }
+}
+
+uint32_t ncurses_terminal_backend::get_rows(void) const
+{
+    return LINES > 0 ? LINES : 0;
+}
+
+uint32_t ncurses_terminal_backend::get_cols(void) const
+{
+    return COLS > 0 ? COLS : 0;
+}
+
+void ncurses_terminal_backend::handle_resize(void)
+{
+    /* curses already resized its screen before it returned KEY_RESIZE; what was on
+     *  the terminal before is unknown, so clear it with the next update */
+    if (m_screen_open)
+    {
+        clearok(curscr, TRUE);
+    }
+}
+
+std::unique_ptr<ncurses_backend_window> ncurses_terminal_backend::create_window(uint32_t height, uint32_t width, uint32_t begin_y, uint32_t begin_x)
+{
+    std::unique_ptr<ncurses_backend_window> ret;
+
+    WINDOW * window = newwin(height, width, begin_y, begin_x);
+    if (nullptr != window)
+    {
+        ret.reset(new ncurses_terminal_window(window, true));
+    }
+
+    return ret;
+}
+
+void ncurses_terminal_backend::commit_frame(void)
+{
+    doupdate();
+}
+
+int ncurses_terminal_backend::read_char(void)
+{
+    return getch();
+}
+
+void ncurses_terminal_backend::push_char(int ch)
+{
+    ungetch(ch);
+}
+
+int ncurses_terminal_backend::get_input_fd(void) const
+{
+    return nullptr != m_term_in ? fileno(m_term_in) : STDIN_FILENO;
+}
+
+} /* end ncurses_cpp namespace */
@@ -45,9 +45,23 @@
  *                               INCLUDE_FILES
  *****************************************************************************/
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
 #include <ncurses.h>
 
 #include "ncurses_colors.h"
+#include "ncurses_terminal_backend.h"
 
 #include "ncurses_ui.h"
 
@@ -59,6 +73,31 @@ namespace ncurses_cpp {
  *****************************************************************************/
 
 const uint32_t DEFAULT_PERIODIC_TASK_INTERVAL_IN_MS = 1000;
+const size_t DEFAULT_UPDATE_QUEUE_CAPACITY = 4096;
+const int STATUS_LINE_MEASUREMENT_COLUMN = 20;
+
+/* indices into the poll descriptor array used by the event loop */
+const int POLL_INPUT_IDX = 0;
+const int POLL_TIMER_IDX = 1;
+const int POLL_WAKEUP_IDX = 2;
+const int POLL_SOCKET_IDX = 3;
+const int POLL_LAYOUT_IDX = 4;
+const int NUM_POLL_FDS = 5;
+
+/* the diagnostics statistics are recomputed once per interval */
+const std::chrono::seconds DIAGNOSTICS_INTERVAL(1);
+const uint32_t DIAGNOSTICS_WINDOW_HEIGHT = 13;
+const uint32_t DIAGNOSTICS_WINDOW_WIDTH = 26;
+
+/* below the status line against the right edge of the screen */
+const ncurses_window_geometry_t DIAGNOSTICS_GEOMETRY = {
+    { 0.0, static_cast<int32_t>(DIAGNOSTICS_WINDOW_HEIGHT) },
+    { 0.0, static_cast<int32_t>(DIAGNOSTICS_WINDOW_WIDTH) },
+    { 0.0, 1 },
+    { 1.0, -static_cast<int32_t>(DIAGNOSTICS_WINDOW_WIDTH) }
+};
+
+const char * IO_STATS_PATH = "/proc/thread-self/io";
 
 
 /******************************************************************************
@@ -73,6 +112,24 @@ const uint32_t DEFAULT_PERIODIC_TASK_INTERVAL_IN_MS = 1000;
  *                           FUNCTION IMPLEMENTATION
  *****************************************************************************/
 
+/* poll() timeout that expires just after the deadline */
+static int get_timeout_in_ms(std::chrono::steady_clock::time_point deadline, std::chrono::steady_clock::time_point current_time)
+{
+    int ret = 0;
+    if (deadline > current_time)
+    {
+        /* round up so that the deadline has passed when poll() returns */
+        ret = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - current_time).count() + 1;
+    }
+
+    return ret;
+}
+
+static double to_milliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
 /******************************************************************************
  *                           CLASS IMPLEMENTATION
  *****************************************************************************/
@@ -82,15 +139,77 @@ ncurses_ui::ncurses_ui(void)
 { }
 
 ncurses_ui::ncurses_ui(int shutdown_key, uint32_t periodic_task_interval_in_ms)
+  : ncurses_ui(shutdown_key, periodic_task_interval_in_ms, nullptr, nullptr)
+{ }
+
+ncurses_ui::ncurses_ui(int shutdown_key, uint32_t periodic_task_interval_in_ms, FILE * term_out, FILE * term_in)
+  : ncurses_ui(shutdown_key, periodic_task_interval_in_ms, std::unique_ptr<ncurses_backend>(new ncurses_terminal_backend(term_out, term_in)))
+{ }
+
+ncurses_ui::ncurses_ui(int shutdown_key, uint32_t periodic_task_interval_in_ms, std::unique_ptr<ncurses_backend> backend)
   : m_shutdown_key(shutdown_key),
-    m_periodic_task_interval_in_ms(periodic_task_interval_in_ms)
+    m_periodic_task_interval_in_ms(periodic_task_interval_in_ms),
+    m_frame_commit_mode(false),
+    m_min_frame_interval(0),
+    m_frame_count(0),
+    m_resize_count(0),
+    m_relayout_count(0),
+    m_saved_flush_count(0),
+    m_update_queue(new ncurses_update_queue(DEFAULT_UPDATE_QUEUE_CAPACITY, NCURSES_CPP_OVERFLOW_DROP_OLDEST)),
+    m_applied_update_count(0),
+    m_shm_reader(),
+    m_last_shm_poll(),
+    m_socket_server(),
+    m_layout(),
+    m_layout_path(),
+    m_layout_error(),
+    m_layout_reload_count(0),
+    m_layout_watch_fd(-1),
+    m_task_scheduler(),
+    m_task_worker_count(NCURSES_TASK_DEFAULT_WORKER_COUNT),
+    m_update_recorder(),
+    m_backend(std::move(backend)),
+    m_input_fd(-1),
+    m_timer_fd(-1),
+    m_wakeup_fd(-1),
+    m_wakeup_pending(false),
+    m_frame_pending(false),
+    m_wakeup_measurement(false),
+    m_wakeup_count(0),
+    m_wakeup_count_at_measurement_start(0),
+    m_wakeups_per_second(0.0),
+    m_diagnostics(),
+    m_frame_time_total(0),
+    m_frame_time_max(0),
+    m_periodic_task_time_max(0),
+    m_timed_frame_count(0),
+    m_frames_at_interval_start(0),
+    m_applied_at_interval_start(0),
+    m_dropped_at_interval_start(0),
+    m_terminal_bytes_at_interval_start(0),
+    m_pair_evictions_at_interval_start(0),
+    m_io_stats_fd(-1),
+    m_diagnostics_toggle_key(ERR)
 {
     setup_ncurses();
+    setup_event_sources();
+
+    /* the event loop picks up finished tasks as soon as they are handed back */
+    m_task_scheduler.set_completion_notifier([this](void) { notify_wakeup(); });
 }
 
 ncurses_ui::~ncurses_ui(void)
 {
+    m_update_queue->close();
+    m_update_coalescer.discard();
+
+    /* the reader's bindings point at fields that are about to be destroyed */
+    set_shm_reader(nullptr);
+    stop_listening();
+    stop_watching_layout();
+    stop_recording();
     cleanup_ncurses();
+    cleanup_event_sources();
 }
 
 bool ncurses_ui::add_window(std::shared_ptr<ncurses_window> window)
@@ -98,6 +217,8 @@ bool ncurses_ui::add_window(std::shared_ptr<ncurses_window> window)
     if (nullptr != window &&
         m_windows_by_name.count(window->get_window_name()) == 0)
     {
+        window->set_frame_commit_mode(m_frame_commit_mode);
+        window->set_update_recorder(m_update_recorder.get());
         m_windows_by_name[window->get_window_name()] = window;
         return true;
     }
@@ -109,37 +230,445 @@ bool ncurses_ui::add_window(std::shared_ptr<ncurses_window> window)
 
 bool ncurses_ui::run(void)
 {
+    bool ret = true;
+
     m_last_periodic_task_invocation = std::chrono::steady_clock::now();
+    m_last_frame_commit = m_last_periodic_task_invocation;
+    m_wakeup_measurement_start = m_last_periodic_task_invocation;
+    m_wakeup_count_at_measurement_start = m_wakeup_count;
+
+    /* the counters are per thread, so they are opened by the thread running the loop */
+    if (m_io_stats_fd < 0)
+    {
+        m_io_stats_fd = open(IO_STATS_PATH, O_RDONLY | O_CLOEXEC);
+    }
+
+    m_diagnostics_interval_start = m_last_periodic_task_invocation;
+    m_frames_at_interval_start = m_frame_commit_mode ? m_frame_count : m_wakeup_count;
+    m_applied_at_interval_start = m_applied_update_count;
+    m_dropped_at_interval_start = m_update_queue->get_dropped_count();
+    m_terminal_bytes_at_interval_start = read_terminal_bytes_written();
+    m_pair_evictions_at_interval_start = get_color_pair_cache().get_stats().eviction_count;
+
+    if (m_timer_fd >= 0 &&
+        m_periodic_task_interval_in_ms > 0)
+    {
+        struct itimerspec timer_spec;
+        timer_spec.it_interval.tv_sec = m_periodic_task_interval_in_ms / 1000;
+        timer_spec.it_interval.tv_nsec = (m_periodic_task_interval_in_ms % 1000) * 1000000;
+        timer_spec.it_value = timer_spec.it_interval;
+        timerfd_settime(m_timer_fd, 0, &timer_spec, nullptr);
+    }
+
+    if (m_task_scheduler.get_task_count() > 0)
+    {
+        m_task_scheduler.start(m_task_worker_count);
+    }
+
+    struct pollfd poll_fds[NUM_POLL_FDS];
+    poll_fds[POLL_INPUT_IDX].fd = m_input_fd;
+    poll_fds[POLL_TIMER_IDX].fd = m_timer_fd;
+    poll_fds[POLL_WAKEUP_IDX].fd = m_wakeup_fd;
 
-    int ch = m_shutdown_key;
     while (true)
     {
-        ch = getch();
+        /* the socket and the layout watch can be opened and closed by the handlers */
+        poll_fds[POLL_SOCKET_IDX].fd = m_socket_server.get_event_fd();
+        poll_fds[POLL_LAYOUT_IDX].fd = m_layout_watch_fd;
+
+        for (int i = 0; i < NUM_POLL_FDS; ++i)
+        {
+            /* negative descriptors are ignored by poll() */
+            poll_fds[i].events = POLLIN;
+            poll_fds[i].revents = 0;
+        }
+
+        /* sleep until something happens; there is no periodic polling */
+        int poll_ret = poll(poll_fds, NUM_POLL_FDS, get_poll_timeout_in_ms());
+        m_wakeup_count++;
+
+        if (poll_ret < 0 &&
+            EINTR != errno)
+        {
+            ret = false;
+            break;
+        }
+
+        if (0 != (poll_fds[POLL_TIMER_IDX].revents & POLLIN))
+        {
+            handle_timer();
+        }
+        else if (m_timer_fd < 0 &&
+                 m_periodic_task_interval_in_ms > 0 &&
+                 std::chrono::steady_clock::now() - m_last_periodic_task_invocation >= std::chrono::milliseconds(m_periodic_task_interval_in_ms))
+        {
+            /* no timerfd available; fall back to timing the periodic tasks here */
+            handle_timer();
+        }
+
+        if (0 != (poll_fds[POLL_WAKEUP_IDX].revents & POLLIN))
+        {
+            handle_wakeup();
+        }
+
+        /* results of the tasks that finished on the workers */
+        if (m_task_scheduler.run_completions() > 0)
+        {
+            m_frame_pending = true;
+        }
+
+        if (0 != (poll_fds[POLL_SOCKET_IDX].revents & POLLIN))
+        {
+            service_socket();
+        }
 
-        if (ch != ERR)
+        if (0 != (poll_fds[POLL_LAYOUT_IDX].revents & POLLIN))
         {
-            if (ch == m_shutdown_key)
+            handle_layout_event();
+        }
+
+        /* input is always checked because a signal (e.g. SIGWINCH) interrupts poll()
+         *  and curses may be holding characters pushed back with ungetch() */
+        if (!handle_input())
+        {
+            break;
+        }
+
+        auto render_start = std::chrono::steady_clock::now();
+        if (!m_frame_commit_mode)
+        {
+            uint64_t applied_before = m_applied_update_count;
+            apply_queued_updates();
+
+            /* keep the diagnostics overlay on top of the fields that were just drawn */
+            if (nullptr != m_diagnostics_window &&
+                applied_before != m_applied_update_count)
             {
-                break;
+                m_diagnostics_window->touch_window();
+                m_diagnostics_window->stage_frame();
+                m_backend->commit_frame();
             }
 
-            /* pass the received character to a derived class */
-            handle_char(ch);
+            auto frame_time = std::chrono::steady_clock::now() - render_start;
+            m_frame_time_total += frame_time;
+            m_frame_time_max = std::max(m_frame_time_max, frame_time);
+            m_timed_frame_count++;
+        }
+        else if (render_start - m_last_frame_commit >= m_min_frame_interval)
+        {
+            uint64_t frames_before = m_frame_count;
+            commit_frame();
+
+            if (frames_before != m_frame_count)
+            {
+                m_frame_time_total += m_last_frame_commit - render_start;
+                m_frame_time_max = std::max(m_frame_time_max, m_last_frame_commit - render_start);
+                m_timed_frame_count++;
+            }
+        }
+        else
+        {
+            /* staging is cheap; keeping the queue short between frames means bursts
+             *  of updates to the same fields do not overflow it */
+            drain_update_queue();
+        }
+
+        update_wakeup_measurement();
+        update_diagnostics();
+
+        /* hand this pass' records to the writer so the log keeps up with the screen */
+        if (nullptr != m_update_recorder)
+        {
+            m_update_recorder->flush();
+        }
+    }
+
+    if (m_timer_fd >= 0)
+    {
+        struct itimerspec timer_spec = {};
+        timerfd_settime(m_timer_fd, 0, &timer_spec, nullptr);
+    }
+
+    /* the tasks may use the derived class, which is gone by the time the destructor runs */
+    m_task_scheduler.stop();
+
+    return ret;
+}
+
+void ncurses_ui::flush_updates(void)
+{
+    /* take in everything the socket clients have sent so far; each pass handles a
+     *  bounded number of clients */
+    for (size_t pass = 0; pass <= m_socket_server.get_client_count(); ++pass)
+    {
+        if (0 == m_socket_server.service(*this))
+        {
+            break;
         }
+    }
+
+    if (m_frame_commit_mode)
+    {
+        commit_frame();
+    }
+    else
+    {
+        apply_queued_updates();
+    }
+
+    if (nullptr != m_update_recorder)
+    {
+        m_update_recorder->flush();
+    }
+}
+
+int32_t ncurses_ui::add_periodic_task(const std::string& task_name, std::chrono::milliseconds period, ncurses_task_scheduler::task_function_t run_function)
+{
+    return m_task_scheduler.add_task(task_name, period, run_function);
+}
+
+int32_t ncurses_ui::add_periodic_task(const std::string& task_name, std::chrono::milliseconds period, ncurses_task_scheduler::task_function_t run_function, ncurses_task_scheduler::task_function_t completion_function)
+{
+    return m_task_scheduler.add_task(task_name, period, run_function, completion_function);
+}
+
+void ncurses_ui::notify_wakeup(void)
+{
+    /* only the first notification after the event loop drains causes a write */
+    if (m_wakeup_fd >= 0 &&
+        !m_wakeup_pending.exchange(true))
+    {
+        uint64_t increment = 1;
+        ssize_t bytes_written = write(m_wakeup_fd, &increment, sizeof(increment));
+        (void)bytes_written;
+    }
+}
 
-        auto current_time = std::chrono::steady_clock::now();
-        auto ms_since_last_periodic_task_invocation = std::chrono::duration_cast<std::chrono::milliseconds>(current_time - m_last_periodic_task_invocation).count();
+void ncurses_ui::set_frame_commit_mode(bool enabled)
+{
+    if (m_frame_commit_mode && !enabled)
+    {
+        /* push anything still pending before going back to immediate refreshes */
+        commit_frame();
+    }
 
-        if (ms_since_last_periodic_task_invocation >= m_periodic_task_interval_in_ms)
+    m_frame_commit_mode = enabled;
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        iter->second->set_frame_commit_mode(enabled);
+    }
+
+    if (nullptr != m_diagnostics_window)
+    {
+        m_diagnostics_window->set_frame_commit_mode(enabled);
+    }
+}
+
+void ncurses_ui::set_diagnostics_visible(bool visible)
+{
+    if (visible &&
+        nullptr == m_diagnostics_window)
+    {
+        std::shared_ptr<ncurses_window> window(new ncurses_window("diagnostics"));
+        if (window->create_window(DIAGNOSTICS_GEOMETRY))
         {
-            handle_periodic_tasks();
-            m_last_periodic_task_invocation = std::chrono::steady_clock::now();
+            window->set_frame_commit_mode(m_frame_commit_mode);
+            window->add_title("diagnostics", ncurses_window::TOP, ncurses_window::CENTER, NCURSES_CPP_TXT_COLOR_DEFAULT);
+
+            m_diagnostics_fields.frame_time_avg         = window->add_field<double>(2, 1, "frame_time_avg", "frame avg %8.3f ms", 0.0);
+            m_diagnostics_fields.frame_time_max         = window->add_field<double>(2, 2, "frame_time_max", "frame max %8.3f ms", 0.0);
+            m_diagnostics_fields.periodic_task_time_max = window->add_field<double>(2, 3, "periodic_task_time_max", "tasks max %8.3f ms", 0.0);
+            m_diagnostics_fields.updates_applied        = window->add_field<double>(2, 4, "updates_applied", "applied/s %8.0f", 0.0);
+            m_diagnostics_fields.updates_dropped        = window->add_field<double>(2, 5, "updates_dropped", "dropped/s %8.0f", 0.0);
+            m_diagnostics_fields.terminal_bytes         = window->add_field<double>(2, 6, "terminal_bytes", "bytes/frm %8.0f", 0.0);
+            m_diagnostics_fields.wakeups_per_sec        = window->add_field<double>(2, 7, "wakeups_per_sec", "wakeups/s %8.1f", 0.0);
+            m_diagnostics_fields.wakeup_count           = window->add_field<uint64_t>(2, 8, "wakeup_count", "wakeups   %8u", 0);
+            m_diagnostics_fields.late_task_count        = window->add_field<uint64_t>(2, 9, "late_task_count", "late      %8u", 0);
+            m_diagnostics_fields.overrun_task_count     = window->add_field<uint64_t>(2, 10, "overrun_task_count", "overruns  %8u", 0);
+            m_diagnostics_fields.pair_evictions         = window->add_field<double>(2, 11, "pair_evictions", "pair ev/s %8.1f", 0.0);
+
+            m_diagnostics_window = window;
+            show_diagnostics();
         }
     }
+    else if (!visible &&
+             nullptr != m_diagnostics_window)
+    {
+        m_diagnostics_fields = diagnostics_fields_t();
+        m_diagnostics_window.reset();
+
+        /* restore whatever the overlay was covering */
+        redraw_all_windows();
+    }
+}
+
+void ncurses_ui::configure_update_queue(size_t capacity, ncurses_update_overflow_policy_e overflow_policy)
+{
+    /* apply whatever is still waiting in the old queue so that nothing is lost */
+    apply_queued_updates();
+    m_update_queue.reset(new ncurses_update_queue(capacity, overflow_policy));
+}
+
+void ncurses_ui::set_update_overflow_policy(ncurses_update_overflow_policy_e overflow_policy)
+{
+    m_update_queue->set_overflow_policy(overflow_policy);
+}
+
+bool ncurses_ui::post_update(const ncurses_field_handle<std::string>& handle, ncurses_string_ref field_val)
+{
+    return post_update(handle, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
+}
+
+bool ncurses_ui::post_update(const ncurses_field_handle<std::string>& handle, ncurses_string_ref field_val, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    if (handle.is_valid())
+    {
+        ncurses_field_update_t update;
+        update.field = handle.get_field();
+        update.color = field_color;
+        ncurses_field_value_traits<std::string>::store(update.value, field_val.data(), field_val.size());
+
+        ret = m_update_queue->post(update);
+        notify_wakeup();
+    }
+
+    return ret;
+}
+
+bool ncurses_ui::start_recording(const std::string& log_path)
+{
+    stop_recording();
+
+    std::unique_ptr<ncurses_update_recorder> update_recorder(new ncurses_update_recorder());
+    if (!update_recorder->open_log(log_path))
+    {
+        return false;
+    }
+
+    m_update_recorder = std::move(update_recorder);
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        iter->second->set_update_recorder(m_update_recorder.get());
+    }
 
     return true;
 }
 
+void ncurses_ui::stop_recording(void)
+{
+    if (nullptr == m_update_recorder)
+    {
+        return;
+    }
+
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        iter->second->set_update_recorder(nullptr);
+    }
+
+    m_update_recorder->close_log();
+    m_update_recorder.reset();
+}
+
+void ncurses_ui::set_shm_reader(std::shared_ptr<ncurses_shm_reader> shm_reader)
+{
+    if (nullptr != m_shm_reader &&
+        m_shm_reader != shm_reader)
+    {
+        m_shm_reader->clear_bindings();
+    }
+
+    m_shm_reader = shm_reader;
+    m_last_shm_poll = std::chrono::steady_clock::time_point();
+}
+
+bool ncurses_ui::listen_on_socket(const std::string& socket_path)
+{
+    return m_socket_server.open_socket(socket_path);
+}
+
+void ncurses_ui::stop_listening(void)
+{
+    m_socket_server.close_socket();
+}
+
+bool ncurses_ui::load_layout(const std::string& layout_path, bool watch_for_changes)
+{
+    stop_watching_layout();
+    m_layout_path = layout_path;
+
+    /* the directory is watched because editors usually save by replacing the file */
+    if (watch_for_changes)
+    {
+        size_t separator_pos = layout_path.find_last_of('/');
+        std::string layout_dir = std::string::npos == separator_pos ? "." : layout_path.substr(0, separator_pos + 1);
+
+        m_layout_watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_layout_watch_fd >= 0 &&
+            inotify_add_watch(m_layout_watch_fd, layout_dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            stop_watching_layout();
+        }
+    }
+
+    return reload_layout();
+}
+
+bool ncurses_ui::reload_layout(void)
+{
+    std::unique_ptr<ncurses_layout> layout(new ncurses_layout());
+    if (!layout->parse_file(m_layout_path))
+    {
+        m_layout_error = m_layout_path + ": " + layout->get_error();
+        return false;
+    }
+
+    return apply_layout(std::move(layout));
+}
+
+void ncurses_ui::handle_resize(void)
+{
+    m_backend->handle_resize();
+    uint32_t screen_rows = m_backend->get_rows();
+    uint32_t screen_cols = m_backend->get_cols();
+
+    /* updates that are already queued go into the windows before they are rebuilt */
+    apply_queued_updates();
+
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        if (iter->second->relayout(screen_rows, screen_cols))
+        {
+            m_relayout_count++;
+        }
+    }
+
+    if (nullptr != m_diagnostics_window &&
+        m_diagnostics_window->relayout(screen_rows, screen_cols))
+    {
+        m_relayout_count++;
+    }
+
+    draw_status_line();
+    redraw_all_windows();
+
+    m_resize_count++;
+}
+
+void ncurses_ui::set_max_frame_rate(uint32_t max_frames_per_sec)
+{
+    if (max_frames_per_sec > 0)
+    {
+        m_min_frame_interval = std::chrono::microseconds(1000000 / max_frames_per_sec);
+    }
+    else
+    {
+        m_min_frame_interval = std::chrono::microseconds(0);
+    }
+}
+
 void ncurses_ui::handle_char(int next_char)
 {
     /* nothing to do here; override in a derived class */
@@ -153,20 +682,617 @@ void ncurses_ui::handle_periodic_tasks(void)
 
 void ncurses_ui::setup_ncurses(void)
 {
-    initscr();                      /* Start curses mode         */
-    ncurses_cpp::init_colors();     /* Start the color functionality */
-    cbreak();                       /* Line buffering disabled, Pass on
-                                     * everything to me         */
-    keypad(stdscr, TRUE);           /* I need that nifty F1     */
-    noecho();
-    curs_set(0);
+    if (!m_backend->open_screen())
+    {
+        return;
+    }
+
+    /* windows are created on the active backend */
+    set_active_backend(m_backend.get());
+    m_input_fd = m_backend->get_input_fd();
+
+    draw_status_line();
+    m_backend->get_screen_window()->refresh();
+}
+
+void ncurses_ui::draw_status_line(void)
+{
+    const char * exit_str = "Press F1 to exit";
+    ncurses_backend_window * screen_window = m_backend->get_screen_window();
+    screen_window->draw_text(0, 0, exit_str, strlen(exit_str), ncurses_cpp::NCURSES_CPP_TXT_COLOR_MAGENTA);
+}
+
+ncurses_window * ncurses_ui::find_window(ncurses_string_ref window_name)
+{
+    /* there are only a handful of windows, so they are searched in place instead of
+     *  building a std::string key for the map */
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        if (window_name == iter->first)
+        {
+            return iter->second.get();
+        }
+    }
+
+    return nullptr;
+}
+
+void ncurses_ui::setup_event_sources(void)
+{
+    m_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    m_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
+
+void ncurses_ui::cleanup_event_sources(void)
+{
+    if (m_timer_fd >= 0)
+    {
+        close(m_timer_fd);
+        m_timer_fd = -1;
+    }
+
+    if (m_wakeup_fd >= 0)
+    {
+        close(m_wakeup_fd);
+        m_wakeup_fd = -1;
+    }
+
+    if (m_io_stats_fd >= 0)
+    {
+        close(m_io_stats_fd);
+        m_io_stats_fd = -1;
+    }
+}
+
+int ncurses_ui::get_poll_timeout_in_ms(void) const
+{
+    /* block indefinitely unless there is a deadline that no descriptor covers */
+    int ret = -1;
+    auto current_time = std::chrono::steady_clock::now();
+
+    if (m_frame_commit_mode &&
+        m_frame_pending)
+    {
+        ret = get_timeout_in_ms(m_last_frame_commit + m_min_frame_interval, current_time);
+    }
+
+    if (m_timer_fd < 0 &&
+        m_periodic_task_interval_in_ms > 0)
+    {
+        int periodic_timeout_in_ms = get_timeout_in_ms(m_last_periodic_task_invocation + std::chrono::milliseconds(m_periodic_task_interval_in_ms), current_time);
+        if (ret < 0 ||
+            periodic_timeout_in_ms < ret)
+        {
+            ret = periodic_timeout_in_ms;
+        }
+    }
+
+    /* published values do not wake the event loop, so it has to look for them */
+    if (nullptr != m_shm_reader)
+    {
+        /* in frame commit mode the reader is only polled when a frame is committed */
+        auto shm_deadline = m_last_shm_poll + m_shm_reader->get_poll_interval();
+        if (m_frame_commit_mode)
+        {
+            shm_deadline = std::max(shm_deadline, m_last_frame_commit + m_min_frame_interval);
+        }
+
+        int shm_timeout_in_ms = get_timeout_in_ms(shm_deadline, current_time);
+        if (ret < 0 ||
+            shm_timeout_in_ms < ret)
+        {
+            ret = shm_timeout_in_ms;
+        }
+    }
+
+    /* a visible overlay keeps updating even if nothing else is going on */
+    if (nullptr != m_diagnostics_window)
+    {
+        int diagnostics_timeout_in_ms = get_timeout_in_ms(m_diagnostics_interval_start + DIAGNOSTICS_INTERVAL, current_time);
+        if (ret < 0 ||
+            diagnostics_timeout_in_ms < ret)
+        {
+            ret = diagnostics_timeout_in_ms;
+        }
+    }
+
+    return ret;
+}
+
+bool ncurses_ui::handle_input(void)
+{
+    int ch = m_backend->read_char();
+    while (ch != ERR)
+    {
+        if (ch == m_shutdown_key)
+        {
+            return false;
+        }
+        else if (ch == m_diagnostics_toggle_key)
+        {
+            set_diagnostics_visible(!get_diagnostics_visible());
+        }
+        else
+        {
+            if (KEY_RESIZE == ch)
+            {
+                handle_resize();
+            }
+
+            /* pass the received character to a derived class */
+            handle_char(ch);
+        }
+        m_frame_pending = true;
+
+        ch = m_backend->read_char();
+    }
+
+    return true;
+}
+
+void ncurses_ui::handle_timer(void)
+{
+    if (m_timer_fd >= 0)
+    {
+        /* clear the expiration count; missed expirations only run the tasks once */
+        uint64_t expirations = 0;
+        ssize_t bytes_read = read(m_timer_fd, &expirations, sizeof(expirations));
+        (void)bytes_read;
+    }
+
+    auto task_start = std::chrono::steady_clock::now();
+    handle_periodic_tasks();
+    m_last_periodic_task_invocation = std::chrono::steady_clock::now();
+    m_periodic_task_time_max = std::max(m_periodic_task_time_max, m_last_periodic_task_invocation - task_start);
+    m_frame_pending = true;
+}
+
+void ncurses_ui::handle_wakeup(void)
+{
+    uint64_t count = 0;
+    ssize_t bytes_read = read(m_wakeup_fd, &count, sizeof(count));
+    (void)bytes_read;
+
+    /* clear the flag before the queue is drained so that any update posted after
+     *  this point triggers another wakeup */
+    m_wakeup_pending.store(false);
+    m_frame_pending = true;
+}
+
+void ncurses_ui::update_wakeup_measurement(void)
+{
+    auto current_time = std::chrono::steady_clock::now();
+    auto elapsed = current_time - m_wakeup_measurement_start;
+
+    if (elapsed >= std::chrono::seconds(1))
+    {
+        double elapsed_in_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
+        m_wakeups_per_second = (m_wakeup_count - m_wakeup_count_at_measurement_start) / elapsed_in_sec;
+        m_wakeup_count_at_measurement_start = m_wakeup_count;
+        m_wakeup_measurement_start = current_time;
+
+        if (m_wakeup_measurement)
+        {
+            char measurement_str[32];
+            int measurement_len = snprintf(measurement_str, sizeof(measurement_str), "wakeups/sec: %-10.1f", m_wakeups_per_second);
+
+            ncurses_backend_window * screen_window = m_backend->get_screen_window();
+            screen_window->draw_text(STATUS_LINE_MEASUREMENT_COLUMN, 0, measurement_str,
+                                     std::min(static_cast<size_t>(std::max(measurement_len, 0)), sizeof(measurement_str) - 1),
+                                     ncurses_cpp::NCURSES_CPP_TXT_COLOR_DEFAULT);
+            if (m_frame_commit_mode)
+            {
+                m_frame_pending = true;
+            }
+            else
+            {
+                screen_window->refresh();
+            }
+        }
+    }
+}
+
+void ncurses_ui::update_diagnostics(void)
+{
+    auto current_time = std::chrono::steady_clock::now();
+    auto elapsed = current_time - m_diagnostics_interval_start;
+
+    if (elapsed < DIAGNOSTICS_INTERVAL)
+    {
+        return;
+    }
+
+    double elapsed_in_sec = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
+    uint64_t num_frames = m_frame_commit_mode ? m_frame_count : m_wakeup_count;
+    uint64_t num_dropped = m_update_queue->get_dropped_count();
+    uint64_t terminal_bytes = read_terminal_bytes_written();
+    uint64_t pair_evictions = get_color_pair_cache().get_stats().eviction_count;
+
+    m_diagnostics.frame_time_avg_ms = m_timed_frame_count > 0 ? to_milliseconds(m_frame_time_total) / m_timed_frame_count : 0.0;
+    m_diagnostics.frame_time_max_ms = to_milliseconds(m_frame_time_max);
+    m_diagnostics.periodic_task_time_max_ms = to_milliseconds(m_periodic_task_time_max);
+    m_diagnostics.updates_applied_per_sec = (m_applied_update_count - m_applied_at_interval_start) / elapsed_in_sec;
+    m_diagnostics.updates_dropped_per_sec = (num_dropped - m_dropped_at_interval_start) / elapsed_in_sec;
+    m_diagnostics.terminal_bytes_per_frame = 0.0;
+    if (num_frames > m_frames_at_interval_start)
+    {
+        m_diagnostics.terminal_bytes_per_frame = static_cast<double>(terminal_bytes - m_terminal_bytes_at_interval_start) / (num_frames - m_frames_at_interval_start);
+    }
+    m_diagnostics.wakeups_per_sec = m_wakeups_per_second;
+    m_diagnostics.wakeup_count = m_wakeup_count;
+    m_diagnostics.late_task_count = m_task_scheduler.get_late_count();
+    m_diagnostics.overrun_task_count = m_task_scheduler.get_overrun_count();
+    m_diagnostics.pair_evictions_per_sec = (pair_evictions - m_pair_evictions_at_interval_start) / elapsed_in_sec;
+
+    m_diagnostics_interval_start = current_time;
+    m_frame_time_total = std::chrono::steady_clock::duration(0);
+    m_frame_time_max = std::chrono::steady_clock::duration(0);
+    m_periodic_task_time_max = std::chrono::steady_clock::duration(0);
+    m_timed_frame_count = 0;
+    m_frames_at_interval_start = num_frames;
+    m_applied_at_interval_start = m_applied_update_count;
+    m_dropped_at_interval_start = num_dropped;
+    m_terminal_bytes_at_interval_start = terminal_bytes;
+    m_pair_evictions_at_interval_start = pair_evictions;
+
+    if (nullptr != m_diagnostics_window)
+    {
+        show_diagnostics();
+    }
+}
+
+void ncurses_ui::show_diagnostics(void)
+{
+    m_diagnostics_fields.frame_time_avg.update_field(m_diagnostics.frame_time_avg_ms);
+    m_diagnostics_fields.frame_time_max.update_field(m_diagnostics.frame_time_max_ms);
+    m_diagnostics_fields.periodic_task_time_max.update_field(m_diagnostics.periodic_task_time_max_ms);
+    m_diagnostics_fields.updates_applied.update_field(m_diagnostics.updates_applied_per_sec);
+    m_diagnostics_fields.updates_dropped.update_field(m_diagnostics.updates_dropped_per_sec);
+    m_diagnostics_fields.terminal_bytes.update_field(m_diagnostics.terminal_bytes_per_frame);
+    m_diagnostics_fields.wakeups_per_sec.update_field(m_diagnostics.wakeups_per_sec);
+    m_diagnostics_fields.wakeup_count.update_field(m_diagnostics.wakeup_count);
+    m_diagnostics_fields.late_task_count.update_field(m_diagnostics.late_task_count);
+    m_diagnostics_fields.overrun_task_count.update_field(m_diagnostics.overrun_task_count);
+    m_diagnostics_fields.pair_evictions.update_field(m_diagnostics.pair_evictions_per_sec);
+
+    if (m_frame_commit_mode)
+    {
+        m_frame_pending = true;
+    }
+}
+
+void ncurses_ui::redraw_all_windows(void)
+{
+    ncurses_backend_window * screen_window = m_backend->get_screen_window();
+    screen_window->touch();
+    screen_window->stage();
+
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        iter->second->touch_window();
+        iter->second->stage_frame();
+    }
+
+    if (nullptr != m_diagnostics_window)
+    {
+        m_diagnostics_window->touch_window();
+        m_diagnostics_window->stage_frame();
+    }
+
+    m_backend->commit_frame();
+}
+
+uint64_t ncurses_ui::read_terminal_bytes_written(void) const
+{
+    /* all curses output is written by the user interface thread, so the bytes that
+     *  thread has written are a close measure of the terminal traffic */
+    uint64_t ret = 0;
+
+    if (m_io_stats_fd >= 0)
+    {
+        char buf[512];
+        ssize_t num_bytes = pread(m_io_stats_fd, buf, sizeof(buf) - 1, 0);
+        if (num_bytes > 0)
+        {
+            buf[num_bytes] = '\0';
+            const char * wchar = strstr(buf, "wchar:");
+            if (nullptr != wchar)
+            {
+                ret = strtoull(wchar + strlen("wchar:"), nullptr, 10);
+            }
+        }
+    }
+
+    return ret;
+}
+
+void ncurses_ui::commit_frame(void)
+{
+    bool frame_has_changes = false;
+    uint64_t deferred_refreshes = 0;
+
+    apply_queued_updates();
+
+    /* stage the status line first so that it cannot cover any of the windows */
+    frame_has_changes |= m_backend->get_screen_window()->stage();
+
+    for (auto iter = m_windows_by_name.begin(); iter != m_windows_by_name.end(); ++iter)
+    {
+        frame_has_changes |= iter->second->stage_frame();
+        deferred_refreshes += iter->second->collect_deferred_refreshes();
+    }
+
+    /* the overlay is staged last so that it stays on top of the other windows */
+    if (nullptr != m_diagnostics_window)
+    {
+        if (frame_has_changes)
+        {
+            m_diagnostics_window->touch_window();
+        }
+        frame_has_changes |= m_diagnostics_window->stage_frame();
+        deferred_refreshes += m_diagnostics_window->collect_deferred_refreshes();
+    }
+
+    /* output the backend held back from the previous frame goes out with this one */
+    frame_has_changes |= m_backend->has_deferred_output();
+
+    if (frame_has_changes)
+    {
+        m_backend->commit_frame();
+        m_frame_count++;
+
+        /* every deferred field refresh would have been a terminal flush on its own */
+        if (deferred_refreshes > 1)
+        {
+            m_saved_flush_count += deferred_refreshes - 1;
+        }
+    }
+
+    m_last_frame_commit = std::chrono::steady_clock::now();
+    m_frame_pending = m_backend->has_deferred_output();
+}
+
+void ncurses_ui::drain_update_queue(void)
+{
+    /* only drain what is already queued so that fast producers cannot keep the
+     *  user interface thread in this loop */
+    size_t max_updates = m_update_queue->get_capacity();
 
-    timeout(m_periodic_task_interval_in_ms / 4);
+    ncurses_field_update_t update;
+    while (max_updates-- > 0 &&
+           m_update_queue->pop(update))
+    {
+        m_update_coalescer.stage(update);
+    }
+}
 
-    attron(COLOR_PAIR(ncurses_cpp::NCURSES_CPP_TXT_COLOR_MAGENTA));
-    printw("Press F1 to exit");
-    refresh();
-    attroff(COLOR_PAIR(ncurses_cpp::NCURSES_CPP_TXT_COLOR_MAGENTA));
+void ncurses_ui::apply_queued_updates(void)
+{
+    drain_update_queue();
+    m_applied_update_count += m_update_coalescer.commit();
+    poll_shm_reader();
+}
+
+void ncurses_ui::service_socket(void)
+{
+    uint64_t records_before = m_socket_server.get_record_count();
+    m_socket_server.service(*this);
+
+    if (records_before != m_socket_server.get_record_count())
+    {
+        m_frame_pending = true;
+    }
+}
+
+bool ncurses_ui::handle_socket_record(const ncurses_socket_record_t& record)
+{
+    return stage_update(ncurses_string_ref(record.window_name, record.window_name_len),
+                        ncurses_string_ref(record.field_name, record.field_name_len),
+                        record.value, record.color);
+}
+
+bool ncurses_ui::stage_update(ncurses_string_ref window_name, ncurses_string_ref field_name, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    bool ret = false;
+
+    ncurses_window * window = find_window(window_name);
+    if (nullptr != window)
+    {
+        /* fields with a history check the type of each value as it is staged */
+        ncurses_field_update_t update;
+        update.field = window->find_field_base(field_name.data(), field_name.size());
+        if (nullptr != update.field &&
+            (update.field->keeps_value_history() || field_val.type == update.field->get_field_type()))
+        {
+            update.value = field_val;
+            update.color = field_color;
+            m_update_coalescer.stage(update);
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+bool ncurses_ui::apply_layout(std::unique_ptr<ncurses_layout> layout)
+{
+    const std::vector<ncurses_layout_window_t>& window_descs = layout->get_windows();
+
+    /* pending updates may point at fields of the windows that are replaced */
+    apply_queued_updates();
+
+    /* build everything before touching the current windows so that a layout that
+     *  cannot be built leaves them in place */
+    std::vector<std::shared_ptr<ncurses_window>> new_windows(window_descs.size());
+    for (size_t window_idx = 0; window_idx < window_descs.size(); ++window_idx)
+    {
+        const ncurses_layout_window_t& window_desc = window_descs[window_idx];
+        const ncurses_layout_window_t * current_desc = nullptr == m_layout ? nullptr : m_layout->find_window(window_desc.name);
+        if (nullptr != current_desc &&
+            current_desc->digest == window_desc.digest)
+        {
+            continue;
+        }
+        else if (nullptr == current_desc &&
+                 0 != m_windows_by_name.count(window_desc.name))
+        {
+            m_layout_error = m_layout_path + ": window " + window_desc.name + " already exists";
+            return false;
+        }
+
+        const ncurses_window * current_window = nullptr == current_desc ? nullptr : m_windows_by_name[window_desc.name].get();
+        std::string error;
+        new_windows[window_idx] = ncurses_layout::build_window(window_desc, current_window, m_frame_commit_mode, error);
+        if (nullptr == new_windows[window_idx])
+        {
+            m_layout_error = m_layout_path + ": " + error;
+            new_windows.clear();
+            redraw_all_windows();
+            return false;
+        }
+    }
+
+    /* a window that went away or moved leaves stale cells behind */
+    bool redraw_required = false;
+    if (nullptr != m_layout)
+    {
+        const std::vector<ncurses_layout_window_t>& current_descs = m_layout->get_windows();
+        for (auto iter = current_descs.begin(); iter != current_descs.end(); ++iter)
+        {
+            const ncurses_layout_window_t * window_desc = layout->find_window(iter->name);
+            if (nullptr == window_desc ||
+                window_desc->geometry != iter->geometry ||
+                window_desc->outline != iter->outline)
+            {
+                redraw_required = true;
+            }
+
+            if (nullptr == window_desc)
+            {
+                std::shared_ptr<ncurses_window> window = m_windows_by_name[iter->name];
+                for (size_t field_idx = 0; nullptr != m_shm_reader && field_idx < window->get_field_count(); ++field_idx)
+                {
+                    m_shm_reader->rebind_field(window->get_field(field_idx), nullptr);
+                }
+
+                window->cleanup_window();
+                m_windows_by_name.erase(iter->name);
+            }
+        }
+    }
+
+    for (size_t window_idx = 0; window_idx < window_descs.size(); ++window_idx)
+    {
+        std::shared_ptr<ncurses_window>& new_window = new_windows[window_idx];
+        if (nullptr == new_window)
+        {
+            continue;
+        }
+
+        std::shared_ptr<ncurses_window>& window = m_windows_by_name[window_descs[window_idx].name];
+        if (nullptr != window)
+        {
+            /* shared-memory slots follow their fields into the new window */
+            for (size_t field_idx = 0; nullptr != m_shm_reader && field_idx < window->get_field_count(); ++field_idx)
+            {
+                ncurses_field_base * field = window->get_field(field_idx);
+                const std::string& field_name = window->get_field_name(field_idx);
+                ncurses_field_base * new_field = new_window->find_field_base(field_name.data(), field_name.size());
+                if (nullptr != new_field &&
+                    new_field->get_field_type() != field->get_field_type())
+                {
+                    new_field = nullptr;
+                }
+
+                m_shm_reader->rebind_field(field, new_field);
+            }
+
+            window->cleanup_window();
+        }
+
+        new_window->set_update_recorder(m_update_recorder.get());
+        window = new_window;
+    }
+
+    m_layout = std::move(layout);
+    m_layout_error.clear();
+    m_layout_reload_count++;
+
+    if (redraw_required)
+    {
+        redraw_all_windows();
+    }
+    else
+    {
+        for (auto iter = new_windows.begin(); iter != new_windows.end(); ++iter)
+        {
+            if (nullptr != *iter)
+            {
+                (*iter)->touch_window();
+                (*iter)->stage_frame();
+            }
+        }
+        m_backend->commit_frame();
+    }
+
+    return true;
+}
+
+void ncurses_ui::handle_layout_event(void)
+{
+    bool layout_changed = false;
+
+    /* events are read into an aligned buffer and their headers copied out, since the
+     *  names that follow each header leave the next one unaligned */
+    alignas(struct inotify_event) char event_buffer[4096];
+    size_t separator_pos = m_layout_path.find_last_of('/');
+    const char * layout_file_name = m_layout_path.c_str() + (std::string::npos == separator_pos ? 0 : separator_pos + 1);
+
+    ssize_t bytes_read = 0;
+    while ((bytes_read = read(m_layout_watch_fd, event_buffer, sizeof(event_buffer))) > 0)
+    {
+        for (ssize_t event_offset = 0; event_offset + static_cast<ssize_t>(sizeof(struct inotify_event)) <= bytes_read; )
+        {
+            struct inotify_event event;
+            memcpy(&event, event_buffer + event_offset, sizeof(event));
+
+            const char * event_name = event_buffer + event_offset + sizeof(event);
+            if (event.len > 0 &&
+                0 == strncmp(event_name, layout_file_name, event.len))
+            {
+                layout_changed = true;
+            }
+
+            event_offset += sizeof(event) + event.len;
+        }
+    }
+
+    if (layout_changed)
+    {
+        reload_layout();
+        m_frame_pending = true;
+    }
+}
+
+void ncurses_ui::stop_watching_layout(void)
+{
+    if (m_layout_watch_fd >= 0)
+    {
+        close(m_layout_watch_fd);
+        m_layout_watch_fd = -1;
+    }
+}
+
+void ncurses_ui::poll_shm_reader(void)
+{
+    /* checking a slot that has not changed is a single load, so the reader is
+     *  polled every frame; the poll interval only bounds how long an idle event
+     *  loop sleeps before it looks again */
+    if (nullptr != m_shm_reader)
+    {
+        m_applied_update_count += m_shm_reader->poll();
+        m_last_shm_poll = std::chrono::steady_clock::now();
+    }
 }
 
 void ncurses_ui::cleanup_ncurses(void)
@@ -176,8 +1302,14 @@ void ncurses_ui::cleanup_ncurses(void)
         iter->second->cleanup_window();
     }
     m_windows_by_name.clear();
+    m_diagnostics_window.reset();
 
-    endwin();                       /* End curses mode          */
+    m_backend->close_screen();
+
+    if (get_active_backend() == m_backend.get())
+    {
+        set_active_backend(nullptr);
+    }
 }
 
 } /* end ncurses_cpp namespace */
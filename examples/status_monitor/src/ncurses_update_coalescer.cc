@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_coalescer.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Implements a last-writer-wins staging area for field updates.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements a last-writer-wins staging area for field updates. Each field
+ *  remembers its slot in the pending list, so staging an update is a constant
+ *  time operation that does not need a map lookup.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include "ncurses_update_coalescer.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+const size_t INITIAL_PENDING_CAPACITY = 256;
+
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_update_coalescer::ncurses_update_coalescer(void)
+  : m_coalesced_count(0)
+{
+    m_pending.reserve(INITIAL_PENDING_CAPACITY);
+}
+
+ncurses_update_coalescer::~ncurses_update_coalescer(void)
+{ }
+
+void ncurses_update_coalescer::stage(const ncurses_field_update_t& update)
+{
+    /* a field with a history records every value; only its redraw is coalesced */
+    if (update.field->keeps_value_history() &&
+        !update.field->record_value(update.value))
+    {
+        return;
+    }
+
+    uint32_t slot = update.field->m_pending_slot;
+
+    if (ncurses_field_base::NO_PENDING_SLOT != slot)
+    {
+        m_pending[slot].color = update.color;
+        m_pending[slot].value = update.value;
+        m_coalesced_count++;
+    }
+    else
+    {
+        update.field->m_pending_slot = static_cast<uint32_t>(m_pending.size());
+        m_pending.push_back(update);
+    }
+}
+
+size_t ncurses_update_coalescer::commit(void)
+{
+    size_t ret = 0;
+
+    for (auto iter = m_pending.begin(); iter != m_pending.end(); ++iter)
+    {
+        iter->field->m_pending_slot = ncurses_field_base::NO_PENDING_SLOT;
+
+        bool applied = iter->field->keeps_value_history() ? iter->field->redraw_field(iter->color) :
+                                                            iter->field->apply_update(iter->value, iter->color);
+        if (applied)
+        {
+            ret++;
+        }
+    }
+
+    /* clear() keeps the capacity, so a steady state frame does not allocate */
+    m_pending.clear();
+
+    return ret;
+}
+
+void ncurses_update_coalescer::discard(void)
+{
+    for (auto iter = m_pending.begin(); iter != m_pending.end(); ++iter)
+    {
+        iter->field->m_pending_slot = ncurses_field_base::NO_PENDING_SLOT;
+    }
+
+    m_pending.clear();
+}
+
+} /* end ncurses_cpp namespace */
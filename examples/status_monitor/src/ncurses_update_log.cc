@@ -0,0 +1,390 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_log.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Format of the field update log and a reader for it.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the value encoding shared by the recorder and the reader, and
+ *  the reader itself. The reader maps the whole log and decodes it in place;
+ *  only field definitions allocate.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ncurses_update_log.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* a uint64_t needs at most ten 7-bit groups */
+const size_t MAX_VARINT_LEN = 10;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_field_type_e get_update_log_value_type(ncurses_field_type_e field_type)
+{
+    switch (field_type)
+    {
+    case NCURSES_CPP_FIELD_TYPE_FLOAT_SERIES:  return NCURSES_CPP_FIELD_TYPE_FLOAT;
+    case NCURSES_CPP_FIELD_TYPE_DOUBLE_SERIES: return NCURSES_CPP_FIELD_TYPE_DOUBLE;
+    default:                                   return field_type;
+    }
+}
+
+static size_t get_fixed_value_len(ncurses_field_type_e value_type)
+{
+    switch (value_type)
+    {
+    case NCURSES_CPP_FIELD_TYPE_BOOL:
+        return 1;
+
+    case NCURSES_CPP_FIELD_TYPE_INT32:
+    case NCURSES_CPP_FIELD_TYPE_UINT32:
+    case NCURSES_CPP_FIELD_TYPE_FLOAT:
+        return sizeof(uint32_t);
+
+    default:
+        return sizeof(uint64_t);
+    }
+}
+
+size_t encode_update_log_varint(uint64_t value, uint8_t * dst)
+{
+    size_t len = 0;
+
+    while (value >= 0x80)
+    {
+        dst[len++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    dst[len++] = static_cast<uint8_t>(value);
+
+    return len;
+}
+
+size_t encode_update_log_value(const ncurses_field_value_t& field_val, uint8_t * dst)
+{
+    if (NCURSES_CPP_FIELD_TYPE_STRING == field_val.type)
+    {
+        dst[0] = field_val.str_len;
+        memcpy(dst + 1, field_val.str_val, field_val.str_len);
+        return 1 + field_val.str_len;
+    }
+    else if (NCURSES_CPP_FIELD_TYPE_BOOL == field_val.type)
+    {
+        dst[0] = field_val.bool_val ? 1 : 0;
+        return 1;
+    }
+
+    /* the union members share their first bytes, so the narrow types are copied
+     *  from the start of the union */
+    size_t len = get_fixed_value_len(field_val.type);
+    memcpy(dst, &field_val.uint64_val, len);
+    return len;
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_update_log_reader::ncurses_update_log_reader(void)
+  : m_data(nullptr),
+    m_data_len(0),
+    m_offset(0),
+    m_time_ns(0),
+    m_corrupt(false),
+    m_start_time(0)
+{ }
+
+ncurses_update_log_reader::~ncurses_update_log_reader(void)
+{
+    close_log();
+}
+
+bool ncurses_update_log_reader::open_log(const std::string& log_path)
+{
+    close_log();
+
+    int fd = open(log_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat log_stat;
+    if (0 == fstat(fd, &log_stat) &&
+        static_cast<size_t>(log_stat.st_size) >= NCURSES_UPDATE_LOG_HEADER_LEN)
+    {
+        size_t log_len = static_cast<size_t>(log_stat.st_size);
+        void * addr = mmap(nullptr, log_len, PROT_READ, MAP_SHARED, fd, 0);
+        if (MAP_FAILED != addr)
+        {
+            const uint8_t * data = static_cast<const uint8_t *>(addr);
+            uint32_t version = 0;
+            memcpy(&version, data + sizeof(NCURSES_UPDATE_LOG_MAGIC), sizeof(version));
+
+            if (0 == memcmp(data, NCURSES_UPDATE_LOG_MAGIC, sizeof(NCURSES_UPDATE_LOG_MAGIC)) &&
+                NCURSES_UPDATE_LOG_VERSION == version)
+            {
+                m_data = data;
+                m_data_len = log_len;
+                memcpy(&m_start_time, data + sizeof(NCURSES_UPDATE_LOG_MAGIC) + sizeof(version), sizeof(m_start_time));
+                rewind();
+            }
+            else
+            {
+                munmap(addr, log_len);
+            }
+        }
+    }
+    close(fd);
+
+    return is_open();
+}
+
+void ncurses_update_log_reader::close_log(void)
+{
+    if (nullptr != m_data)
+    {
+        munmap(const_cast<uint8_t *>(m_data), m_data_len);
+        m_data = nullptr;
+        m_data_len = 0;
+    }
+
+    m_fields.clear();
+    m_offset = 0;
+}
+
+bool ncurses_update_log_reader::read_update(ncurses_update_log_record_t& record)
+{
+    while (!m_corrupt &&
+           m_offset < m_data_len)
+    {
+        uint8_t kind = m_data[m_offset++];
+        if (NCURSES_UPDATE_LOG_FIELD == kind)
+        {
+            m_corrupt = !read_field();
+        }
+        else if (NCURSES_UPDATE_LOG_UPDATE == kind)
+        {
+            uint64_t time_delta = 0;
+            uint64_t field_id = 0;
+
+            if (read_varint(time_delta) &&
+                read_varint(field_id) &&
+                field_id < m_fields.size() &&
+                m_offset < m_data_len)
+            {
+                uint8_t color = m_data[m_offset++];
+                record.has_pair_colors = NCURSES_UPDATE_LOG_PAIR_COLOR == color;
+                record.color = record.has_pair_colors ? NCURSES_CPP_TXT_COLOR_DEFAULT : static_cast<ncurses_cpp_text_colors_e>(color);
+                record.foreground = NCURSES_CPP_COLOR_DEFAULT;
+                record.background = NCURSES_CPP_COLOR_DEFAULT;
+
+                if ((!record.has_pair_colors || read_pair_colors(record.foreground, record.background)) &&
+                    read_value(get_update_log_value_type(m_fields[field_id].field_type), record.value))
+                {
+                    m_time_ns += time_delta;
+                    record.time_ns = m_time_ns;
+                    record.field_id = static_cast<uint32_t>(field_id);
+                    return true;
+                }
+            }
+
+            m_corrupt = true;
+        }
+        else
+        {
+            /* the unused, zero-filled end of the last segment */
+            m_corrupt = NCURSES_UPDATE_LOG_END != kind;
+            m_offset = m_data_len;
+        }
+    }
+
+    return false;
+}
+
+void ncurses_update_log_reader::rewind(void)
+{
+    m_offset = NCURSES_UPDATE_LOG_HEADER_LEN;
+    m_time_ns = 0;
+    m_corrupt = false;
+}
+
+bool ncurses_update_log_reader::read_varint(uint64_t& value)
+{
+    value = 0;
+
+    for (size_t shift_idx = 0; shift_idx < MAX_VARINT_LEN && m_offset < m_data_len; ++shift_idx)
+    {
+        uint8_t next_byte = m_data[m_offset++];
+        value |= static_cast<uint64_t>(next_byte & 0x7F) << (7 * shift_idx);
+
+        if (0 == (next_byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ncurses_update_log_reader::read_pair_colors(ncurses_color_t& foreground, ncurses_color_t& background)
+{
+    int16_t colors[2];
+    if (m_offset + sizeof(colors) > m_data_len)
+    {
+        return false;
+    }
+
+    memcpy(colors, m_data + m_offset, sizeof(colors));
+    m_offset += sizeof(colors);
+    foreground = colors[0];
+    background = colors[1];
+
+    return true;
+}
+
+bool ncurses_update_log_reader::read_field(void)
+{
+    uint64_t field_id = 0;
+    if (!read_varint(field_id) ||
+        field_id > m_fields.size() ||
+        m_offset + 3 > m_data_len)
+    {
+        return false;
+    }
+
+    ncurses_field_type_e field_type = static_cast<ncurses_field_type_e>(m_data[m_offset]);
+    size_t window_name_len = m_data[m_offset + 1];
+    size_t field_name_len = m_data[m_offset + 2];
+    m_offset += 3;
+
+    if (m_offset + window_name_len + field_name_len > m_data_len)
+    {
+        return false;
+    }
+
+    /* after a rewind the definitions are read a second time */
+    if (field_id == m_fields.size())
+    {
+        const char * names = reinterpret_cast<const char *>(m_data + m_offset);
+
+        ncurses_update_log_field_t field;
+        field.window_name.assign(names, window_name_len);
+        field.field_name.assign(names + window_name_len, field_name_len);
+        field.field_type = field_type;
+        m_fields.push_back(field);
+    }
+    m_offset += window_name_len + field_name_len;
+
+    return true;
+}
+
+bool ncurses_update_log_reader::read_value(ncurses_field_type_e value_type, ncurses_field_value_t& field_val)
+{
+    field_val.type = value_type;
+    field_val.uint64_val = 0;
+    field_val.str_len = 0;
+
+    if (NCURSES_CPP_FIELD_TYPE_STRING == value_type)
+    {
+        if (m_offset >= m_data_len)
+        {
+            return false;
+        }
+
+        size_t str_len = m_data[m_offset++];
+        if (str_len > NCURSES_CPP_FIELD_VALUE_STR_CAPACITY ||
+            m_offset + str_len > m_data_len)
+        {
+            return false;
+        }
+
+        memcpy(field_val.str_val, m_data + m_offset, str_len);
+        field_val.str_val[str_len] = '\0';
+        field_val.str_len = static_cast<uint8_t>(str_len);
+        m_offset += str_len;
+    }
+    else if (NCURSES_CPP_FIELD_TYPE_BOOL == value_type)
+    {
+        if (m_offset >= m_data_len)
+        {
+            return false;
+        }
+
+        field_val.bool_val = 0 != m_data[m_offset++];
+    }
+    else
+    {
+        size_t len = get_fixed_value_len(value_type);
+        if (m_offset + len > m_data_len)
+        {
+            return false;
+        }
+
+        memcpy(&field_val.uint64_val, m_data + m_offset, len);
+        m_offset += len;
+    }
+
+    return true;
+}
+
+} /* end ncurses_cpp namespace */
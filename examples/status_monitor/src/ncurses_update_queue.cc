@@ -0,0 +1,216 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_queue.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Implements a bounded lock-free queue of field updates.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements a bounded lock-free queue of field updates. Each cell carries a
+ *  sequence number that tells producers and the consumer whether the cell is
+ *  free to write or ready to read, so a position is claimed with a single
+ *  compare-and-swap.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <thread>
+
+#include "ncurses_update_queue.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+ncurses_update_queue::ncurses_update_queue(size_t capacity, ncurses_update_overflow_policy_e overflow_policy)
+  : m_mask(0),
+    m_enqueue_pos(0),
+    m_dequeue_pos(0),
+    m_overflow_policy(overflow_policy),
+    m_closed(false),
+    m_enqueued_count(0),
+    m_dropped_count(0)
+{
+    size_t rounded_capacity = 2;
+    while (rounded_capacity < capacity)
+    {
+        rounded_capacity <<= 1;
+    }
+
+    m_cells.reset(new cell_t[rounded_capacity]);
+    m_mask = rounded_capacity - 1;
+
+    for (size_t i = 0; i < rounded_capacity; ++i)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+ncurses_update_queue::~ncurses_update_queue(void)
+{ }
+
+bool ncurses_update_queue::post(const ncurses_field_update_t& update)
+{
+    bool ret = false;
+
+    while (!ret)
+    {
+        ret = try_push(update);
+        if (ret)
+        {
+            m_enqueued_count.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+
+        if (m_closed.load(std::memory_order_relaxed))
+        {
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+
+        ncurses_field_update_t discarded_update;
+        switch (m_overflow_policy.load(std::memory_order_relaxed))
+        {
+        case NCURSES_CPP_OVERFLOW_DROP_OLDEST:
+            /* any thread may act as a consumer here; the cell protocol keeps this
+             *  safe against the user interface thread popping at the same time */
+            if (try_pop(discarded_update))
+            {
+                m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+
+        case NCURSES_CPP_OVERFLOW_DROP_NEWEST:
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+
+        case NCURSES_CPP_OVERFLOW_BLOCK:
+            std::this_thread::yield();
+            break;
+        }
+    }
+
+    return ret;
+}
+
+bool ncurses_update_queue::pop(ncurses_field_update_t& update)
+{
+    return try_pop(update);
+}
+
+bool ncurses_update_queue::try_push(const ncurses_field_update_t& update)
+{
+    size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell_t & cell = m_cells[pos & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.update = update;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* the cell still holds an update from the previous lap; queue is full */
+            return false;
+        }
+        else
+        {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ncurses_update_queue::try_pop(ncurses_field_update_t& update)
+{
+    size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell_t & cell = m_cells[pos & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                update = cell.update;
+                cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* nothing has been published to this cell yet; queue is empty */
+            return false;
+        }
+        else
+        {
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+} /* end ncurses_cpp namespace */
@@ -0,0 +1,442 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     ncurses_update_recorder.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Records field updates into an append-only binary log.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the update recorder: records are encoded into buffer chunks on
+ *  the recording thread and copied into mapped segments of the log file by a
+ *  writer thread.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ncurses_update_log.h"
+#include "ncurses_update_recorder.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+const size_t ncurses_update_recorder::NO_CHUNK;
+
+ncurses_update_recorder::ncurses_update_recorder(void)
+  : m_fd(-1),
+    m_last_update_ns(0),
+    m_field_count(0),
+    m_update_count(0),
+    m_dropped_update_count(0),
+    m_unmapped_color_count(0),
+    m_current_chunk(NO_CHUNK),
+    m_full_head(0),
+    m_full_count(0),
+    m_stopping(false),
+    m_bytes_written(0),
+    m_write_failed(false),
+    m_segment(nullptr),
+    m_segment_idx(0),
+    m_segment_used(0)
+{ }
+
+ncurses_update_recorder::~ncurses_update_recorder(void)
+{
+    close_log();
+}
+
+bool ncurses_update_recorder::open_log(const std::string& log_path)
+{
+    close_log();
+
+    m_fd = open(log_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_fd < 0)
+    {
+        return false;
+    }
+
+    m_segment_idx = 0;
+    if (!map_next_segment())
+    {
+        close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+
+    /* the header records the wall clock time, the updates the steady clock time */
+    m_start_time = std::chrono::steady_clock::now();
+    int64_t start_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    memcpy(m_segment, NCURSES_UPDATE_LOG_MAGIC, sizeof(NCURSES_UPDATE_LOG_MAGIC));
+    memcpy(m_segment + sizeof(NCURSES_UPDATE_LOG_MAGIC), &NCURSES_UPDATE_LOG_VERSION, sizeof(NCURSES_UPDATE_LOG_VERSION));
+    memcpy(m_segment + sizeof(NCURSES_UPDATE_LOG_MAGIC) + sizeof(NCURSES_UPDATE_LOG_VERSION), &start_time, sizeof(start_time));
+    m_segment_used = NCURSES_UPDATE_LOG_HEADER_LEN;
+
+    m_chunks.resize(NCURSES_UPDATE_RECORDER_CHUNK_COUNT);
+    m_free_chunks.clear();
+    m_free_chunks.reserve(NCURSES_UPDATE_RECORDER_CHUNK_COUNT);
+    for (size_t chunk_idx = 0; chunk_idx < m_chunks.size(); ++chunk_idx)
+    {
+        if (!m_chunks[chunk_idx].data)
+        {
+            m_chunks[chunk_idx].data.reset(new uint8_t[NCURSES_UPDATE_RECORDER_CHUNK_LEN]);
+        }
+        m_chunks[chunk_idx].len = 0;
+        m_free_chunks.push_back(chunk_idx);
+    }
+    m_full_chunks.assign(NCURSES_UPDATE_RECORDER_CHUNK_COUNT, NO_CHUNK);
+    m_full_head = 0;
+    m_full_count = 0;
+    m_current_chunk = NO_CHUNK;
+
+    m_last_update_ns = 0;
+    m_field_count = 0;
+    m_update_count = 0;
+    m_dropped_update_count = 0;
+    m_unmapped_color_count = 0;
+    m_stopping = false;
+    m_bytes_written = NCURSES_UPDATE_LOG_HEADER_LEN;
+    m_write_failed = false;
+
+    m_writer = std::thread(&ncurses_update_recorder::run_writer, this);
+
+    return true;
+}
+
+void ncurses_update_recorder::close_log(void)
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    hand_over_chunk();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_chunk_full.notify_one();
+    m_writer.join();
+
+    if (nullptr != m_segment)
+    {
+        munmap(m_segment, NCURSES_UPDATE_RECORDER_SEGMENT_LEN);
+        m_segment = nullptr;
+    }
+
+    /* drop the unused end of the last segment */
+    if (0 != ftruncate(m_fd, static_cast<off_t>(m_bytes_written)))
+    {
+        m_write_failed = true;
+    }
+    close(m_fd);
+    m_fd = -1;
+}
+
+uint32_t ncurses_update_recorder::add_field(ncurses_string_ref window_name, ncurses_string_ref field_name, ncurses_field_type_e field_type)
+{
+    uint32_t field_id = m_field_count++;
+
+    if (!is_open() ||
+        !reserve(NCURSES_UPDATE_LOG_MAX_FIELD_LEN, true))
+    {
+        return field_id;
+    }
+
+    size_t window_name_len = window_name.size() < NCURSES_UPDATE_LOG_MAX_NAME_LEN ? window_name.size() : NCURSES_UPDATE_LOG_MAX_NAME_LEN;
+    size_t field_name_len = field_name.size() < NCURSES_UPDATE_LOG_MAX_NAME_LEN ? field_name.size() : NCURSES_UPDATE_LOG_MAX_NAME_LEN;
+
+    chunk_t& chunk = m_chunks[m_current_chunk];
+    uint8_t * dst = chunk.data.get() + chunk.len;
+    size_t len = 0;
+
+    dst[len++] = NCURSES_UPDATE_LOG_FIELD;
+    len += encode_update_log_varint(field_id, dst + len);
+    dst[len++] = static_cast<uint8_t>(field_type);
+    dst[len++] = static_cast<uint8_t>(window_name_len);
+    dst[len++] = static_cast<uint8_t>(field_name_len);
+    memcpy(dst + len, window_name.data(), window_name_len);
+    len += window_name_len;
+    memcpy(dst + len, field_name.data(), field_name_len);
+    len += field_name_len;
+
+    chunk.len += len;
+
+    return field_id;
+}
+
+void ncurses_update_recorder::record_update(uint32_t field_id, const ncurses_field_value_t& field_val, ncurses_cpp_text_colors_e field_color)
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    if (!reserve(NCURSES_UPDATE_LOG_MAX_UPDATE_LEN, false))
+    {
+        m_dropped_update_count++;
+        return;
+    }
+
+    uint64_t now_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_start_time).count());
+
+    chunk_t& chunk = m_chunks[m_current_chunk];
+    uint8_t * dst = chunk.data.get() + chunk.len;
+    size_t len = 0;
+
+    dst[len++] = NCURSES_UPDATE_LOG_UPDATE;
+    len += encode_update_log_varint(now_ns - m_last_update_ns, dst + len);
+    len += encode_update_log_varint(field_id, dst + len);
+    len += encode_color(field_color, dst + len);
+    len += encode_update_log_value(field_val, dst + len);
+
+    chunk.len += len;
+    m_last_update_ns = now_ns;
+    m_update_count++;
+}
+
+size_t ncurses_update_recorder::encode_color(ncurses_cpp_text_colors_e field_color, uint8_t * dst)
+{
+    if (field_color <= NCURSES_CPP_TXT_COLOR_WHITE)
+    {
+        dst[0] = static_cast<uint8_t>(field_color);
+        return 1;
+    }
+
+    /* a pair from the color pair cache means nothing to another process */
+    int16_t colors[2];
+    if (!get_color_pair_cache().get_pair_colors(field_color, colors[0], colors[1]))
+    {
+        m_unmapped_color_count++;
+        dst[0] = NCURSES_CPP_TXT_COLOR_DEFAULT;
+        return 1;
+    }
+
+    dst[0] = NCURSES_UPDATE_LOG_PAIR_COLOR;
+    memcpy(dst + 1, colors, sizeof(colors));
+    return 1 + sizeof(colors);
+}
+
+void ncurses_update_recorder::flush(void)
+{
+    if (is_open())
+    {
+        hand_over_chunk();
+    }
+}
+
+ncurses_update_recorder_stats_t ncurses_update_recorder::get_stats(void) const
+{
+    ncurses_update_recorder_stats_t stats;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    stats.field_count = m_field_count;
+    stats.update_count = m_update_count;
+    stats.dropped_update_count = m_dropped_update_count;
+    stats.unmapped_color_count = m_unmapped_color_count;
+    stats.bytes_written = m_bytes_written;
+    stats.write_failed = m_write_failed;
+
+    return stats;
+}
+
+bool ncurses_update_recorder::reserve(size_t record_len, bool wait_for_chunk)
+{
+    if (NO_CHUNK != m_current_chunk &&
+        m_chunks[m_current_chunk].len + record_len <= NCURSES_UPDATE_RECORDER_CHUNK_LEN)
+    {
+        return true;
+    }
+
+    hand_over_chunk();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (wait_for_chunk)
+    {
+        m_chunk_free.wait(lock, [this] { return !m_free_chunks.empty(); });
+    }
+
+    if (m_free_chunks.empty())
+    {
+        return false;
+    }
+
+    m_current_chunk = m_free_chunks.back();
+    m_free_chunks.pop_back();
+
+    return true;
+}
+
+void ncurses_update_recorder::hand_over_chunk(void)
+{
+    if (NO_CHUNK == m_current_chunk ||
+        0 == m_chunks[m_current_chunk].len)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_full_chunks[(m_full_head + m_full_count) % m_full_chunks.size()] = m_current_chunk;
+        m_full_count++;
+    }
+    m_chunk_full.notify_one();
+
+    m_current_chunk = NO_CHUNK;
+}
+
+void ncurses_update_recorder::run_writer(void)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_chunk_full.wait(lock, [this] { return 0 != m_full_count || m_stopping; });
+        if (0 == m_full_count)
+        {
+            /* stopping, with every full chunk written */
+            break;
+        }
+
+        size_t chunk_idx = m_full_chunks[m_full_head];
+        m_full_head = (m_full_head + 1) % m_full_chunks.size();
+        m_full_count--;
+
+        /* the chunk belongs to the writer until it is back in the free list */
+        lock.unlock();
+        bool written = write_to_log(m_chunks[chunk_idx].data.get(), m_chunks[chunk_idx].len);
+        lock.lock();
+
+        if (written)
+        {
+            m_bytes_written += m_chunks[chunk_idx].len;
+        }
+        else
+        {
+            m_write_failed = true;
+        }
+
+        m_chunks[chunk_idx].len = 0;
+        m_free_chunks.push_back(chunk_idx);
+        m_chunk_free.notify_one();
+    }
+}
+
+bool ncurses_update_recorder::write_to_log(const uint8_t * data, size_t data_len)
+{
+    while (data_len > 0)
+    {
+        if (nullptr == m_segment)
+        {
+            return false;
+        }
+
+        if (m_segment_used == NCURSES_UPDATE_RECORDER_SEGMENT_LEN &&
+            !map_next_segment())
+        {
+            return false;
+        }
+
+        size_t room = NCURSES_UPDATE_RECORDER_SEGMENT_LEN - m_segment_used;
+        size_t len = data_len < room ? data_len : room;
+
+        memcpy(m_segment + m_segment_used, data, len);
+        m_segment_used += len;
+        data += len;
+        data_len -= len;
+    }
+
+    return true;
+}
+
+bool ncurses_update_recorder::map_next_segment(void)
+{
+    /* segment zero is mapped by open_log() with nothing before it */
+    if (nullptr != m_segment)
+    {
+        munmap(m_segment, NCURSES_UPDATE_RECORDER_SEGMENT_LEN);
+        m_segment = nullptr;
+        m_segment_idx++;
+    }
+    m_segment_used = 0;
+
+    off_t segment_offset = static_cast<off_t>(m_segment_idx * NCURSES_UPDATE_RECORDER_SEGMENT_LEN);
+    if (0 != ftruncate(m_fd, segment_offset + static_cast<off_t>(NCURSES_UPDATE_RECORDER_SEGMENT_LEN)))
+    {
+        return false;
+    }
+
+    void * addr = mmap(nullptr, NCURSES_UPDATE_RECORDER_SEGMENT_LEN, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, segment_offset);
+    if (MAP_FAILED == addr)
+    {
+        return false;
+    }
+
+    m_segment = static_cast<uint8_t *>(addr);
+
+    return true;
+}
+
+} /* end ncurses_cpp namespace */
@@ -47,8 +47,6 @@
 
 #include <algorithm>
 
-#include <ncurses.h>
-
 #include "ncurses_window.h"
 
 
@@ -73,23 +71,72 @@ const std::string TITLE_FIELD_NAME = "title";
  *                           FUNCTION IMPLEMENTATION
  *****************************************************************************/
 
+static int64_t resolve_extent(const ncurses_window_extent_t& extent, uint32_t screen_extent)
+{
+    return static_cast<int64_t>(extent.fraction * screen_extent) + extent.offset;
+}
+
+bool operator==(const ncurses_window_extent_t& lhs, const ncurses_window_extent_t& rhs)
+{
+    return lhs.fraction == rhs.fraction && lhs.offset == rhs.offset;
+}
+
+bool operator!=(const ncurses_window_extent_t& lhs, const ncurses_window_extent_t& rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool operator==(const ncurses_window_geometry_t& lhs, const ncurses_window_geometry_t& rhs)
+{
+    return lhs.height == rhs.height &&
+           lhs.width == rhs.width &&
+           lhs.row == rhs.row &&
+           lhs.column == rhs.column;
+}
+
+bool operator!=(const ncurses_window_geometry_t& lhs, const ncurses_window_geometry_t& rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool resolve_window_geometry(const ncurses_window_geometry_t& geometry, uint32_t screen_rows, uint32_t screen_cols, uint32_t& height, uint32_t& width, uint32_t& row, uint32_t& column)
+{
+    int64_t resolved_row = std::max<int64_t>(0, resolve_extent(geometry.row, screen_rows));
+    int64_t resolved_column = std::max<int64_t>(0, resolve_extent(geometry.column, screen_cols));
+    int64_t resolved_height = std::min<int64_t>(resolve_extent(geometry.height, screen_rows), screen_rows - resolved_row);
+    int64_t resolved_width = std::min<int64_t>(resolve_extent(geometry.width, screen_cols), screen_cols - resolved_column);
+
+    if (resolved_height <= 0 ||
+        resolved_width <= 0)
+    {
+        return false;
+    }
+
+    height = static_cast<uint32_t>(resolved_height);
+    width = static_cast<uint32_t>(resolved_width);
+    row = static_cast<uint32_t>(resolved_row);
+    column = static_cast<uint32_t>(resolved_column);
+
+    return true;
+}
+
 /******************************************************************************
  *                           CLASS IMPLEMENTATION
  *****************************************************************************/
 
 const std::vector<std::string> ncurses_window::RESERVED_FIELD_NAMES = { TITLE_FIELD_NAME };
 
-bool ncurses_window::is_reserved_field(std::string field_name)
+bool ncurses_window::is_reserved_field(ncurses_string_ref field_name)
 {
-    auto iter = std::find(RESERVED_FIELD_NAMES.begin(), RESERVED_FIELD_NAMES.end(), field_name);
-    if (iter == RESERVED_FIELD_NAMES.end())
-    {
-        return false;
-    }
-    else
+    for (auto iter = RESERVED_FIELD_NAMES.begin(); iter != RESERVED_FIELD_NAMES.end(); ++iter)
     {
-        return true;
+        if (field_name == *iter)
+        {
+            return true;
+        }
     }
+
+    return false;
 }
 
 ncurses_window::ncurses_window(std::string window_name)
@@ -98,9 +145,20 @@ ncurses_window::ncurses_window(std::string window_name)
 
 ncurses_window::ncurses_window(std::string window_name, bool outline_window)
   : m_window_name(window_name),
-    m_window(nullptr),
-    m_outline_window(outline_window)
-{ }
+    m_window(),
+    m_height(0),
+    m_width(0),
+    m_row(0),
+    m_column(0),
+    m_has_geometry(false),
+    m_geometry(),
+    m_outline_window(outline_window),
+    m_render_priority(0),
+    m_update_recorder(nullptr)
+{
+    m_refresh_state.frame_commit_mode = false;
+    m_refresh_state.deferred_refresh_count = 0;
+}
 
 ncurses_window::~ncurses_window(void)
 {
@@ -111,19 +169,23 @@ bool ncurses_window::create_window(uint32_t height, uint32_t width, uint32_t sta
 {
     bool ret = false;
 
-    if (nullptr == m_window)
+    ncurses_backend * backend = get_active_backend();
+    if (nullptr == m_window &&
+        nullptr != backend)
     {
-        m_window = newwin(height, width, start_x, start_y);
+        m_window = backend->create_window(height, width, start_x, start_y);
         if (nullptr != m_window)
         {
+            m_window->set_priority(m_render_priority);
             m_height = height;
             m_width = width;
+            m_row = start_x;
+            m_column = start_y;
 
             if (m_outline_window)
             {
-                /* use default characters for the vertical and horiziontal lines */
-                box(m_window, 0 , 0);
-                wrefresh(m_window);
+                m_window->draw_outline();
+                m_window->refresh();
             }
             ret = true;
         }
@@ -132,250 +194,168 @@ bool ncurses_window::create_window(uint32_t height, uint32_t width, uint32_t sta
     return ret;
 }
 
-bool ncurses_window::cleanup_window(void)
+bool ncurses_window::create_window(const ncurses_window_geometry_t& geometry)
 {
     bool ret = false;
 
-    m_str_fields.clear();
-    m_int32_fields.clear();
-    m_uint32_fields.clear();
+    ncurses_backend * backend = get_active_backend();
+    uint32_t height = 0;
+    uint32_t width = 0;
+    uint32_t row = 0;
+    uint32_t column = 0;
 
-    if (nullptr != m_window)
+    if (nullptr == m_window &&
+        nullptr != backend &&
+        resolve_window_geometry(geometry, backend->get_rows(), backend->get_cols(), height, width, row, column))
     {
-        /* TODO cleanup the screen */
-
-        delwin(m_window);
-        m_window = nullptr;
+        ret = create_window(height, width, row, column);
+        m_has_geometry = ret;
+        m_geometry = geometry;
     }
 
     return ret;
 }
 
-template <>
-bool ncurses_window::add_field_thresholds<std::string>(std::string field_name, std::pair<std::string, std::string> field_threshold_vals, ncurses_cpp_text_colors_e field_color)
+bool ncurses_window::relayout(uint32_t screen_rows, uint32_t screen_cols)
 {
-    bool ret = false;
-
-    if (m_str_fields.count(field_name) > 0)
+    ncurses_backend * backend = get_active_backend();
+    if (!m_has_geometry ||
+        nullptr == backend)
     {
-        ret = m_str_fields[field_name].add_field_thresholds(field_threshold_vals, field_color);
+        return false;
     }
 
-    return ret;
-}
-
-template <>
-bool ncurses_window::add_field_thresholds<int32_t>(std::string field_name, std::pair<int32_t, int32_t> field_threshold_vals, ncurses_cpp_text_colors_e field_color)
-{
-    bool ret = false;
-
-    if (m_int32_fields.count(field_name) > 0)
+    uint32_t height = 0;
+    uint32_t width = 0;
+    uint32_t row = 0;
+    uint32_t column = 0;
+    bool fits = resolve_window_geometry(m_geometry, screen_rows, screen_cols, height, width, row, column);
+
+    if (fits &&
+        nullptr != m_window &&
+        height == m_height &&
+        width == m_width &&
+        row == m_row &&
+        column == m_column)
     {
-        ret = m_int32_fields[field_name].add_field_thresholds(field_threshold_vals, field_color);
+        return false;
     }
-
-    return ret;
-}
-
-template <>
-bool ncurses_window::add_field_thresholds<uint32_t>(std::string field_name, std::pair<uint32_t, uint32_t> field_threshold_vals, ncurses_cpp_text_colors_e field_color)
-{
-    bool ret = false;
-
-    if (m_uint32_fields.count(field_name) > 0)
+    else if (!fits &&
+             nullptr == m_window)
     {
-        ret = m_uint32_fields[field_name].add_field_thresholds(field_threshold_vals, field_color);
+        return false;
     }
 
-    return ret;
-}
-
-template <>
-bool ncurses_window::add_field_thresholds<float>(std::string field_name, std::pair<float, float> field_threshold_vals, ncurses_cpp_text_colors_e field_color)
-{
-    bool ret = false;
-
-    if (m_float_fields.count(field_name) > 0)
+    /* the old window goes first so that the backend forgets the cells it owned */
+    m_window.reset();
+    if (fits)
     {
-        ret = m_float_fields[field_name].add_field_thresholds(field_threshold_vals, field_color);
+        m_window = backend->create_window(height, width, row, column);
     }
 
-    return ret;
-}
-
-template <>
-bool ncurses_window::add_field_thresholds<double>(std::string field_name, std::pair<double, double> field_threshold_vals, ncurses_cpp_text_colors_e field_color)
-{
-    bool ret = false;
-
-    if (m_double_fields.count(field_name) > 0)
+    if (nullptr != m_window)
     {
-        ret = m_double_fields[field_name].add_field_thresholds(field_threshold_vals, field_color);
+        m_window->set_priority(m_render_priority);
+        m_height = height;
+        m_width = width;
+        m_row = row;
+        m_column = column;
     }
-
-    return ret;
-}
-
-template <>
-bool ncurses_window::update_field<std::string>(std::string field_name, std::string field_val, ncurses_cpp_text_colors_e field_color)
-{
-    bool ret = false;
-
-    if (nullptr != m_window &&
-        m_str_fields.count(field_name) > 0)
+    else
     {
-        ret = m_str_fields[field_name].update_field(field_val, field_color);
+        m_height = 0;
+        m_width = 0;
     }
 
-    return ret;
-}
+    /* everything is redrawn into the window buffer and goes out with the next frame,
+     *  not as one terminal update per field */
+    bool frame_commit_mode = m_refresh_state.frame_commit_mode;
+    m_refresh_state.frame_commit_mode = true;
 
-template <>
-bool ncurses_window::update_field<int32_t>(std::string field_name, int32_t field_val, ncurses_cpp_text_colors_e field_color)
-{
-    bool ret = false;
-
-    if (nullptr != m_window)
+    if (nullptr != m_window &&
+        m_outline_window)
     {
-        if (m_int32_fields.count(field_name) > 0)
-        {
-            ret = m_int32_fields[field_name].update_field(field_val, field_color);
-        }
+        m_window->draw_outline();
     }
+    redraw_contents();
 
-    return ret;
+    m_refresh_state.frame_commit_mode = frame_commit_mode;
+
+    return true;
 }
 
-template <>
-bool ncurses_window::update_field<uint32_t>(std::string field_name, uint32_t field_val, ncurses_cpp_text_colors_e field_color)
+void ncurses_window::redraw_contents(void)
 {
-    bool ret = false;
-
-    if (nullptr != m_window &&
-        m_uint32_fields.count(field_name) > 0)
+    for (size_t field_idx = 0; field_idx < m_fields.size(); ++field_idx)
     {
-        ret = m_uint32_fields[field_name].update_field(field_val, field_color);
+        m_fields.get_field(field_idx)->move_to_window(m_window.get());
     }
-
-    return ret;
 }
 
-template <>
-bool ncurses_window::update_field<float>(std::string field_name, float field_val, ncurses_cpp_text_colors_e field_color)
+bool ncurses_window::cleanup_window(void)
 {
     bool ret = false;
 
-    if (nullptr != m_window &&
-        m_float_fields.count(field_name) > 0)
+    m_fields.clear();
+    handle_fields_cleared();
+
+    if (nullptr != m_window)
     {
-        ret = m_float_fields[field_name].update_field(field_val, field_color);
+        /* TODO cleanup the screen */
+
+        m_window.reset();
     }
 
     return ret;
 }
 
-template <>
-bool ncurses_window::update_field<double>(std::string field_name, double field_val, ncurses_cpp_text_colors_e field_color)
+bool ncurses_window::stage_frame(void)
 {
     bool ret = false;
 
-    if (nullptr != m_window &&
-        m_double_fields.count(field_name) > 0)
+    if (nullptr != m_window)
     {
-        ret = m_double_fields[field_name].update_field(field_val, field_color);
+        ret = m_window->stage();
     }
 
     return ret;
 }
 
-template <>
-bool ncurses_window::_add_field<std::string>(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, std::string default_val, ncurses_cpp_text_colors_e default_color)
+void ncurses_window::touch_window(void)
 {
-    bool ret = false;
-
-    if ( (!is_reserved_field(field_name) || allow_reserved_fields) &&
-         valid_field_coords(x, y) &&
-         !field_name_in_use(field_name) )
+    if (nullptr != m_window)
     {
-        auto new_field = ncurses_field<std::string>();
-        new_field.create_field(m_window, x, y, format_str, default_val, default_color);
-        m_str_fields[field_name] = new_field;
-        ret = m_str_fields[field_name].update_field(default_val);
+        m_window->touch();
     }
-
-    return ret;
 }
 
-template <>
-bool ncurses_window::_add_field<int32_t>(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, int32_t default_val, ncurses_cpp_text_colors_e default_color)
+void ncurses_window::set_render_priority(int32_t priority)
 {
-    bool ret = false;
+    m_render_priority = priority;
 
-    if ( (!is_reserved_field(field_name) || allow_reserved_fields) &&
-         valid_field_coords(x, y) &&
-         !field_name_in_use(field_name) )
+    if (nullptr != m_window)
     {
-        auto new_field = ncurses_field<int32_t>();
-        new_field.create_field(m_window, x, y, format_str, default_val, default_color);
-        m_int32_fields[field_name] = new_field;
-        ret = m_int32_fields[field_name].update_field(default_val);
+        m_window->set_priority(priority);
     }
-
-    return ret;
 }
 
-template <>
-bool ncurses_window::_add_field<uint32_t>(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, uint32_t default_val, ncurses_cpp_text_colors_e default_color)
+uint64_t ncurses_window::collect_deferred_refreshes(void)
 {
-    bool ret = false;
-
-    if ( (!is_reserved_field(field_name) || allow_reserved_fields) &&
-         valid_field_coords(x, y) &&
-         !field_name_in_use(field_name) )
-    {
-        auto new_field = ncurses_field<uint32_t>();
-        new_field.create_field(m_window, x, y, format_str, default_val, default_color);
-        m_uint32_fields[field_name] = new_field;
-        ret = m_uint32_fields[field_name].update_field(default_val);
-    }
-
+    uint64_t ret = m_refresh_state.deferred_refresh_count;
+    m_refresh_state.deferred_refresh_count = 0;
     return ret;
 }
 
-template <>
-bool ncurses_window::_add_field<float>(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, float default_val, ncurses_cpp_text_colors_e default_color)
+void ncurses_window::refresh_window(void)
 {
-    bool ret = false;
-
-    if ( (!is_reserved_field(field_name) || allow_reserved_fields) &&
-         valid_field_coords(x, y) &&
-         !field_name_in_use(field_name) )
+    if (m_refresh_state.frame_commit_mode)
     {
-        auto new_field = ncurses_field<float>();
-        new_field.create_field(m_window, x, y, format_str, default_val, default_color);
-        m_float_fields[field_name] = new_field;
-        ret = m_float_fields[field_name].update_field(default_val);
+        m_refresh_state.deferred_refresh_count++;
     }
-
-    return ret;
-}
-
-template <>
-bool ncurses_window::_add_field<double>(bool allow_reserved_fields, uint32_t x, uint32_t y, std::string field_name, std::string format_str, double default_val, ncurses_cpp_text_colors_e default_color)
-{
-    bool ret = false;
-
-    if ( (!is_reserved_field(field_name) || allow_reserved_fields) &&
-         valid_field_coords(x, y) &&
-         !field_name_in_use(field_name) )
+    else if (nullptr != m_window)
     {
-        auto new_field = ncurses_field<double>();
-        new_field.create_field(m_window, x, y, format_str, default_val, default_color);
-        m_double_fields[field_name] = new_field;
-        ret = m_double_fields[field_name].update_field(default_val);
+        m_window->refresh();
     }
-
-    return ret;
 }
 
 bool ncurses_window::add_title(std::string title_str)
@@ -388,7 +368,7 @@ bool ncurses_window::add_title(std::string title_str, vertical_alignment_e vert_
     bool ret = false;
 
     if (nullptr != m_window &&
-        m_str_fields.count(TITLE_FIELD_NAME) == 0)
+        !field_name_in_use(TITLE_FIELD_NAME))
     {
         /* calculate the x and y positions for the title string */
         uint32_t title_x = 0;
@@ -439,13 +419,29 @@ bool ncurses_window::add_title(std::string title_str, vertical_alignment_e vert_
             break;
         }
 
-        ret = _add_field<std::string>(true, title_x, title_y, TITLE_FIELD_NAME, " %s ", title_str, title_color);
-        ret &= update_field<std::string>(TITLE_FIELD_NAME, title_str);
+        ret = _add_field<std::string>(true, title_x, title_y, TITLE_FIELD_NAME, " %s ", title_str, title_color).is_valid();
     }
 
     return ret;
 }
 
+void ncurses_window::set_update_recorder(ncurses_update_recorder * update_recorder)
+{
+    m_update_recorder = update_recorder;
+
+    for (size_t field_idx = 0; field_idx < m_fields.size(); ++field_idx)
+    {
+        if (nullptr != m_update_recorder)
+        {
+            register_recorded_field(field_idx);
+        }
+        else
+        {
+            m_fields.get_field(field_idx)->set_update_recorder(nullptr, 0);
+        }
+    }
+}
+
 bool ncurses_window::valid_field_coords(uint32_t x, uint32_t y)
 {
     bool ret = false;
@@ -459,20 +455,24 @@ bool ncurses_window::valid_field_coords(uint32_t x, uint32_t y)
     return ret;
 }
 
-bool ncurses_window::field_name_in_use(std::string field_name)
+bool ncurses_window::field_name_in_use(ncurses_string_ref field_name)
 {
-    bool ret = false;
+    return nullptr != m_fields.find(field_name.data(), field_name.size());
+}
+
+void ncurses_window::register_recorded_field(size_t field_idx)
+{
+    ncurses_field_base * field = m_fields.get_field(field_idx);
+    uint32_t record_id = m_update_recorder->add_field(m_window_name, m_fields.get_field_name(field_idx), field->get_field_type());
 
-    if (m_str_fields.count(field_name) > 0 ||
-        m_int32_fields.count(field_name) > 0 ||
-        m_uint32_fields.count(field_name) > 0 ||
-        m_float_fields.count(field_name) > 0 ||
-        m_double_fields.count(field_name) > 0)
+    field->set_update_recorder(m_update_recorder, record_id);
+
+    /* the field's log starts with the value it shows, e.g. its default */
+    ncurses_field_value_t field_val;
+    if (field->get_value(field_val))
     {
-        ret = true;
+        m_update_recorder->record_update(record_id, field_val, NCURSES_CPP_TXT_COLOR_DEFAULT);
     }
-
-    return ret;
 }
 
 } /* end ncurses_cpp namespace */
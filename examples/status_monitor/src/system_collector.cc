@@ -0,0 +1,556 @@
+/******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2021 OrthogonalHawk
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * @file     system_collector.cc
+ * @author   OrthogonalHawk
+ * @date     17-Oct-2026
+ *
+ * @brief    Low-overhead collector for system statistics from /proc.
+ *
+ * @section  DESCRIPTION
+ *
+ * Implements the system collector. Each /proc file is read from offset zero
+ *  with pread() on a descriptor that stays open, which saves the open/close of
+ *  the usual fopen/fscanf approach, and the text is walked once with pointer
+ *  based number and name scanners instead of the stdio or iostream parsers.
+ *
+ * @section  HISTORY
+ *
+ * 17-Oct-2026  OrthogonalHawk  File created.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ *                               INCLUDE_FILES
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "system_collector.h"
+
+
+namespace ncurses_cpp {
+
+/******************************************************************************
+ *                                 CONSTANTS
+ *****************************************************************************/
+
+/* indexed by source_e; the buffers hold the whole file plus a NUL */
+const char * SYSTEM_SOURCE_PATHS[] = {
+    "/proc/stat",
+    "/proc/meminfo",
+    "/proc/loadavg",
+    "/proc/net/dev",
+    "/proc/diskstats"
+};
+
+const size_t SYSTEM_SOURCE_BUFFER_SIZES[] = {
+    64 * 1024,
+    8 * 1024,
+    256,
+    16 * 1024,
+    32 * 1024
+};
+
+/* /proc/net/dev starts with two lines of column headings */
+const uint32_t NET_DEV_HEADER_LINES = 2;
+
+/* /proc/net/dev has 8 receive counters followed by the transmit counters */
+const uint32_t NET_DEV_TX_BYTES_FIELD = 8;
+
+/* /proc/diskstats counts in 512 byte sectors, whatever the device's block size */
+const uint64_t DISKSTATS_SECTOR_SIZE = 512;
+
+/******************************************************************************
+ *                              ENUMS & TYPEDEFS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                                  MACROS
+ *****************************************************************************/
+
+/******************************************************************************
+ *                           FUNCTION IMPLEMENTATION
+ *****************************************************************************/
+
+static const char * skip_spaces(const char * pos, const char * end)
+{
+    while (pos < end &&
+           (' ' == *pos || '\t' == *pos))
+    {
+        pos++;
+    }
+
+    return pos;
+}
+
+static const char * next_line(const char * pos, const char * end)
+{
+    const char * newline = static_cast<const char *>(memchr(pos, '\n', end - pos));
+    return nullptr != newline ? newline + 1 : end;
+}
+
+static const char * parse_u64(const char * pos, const char * end, uint64_t& val)
+{
+    pos = skip_spaces(pos, end);
+
+    val = 0;
+    while (pos < end &&
+           *pos >= '0' && *pos <= '9')
+    {
+        val = val * 10 + static_cast<uint64_t>(*pos - '0');
+        pos++;
+    }
+
+    return pos;
+}
+
+static const char * parse_decimal(const char * pos, const char * end, double& val)
+{
+    uint64_t int_part = 0;
+    pos = parse_u64(pos, end, int_part);
+    val = static_cast<double>(int_part);
+
+    if (pos < end &&
+        '.' == *pos)
+    {
+        double scale = 0.1;
+        for (pos++; pos < end && *pos >= '0' && *pos <= '9'; pos++)
+        {
+            val += (*pos - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+
+    return pos;
+}
+
+/* copies the name up to the next blank or the terminator, truncating it */
+static const char * parse_name(const char * pos, const char * end, char terminator, char * name)
+{
+    pos = skip_spaces(pos, end);
+
+    size_t len = 0;
+    while (pos < end &&
+           terminator != *pos && ' ' != *pos && '\n' != *pos)
+    {
+        if (len < SYSTEM_COLLECTOR_NAME_CAPACITY)
+        {
+            name[len++] = *pos;
+        }
+        pos++;
+    }
+    name[len] = '\0';
+
+    return pos;
+}
+
+static bool starts_with(const char * pos, const char * end, const char * prefix, size_t prefix_len)
+{
+    return static_cast<size_t>(end - pos) >= prefix_len &&
+           0 == memcmp(pos, prefix, prefix_len);
+}
+
+/* the change in a cumulative counter per second, or zero if the counter went back */
+static double get_rate(uint64_t current, uint64_t previous, double elapsed_sec)
+{
+    return (elapsed_sec > 0.0 && current >= previous) ? (current - previous) / elapsed_sec : 0.0;
+}
+
+/******************************************************************************
+ *                           CLASS IMPLEMENTATION
+ *****************************************************************************/
+
+system_collector::system_collector(void)
+  : m_prev_cpu(),
+    m_prev_interfaces(),
+    m_prev_num_interfaces(0),
+    m_prev_disks(),
+    m_prev_num_disks(0),
+    m_sample_count(0),
+    m_snapshot()
+{
+    for (uint32_t source = 0; source < NUM_SOURCES; ++source)
+    {
+        m_fds[source] = -1;
+    }
+}
+
+system_collector::~system_collector(void)
+{
+    close_sources();
+}
+
+bool system_collector::open_sources(void)
+{
+    bool ret = false;
+
+    for (uint32_t source = 0; source < NUM_SOURCES; ++source)
+    {
+        if (m_fds[source] < 0)
+        {
+            m_fds[source] = open(SYSTEM_SOURCE_PATHS[source], O_RDONLY | O_CLOEXEC);
+        }
+
+        if (m_fds[source] >= 0)
+        {
+            m_buffers[source].resize(SYSTEM_SOURCE_BUFFER_SIZES[source]);
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+void system_collector::close_sources(void)
+{
+    for (uint32_t source = 0; source < NUM_SOURCES; ++source)
+    {
+        if (m_fds[source] >= 0)
+        {
+            close(m_fds[source]);
+            m_fds[source] = -1;
+        }
+    }
+}
+
+bool system_collector::sample(void)
+{
+    bool ret = false;
+
+    auto sample_time = std::chrono::steady_clock::now();
+    double elapsed_sec = 0.0;
+    if (m_sample_count > 0)
+    {
+        elapsed_sec = std::chrono::duration_cast<std::chrono::duration<double>>(sample_time - m_prev_sample_time).count();
+    }
+
+    const char * end = read_source(SOURCE_STAT);
+    if (nullptr != end)
+    {
+        parse_stat(m_buffers[SOURCE_STAT].data(), end);
+        ret = true;
+    }
+
+    end = read_source(SOURCE_MEMINFO);
+    if (nullptr != end)
+    {
+        parse_meminfo(m_buffers[SOURCE_MEMINFO].data(), end);
+        ret = true;
+    }
+
+    end = read_source(SOURCE_LOADAVG);
+    if (nullptr != end)
+    {
+        parse_loadavg(m_buffers[SOURCE_LOADAVG].data(), end);
+        ret = true;
+    }
+
+    end = read_source(SOURCE_NET_DEV);
+    if (nullptr != end)
+    {
+        parse_net_dev(m_buffers[SOURCE_NET_DEV].data(), end, elapsed_sec);
+        ret = true;
+    }
+
+    end = read_source(SOURCE_DISKSTATS);
+    if (nullptr != end)
+    {
+        parse_diskstats(m_buffers[SOURCE_DISKSTATS].data(), end, elapsed_sec);
+        ret = true;
+    }
+
+    m_prev_sample_time = sample_time;
+    m_sample_count++;
+
+    return ret;
+}
+
+const char * system_collector::read_source(source_e source)
+{
+    if (m_fds[source] < 0)
+    {
+        return nullptr;
+    }
+
+    /* files longer than the buffer are cut off; the parsers stop at the end of the text */
+    std::vector<char>& buf = m_buffers[source];
+    size_t len = 0;
+    while (len + 1 < buf.size())
+    {
+        ssize_t num_bytes = pread(m_fds[source], &buf[len], buf.size() - 1 - len, len);
+        if (num_bytes < 0 &&
+            EINTR == errno)
+        {
+            continue;
+        }
+        else if (num_bytes <= 0)
+        {
+            if (num_bytes < 0)
+            {
+                return nullptr;
+            }
+            break;
+        }
+
+        len += static_cast<size_t>(num_bytes);
+    }
+
+    buf[len] = '\0';
+    return buf.data() + len;
+}
+
+void system_collector::parse_stat(const char * text, const char * end)
+{
+    /* the cpu lines come first: "cpu" for all CPUs together, then "cpuN" for each */
+    uint32_t num_cpus = 0;
+    for (const char * line = text; line < end && starts_with(line, end, "cpu", 3); line = next_line(line, end))
+    {
+        const char * pos = line + 3;
+
+        uint32_t slot = 0;
+        if (pos < end && *pos >= '0' && *pos <= '9')
+        {
+            uint64_t cpu_idx = 0;
+            pos = parse_u64(pos, end, cpu_idx);
+            if (cpu_idx >= SYSTEM_COLLECTOR_MAX_CPUS)
+            {
+                continue;
+            }
+
+            slot = static_cast<uint32_t>(cpu_idx) + 1;
+            num_cpus = std::max(num_cpus, slot);
+        }
+
+        /* user nice system idle iowait irq softirq steal; guest time is already part of
+         *  user and nice */
+        uint64_t counters[8] = {};
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            pos = parse_u64(pos, end, counters[i]);
+        }
+
+        cpu_counters_t current;
+        current.busy = counters[0] + counters[1] + counters[2] + counters[5] + counters[6] + counters[7];
+        current.total = current.busy + counters[3] + counters[4];
+
+        const cpu_counters_t& previous = m_prev_cpu[slot];
+        float busy_pct = 0.0;
+        if (m_sample_count > 0 &&
+            current.total > previous.total &&
+            current.busy >= previous.busy)
+        {
+            busy_pct = 100.0 * (current.busy - previous.busy) / (current.total - previous.total);
+        }
+
+        if (0 == slot)
+        {
+            m_snapshot.cpu_pct = busy_pct;
+        }
+        else
+        {
+            m_snapshot.per_cpu_pct[slot - 1] = busy_pct;
+        }
+        m_prev_cpu[slot] = current;
+    }
+
+    m_snapshot.num_cpus = num_cpus;
+}
+
+void system_collector::parse_meminfo(const char * text, const char * end)
+{
+    uint64_t mem_free_kb = 0;
+    uint64_t buffers_kb = 0;
+    uint64_t cached_kb = 0;
+    bool has_available = false;
+
+    for (const char * line = text; line < end; line = next_line(line, end))
+    {
+        uint64_t * value = nullptr;
+        const char * pos = line;
+
+        if (starts_with(line, end, "MemTotal:", 9))            { value = &m_snapshot.mem_total_kb; pos += 9; }
+        else if (starts_with(line, end, "MemFree:", 8))        { value = &mem_free_kb; pos += 8; }
+        else if (starts_with(line, end, "MemAvailable:", 13))  { value = &m_snapshot.mem_available_kb; pos += 13; has_available = true; }
+        else if (starts_with(line, end, "Buffers:", 8))        { value = &buffers_kb; pos += 8; }
+        else if (starts_with(line, end, "Cached:", 7))         { value = &cached_kb; pos += 7; }
+        else if (starts_with(line, end, "SwapTotal:", 10))     { value = &m_snapshot.swap_total_kb; pos += 10; }
+        else if (starts_with(line, end, "SwapFree:", 9))       { value = &m_snapshot.swap_free_kb; pos += 9; }
+
+        if (nullptr != value)
+        {
+            parse_u64(pos, end, *value);
+        }
+    }
+
+    /* kernels before 3.14 do not report MemAvailable */
+    if (!has_available)
+    {
+        m_snapshot.mem_available_kb = std::min(m_snapshot.mem_total_kb, mem_free_kb + buffers_kb + cached_kb);
+    }
+
+    m_snapshot.mem_used_pct = 0.0;
+    if (m_snapshot.mem_total_kb > 0)
+    {
+        m_snapshot.mem_used_pct = 100.0 * (m_snapshot.mem_total_kb - std::min(m_snapshot.mem_available_kb, m_snapshot.mem_total_kb)) / m_snapshot.mem_total_kb;
+    }
+
+    m_snapshot.swap_used_pct = 0.0;
+    if (m_snapshot.swap_total_kb > 0)
+    {
+        m_snapshot.swap_used_pct = 100.0 * (m_snapshot.swap_total_kb - std::min(m_snapshot.swap_free_kb, m_snapshot.swap_total_kb)) / m_snapshot.swap_total_kb;
+    }
+}
+
+void system_collector::parse_loadavg(const char * text, const char * end)
+{
+    const char * pos = text;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        double load = 0.0;
+        pos = parse_decimal(pos, end, load);
+        m_snapshot.load_avg[i] = static_cast<float>(load);
+    }
+}
+
+void system_collector::parse_net_dev(const char * text, const char * end, double elapsed_sec)
+{
+    const char * line = text;
+    for (uint32_t i = 0; i < NET_DEV_HEADER_LINES; ++i)
+    {
+        line = next_line(line, end);
+    }
+
+    uint32_t num_interfaces = 0;
+    for (; line < end && num_interfaces < SYSTEM_COLLECTOR_MAX_INTERFACES; line = next_line(line, end))
+    {
+        system_interface_stats_t& interface = m_snapshot.interfaces[num_interfaces];
+
+        const char * pos = parse_name(line, end, ':', interface.name);
+        if (pos >= end || ':' != *pos)
+        {
+            continue;
+        }
+        pos++;
+
+        for (uint32_t field = 0; field <= NET_DEV_TX_BYTES_FIELD; ++field)
+        {
+            uint64_t counter = 0;
+            pos = parse_u64(pos, end, counter);
+
+            if (0 == field)
+            {
+                interface.rx_bytes = counter;
+            }
+            else if (NET_DEV_TX_BYTES_FIELD == field)
+            {
+                interface.tx_bytes = counter;
+            }
+        }
+
+        /* interfaces can come and go between samples, so they are matched by name */
+        interface.rx_bytes_per_sec = 0.0;
+        interface.tx_bytes_per_sec = 0.0;
+        for (uint32_t prev = 0; prev < m_prev_num_interfaces; ++prev)
+        {
+            if (0 == strcmp(m_prev_interfaces[prev].name, interface.name))
+            {
+                interface.rx_bytes_per_sec = get_rate(interface.rx_bytes, m_prev_interfaces[prev].rx_bytes, elapsed_sec);
+                interface.tx_bytes_per_sec = get_rate(interface.tx_bytes, m_prev_interfaces[prev].tx_bytes, elapsed_sec);
+                break;
+            }
+        }
+
+        num_interfaces++;
+    }
+
+    m_snapshot.num_interfaces = num_interfaces;
+    memcpy(m_prev_interfaces, m_snapshot.interfaces, num_interfaces * sizeof(system_interface_stats_t));
+    m_prev_num_interfaces = num_interfaces;
+}
+
+void system_collector::parse_diskstats(const char * text, const char * end, double elapsed_sec)
+{
+    uint32_t num_disks = 0;
+    for (const char * line = text; line < end && num_disks < SYSTEM_COLLECTOR_MAX_DISKS; line = next_line(line, end))
+    {
+        system_disk_stats_t& disk = m_snapshot.disks[num_disks];
+
+        /* major and minor numbers, then the device name */
+        uint64_t device_num = 0;
+        const char * pos = parse_u64(line, end, device_num);
+        pos = parse_u64(pos, end, device_num);
+        pos = parse_name(pos, end, ' ', disk.name);
+
+        /* reads, reads merged, sectors read, ms reading, writes, writes merged, sectors
+         *  written, ms writing, I/Os in progress, ms doing I/O */
+        uint64_t counters[10] = {};
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            pos = parse_u64(pos, end, counters[i]);
+        }
+
+        /* leave out RAM and loop devices and anything that has never been used */
+        if (0 == strncmp(disk.name, "loop", 4) ||
+            0 == strncmp(disk.name, "ram", 3) ||
+            (0 == counters[0] && 0 == counters[4]))
+        {
+            continue;
+        }
+
+        disk.read_bytes = counters[2] * DISKSTATS_SECTOR_SIZE;
+        disk.write_bytes = counters[6] * DISKSTATS_SECTOR_SIZE;
+        disk.io_time_ms = counters[9];
+
+        disk.read_bytes_per_sec = 0.0;
+        disk.write_bytes_per_sec = 0.0;
+        disk.busy_pct = 0.0;
+        for (uint32_t prev = 0; prev < m_prev_num_disks; ++prev)
+        {
+            if (0 == strcmp(m_prev_disks[prev].name, disk.name))
+            {
+                disk.read_bytes_per_sec = get_rate(disk.read_bytes, m_prev_disks[prev].read_bytes, elapsed_sec);
+                disk.write_bytes_per_sec = get_rate(disk.write_bytes, m_prev_disks[prev].write_bytes, elapsed_sec);
+                disk.busy_pct = std::min(100.0, get_rate(disk.io_time_ms, m_prev_disks[prev].io_time_ms, elapsed_sec) / 10.0);
+                break;
+            }
+        }
+
+        num_disks++;
+    }
+
+    m_snapshot.num_disks = num_disks;
+    memcpy(m_prev_disks, m_snapshot.disks, num_disks * sizeof(system_disk_stats_t));
+    m_prev_num_disks = num_disks;
+}
+
+} /* end ncurses_cpp namespace */
@@ -35,7 +35,10 @@
  * @section  DESCRIPTION
  *
  * This 'status monitor' example shows how to create an interface that periodically
- *  updates based on new information.
+ *  updates based on new information. It samples the system statistics in /proc ten
+ *  times per second on a worker thread and shows the CPU, memory and load figures in
+ *  fields, the CPU history as a sparkline and the per-CPU, network interface and
+ *  disk figures in scrolling tables. TAB moves the scroll keys between the tables.
  *
  * @section  HISTORY
  *
@@ -48,19 +51,46 @@
  *****************************************************************************/
 
 #include <chrono>
-#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <string>
 
 #include <ncurses.h>
 
+#include "ncurses_color_gradient.h"
+#include "ncurses_table_window.h"
 #include "ncurses_ui.h"
 #include "ncurses_window.h"
+#include "system_collector.h"
 
 
 /******************************************************************************
  *                                 CONSTANTS
  *****************************************************************************/
 
-const std::string DEMO_UI_WINDOW_NAME = "main";
+const std::string SYSTEM_WINDOW_NAME = "system";
+const std::string CPUS_WINDOW_NAME = "cpus";
+const std::string DEVICES_WINDOW_NAME = "devices";
+
+const std::chrono::milliseconds SAMPLE_INTERVAL(100);
+
+/* the system and cpus windows share the top of the screen and the devices table
+ *  spans its width underneath; the windows follow the terminal when it is resized */
+const ncurses_cpp::ncurses_window_geometry_t SYSTEM_WINDOW_GEOMETRY = { { 0.0, 8 }, { 0.5, -1 }, { 0.0, 1 }, { 0.0, 1 } };
+const ncurses_cpp::ncurses_window_geometry_t CPUS_WINDOW_GEOMETRY = { { 0.0, 8 }, { 0.5, -1 }, { 0.0, 1 }, { 0.5, 0 } };
+const ncurses_cpp::ncurses_window_geometry_t DEVICES_WINDOW_GEOMETRY = { { 0.0, 12 }, { 1.0, -2 }, { 0.0, 9 }, { 0.0, 1 } };
+
+/* one minute of CPU history */
+const size_t CPU_HISTORY_LEN = 600;
+
+const double BYTES_PER_KB = 1024.0;
+
+/* columns of the devices table */
+const size_t DEVICE_NAME_COLUMN = 0;
+const size_t DEVICE_KIND_COLUMN = 1;
+const size_t DEVICE_IN_COLUMN = 2;
+const size_t DEVICE_OUT_COLUMN = 3;
+const size_t DEVICE_BUSY_COLUMN = 4;
 
 
 /******************************************************************************
@@ -75,6 +105,28 @@ const std::string DEMO_UI_WINDOW_NAME = "main";
  *                           FUNCTION IMPLEMENTATION
  *****************************************************************************/
 
+/* colored by threshold bands, or shaded along the gradient when one is given */
+static ncurses_cpp::ncurses_field_handle<float> add_percent_field(ncurses_cpp::ncurses_window& window, uint32_t y, const std::string& label,
+                                                                  std::shared_ptr<const ncurses_cpp::ncurses_color_gradient> gradient)
+{
+    window.add_field<std::string>(2, y, label + "_label", "%s", label);
+
+    auto field = window.add_field<float>(8, y, label, "%5.1f %%", 0.0);
+    if (nullptr != gradient &&
+        field.is_valid())
+    {
+        field.get_field()->set_color_gradient(gradient);
+    }
+    else
+    {
+        window.add_field_thresholds<float>(label, std::make_pair<float, float>(0.0, 75.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_GREEN);
+        window.add_field_thresholds<float>(label, std::make_pair<float, float>(75.0, 90.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_YELLOW);
+        window.add_field_thresholds<float>(label, std::make_pair<float, float>(90.0, 100.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_RED);
+    }
+
+    return field;
+}
+
 /******************************************************************************
  *                           CLASS IMPLEMENTATION
  *****************************************************************************/
@@ -84,67 +136,208 @@ class demo_ui : public ncurses_cpp::ncurses_ui
 public:
 
     demo_ui(void)
-      : ncurses_ui(KEY_F(1), 1000),
-        m_ran_tasks(false)
+      : ncurses_ui(KEY_F(1), 0),
+        m_sample_ok(false),
+        m_scroll_devices(true)
+    {
+        m_collector.open_sources();
+
+        auto system_window = std::make_shared<ncurses_cpp::ncurses_window>(SYSTEM_WINDOW_NAME, true);
+        system_window->create_window(SYSTEM_WINDOW_GEOMETRY);
+        system_window->add_title(SYSTEM_WINDOW_NAME);
+        auto cpu_gradient = std::make_shared<ncurses_cpp::ncurses_color_gradient>();
+        if (!cpu_gradient->create_gradient(0.0, 100.0, { ncurses_cpp::ncurses_rgb(0, 205, 0), ncurses_cpp::ncurses_rgb(205, 205, 0), ncurses_cpp::ncurses_rgb(255, 0, 0) }, COLOR_BLACK))
+        {
+            cpu_gradient.reset();
+        }
+        m_cpu = add_percent_field(*system_window, 1, "cpu", cpu_gradient);
+        m_cpu_history = system_window->add_sparkline<float>(2, 2, "cpu_history", 34, CPU_HISTORY_LEN, ncurses_cpp::NCURSES_CPP_TXT_COLOR_CYAN);
+        m_cpu_history.get_field()->set_range(0.0, 100.0);
+        m_mem = add_percent_field(*system_window, 3, "mem", nullptr);
+        m_swap = add_percent_field(*system_window, 4, "swap", nullptr);
+        system_window->add_field<std::string>(2, 5, "load_label", "%s", "load");
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            m_load[i] = system_window->add_field<float>(8 + i * 6, 5, "load_" + std::to_string(i), "%5.2f", 0.0);
+        }
+        add_window(system_window);
+
+        m_cpus = std::make_shared<ncurses_cpp::ncurses_table_window>(CPUS_WINDOW_NAME, true);
+        m_cpus->add_column<std::string>("cpu", 6, "%s");
+        m_cpus->add_column<float>("busy %", 8, "%6.1f");
+        m_cpus->create_window(CPUS_WINDOW_GEOMETRY);
+        m_cpus->add_title(CPUS_WINDOW_NAME);
+        add_window(m_cpus);
+
+        m_devices = std::make_shared<ncurses_cpp::ncurses_table_window>(DEVICES_WINDOW_NAME, true);
+        m_devices->add_column<std::string>("device", 16, "%s");
+        m_devices->add_column<std::string>("kind", 5, "%s");
+        m_devices->add_column<double>("rx/rd KB/s", 12, "%12.1f");
+        m_devices->add_column<double>("tx/wr KB/s", 12, "%12.1f");
+        m_devices->add_column<float>("busy %", 8, "%6.1f");
+        m_devices->create_window(DEVICES_WINDOW_GEOMETRY);
+        m_devices->add_title(DEVICES_WINDOW_NAME);
+        add_window(m_devices);
+
+        m_collector.sample();
+
+        /* /proc is read on a worker thread so that a slow read never holds up the
+         *  keyboard; the snapshot is shown on the user interface thread */
+        add_periodic_task("system_collector", SAMPLE_INTERVAL,
+                          [this](void) { m_sample_ok = m_collector.sample(); },
+                          [this](void) { show_snapshot(); });
+    }
+
+    void handle_char(int next_char) override
     {
-        auto my_window = std::make_shared<ncurses_cpp::ncurses_window>(DEMO_UI_WINDOW_NAME, true);
-        my_window->create_window(10, 20, 2, 2);
-        my_window->add_field<std::string>(1, 1, "test_str", "%s", "hello", ncurses_cpp::NCURSES_CPP_TXT_COLOR_CYAN);
-        my_window->add_field<int32_t>(2, 4, "test_int", "%d", 100);
-        my_window->add_field<uint32_t>(5, 8, "test_uint", "0x%08x", 0xFEEDBEEF);
-        my_window->add_field<float>(1, 7, "test_float", "%.1f", 0.0);
-        my_window->add_field_thresholds<float>("test_float", std::make_pair<float, float>(0.0, 75.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_GREEN);
-        my_window->add_field_thresholds<float>("test_float", std::make_pair<float, float>(75.0, 90.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_YELLOW);
-        my_window->add_field_thresholds<float>("test_float", std::make_pair<float, float>(90.0, 100.0), ncurses_cpp::NCURSES_CPP_TXT_COLOR_RED);
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-
-        add_window(my_window);
+        if ('\t' == next_char)
+        {
+            m_scroll_devices = !m_scroll_devices;
+        }
+        else if (m_scroll_devices)
+        {
+            m_devices->handle_scroll_key(next_char);
+        }
+        else
+        {
+            m_cpus->handle_scroll_key(next_char);
+        }
     }
 
-    void handle_periodic_tasks(void) override
+private:
+
+    void show_snapshot(void)
     {
-        if (!m_ran_tasks)
+        if (!m_sample_ok)
+        {
+            return;
+        }
+
+        const ncurses_cpp::system_snapshot_t& snapshot = m_collector.get_snapshot();
+
+        m_cpu.update_field(snapshot.cpu_pct);
+        m_cpu_history.add_sample(snapshot.cpu_pct);
+        m_mem.update_field(snapshot.mem_used_pct);
+        m_swap.update_field(snapshot.swap_used_pct);
+        for (uint32_t i = 0; i < 3; ++i)
         {
-            if(!update_field<std::string>(DEMO_UI_WINDOW_NAME, "test_str", "world", ncurses_cpp::NCURSES_CPP_TXT_COLOR_GREEN))
+            m_load[i].update_field(snapshot.load_avg[i]);
+        }
+
+        /* the names only need to be filled in when the CPUs or devices change */
+        if (m_cpus->get_row_count() != snapshot.num_cpus)
+        {
+            m_cpus->set_row_count(snapshot.num_cpus);
+            for (uint32_t cpu = 0; cpu < snapshot.num_cpus; ++cpu)
             {
-                printf("Failed to update!!!\n");
+                m_cpus->set_cell<std::string>(cpu, 0, "cpu" + std::to_string(cpu));
             }
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-
-            update_field<int32_t>(DEMO_UI_WINDOW_NAME, "test_int", 255, ncurses_cpp::NCURSES_CPP_TXT_COLOR_RED);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-
-            update_field<uint32_t>(DEMO_UI_WINDOW_NAME, "test_uint", 0xBEEFBEEF, ncurses_cpp::NCURSES_CPP_TXT_COLOR_YELLOW);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-
-            update_field<float>(DEMO_UI_WINDOW_NAME, "test_float", 50.0);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            update_field<float>(DEMO_UI_WINDOW_NAME, "test_float", 60.0);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            update_field<float>(DEMO_UI_WINDOW_NAME, "test_float", 76.0);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            update_field<float>(DEMO_UI_WINDOW_NAME, "test_float", 91.0);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            update_field<float>(DEMO_UI_WINDOW_NAME, "test_float", 100.0);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            update_field<float>(DEMO_UI_WINDOW_NAME, "test_float", 101.0);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-            m_ran_tasks = true;
         }
+
+        for (uint32_t cpu = 0; cpu < snapshot.num_cpus; ++cpu)
+        {
+            m_cpus->set_cell<float>(cpu, 1, snapshot.per_cpu_pct[cpu]);
+        }
+
+        update_devices(snapshot);
     }
 
-private:
+    void update_devices(const ncurses_cpp::system_snapshot_t& snapshot)
+    {
+        size_t num_rows = snapshot.num_interfaces + snapshot.num_disks;
+        bool names_changed = m_devices->get_row_count() != num_rows;
+        m_devices->set_row_count(num_rows);
+
+        for (uint32_t i = 0; i < snapshot.num_interfaces; ++i)
+        {
+            const ncurses_cpp::system_interface_stats_t& interface = snapshot.interfaces[i];
+            update_device_name(i, interface.name, "net", names_changed);
+            m_devices->set_cell<double>(i, DEVICE_IN_COLUMN, interface.rx_bytes_per_sec / BYTES_PER_KB);
+            m_devices->set_cell<double>(i, DEVICE_OUT_COLUMN, interface.tx_bytes_per_sec / BYTES_PER_KB);
+        }
+
+        for (uint32_t i = 0; i < snapshot.num_disks; ++i)
+        {
+            const ncurses_cpp::system_disk_stats_t& disk = snapshot.disks[i];
+            size_t row = snapshot.num_interfaces + i;
+            update_device_name(row, disk.name, "disk", names_changed);
+            m_devices->set_cell<double>(row, DEVICE_IN_COLUMN, disk.read_bytes_per_sec / BYTES_PER_KB);
+            m_devices->set_cell<double>(row, DEVICE_OUT_COLUMN, disk.write_bytes_per_sec / BYTES_PER_KB);
+            m_devices->set_cell<float>(row, DEVICE_BUSY_COLUMN, disk.busy_pct);
+        }
+    }
+
+    void update_device_name(size_t row, const char * name, const char * kind, bool names_changed)
+    {
+        std::string current_name;
+        if (names_changed ||
+            !m_devices->get_cell<std::string>(row, DEVICE_NAME_COLUMN, current_name) ||
+            0 != strcmp(current_name.c_str(), name))
+        {
+            m_devices->set_cell<std::string>(row, DEVICE_NAME_COLUMN, name);
+            m_devices->set_cell<std::string>(row, DEVICE_KIND_COLUMN, kind);
+        }
+    }
 
-    bool                                             m_ran_tasks;
+    ncurses_cpp::system_collector                                   m_collector;
+    bool                                                            m_sample_ok;
+    bool                                                            m_scroll_devices;
+    ncurses_cpp::ncurses_field_handle<float>                        m_cpu;
+    ncurses_cpp::ncurses_sparkline_handle<float>                    m_cpu_history;
+    ncurses_cpp::ncurses_field_handle<float>                        m_mem;
+    ncurses_cpp::ncurses_field_handle<float>                        m_swap;
+    ncurses_cpp::ncurses_field_handle<float>                        m_load[3];
+    std::shared_ptr<ncurses_cpp::ncurses_table_window>              m_cpus;
+    std::shared_ptr<ncurses_cpp::ncurses_table_window>              m_devices;
 };
 
 int main(int argc, char *argv[])
 {
-    (void)argc;
-    (void)argv;
+    std::string startup_error;
 
-    demo_ui my_ui;
-    my_ui.run();
+    /* the user interface owns the terminal, so errors are printed after it is gone */
+    {
+        demo_ui my_ui;
+        my_ui.set_diagnostics_toggle_key(KEY_F(2));
+
+        for (int i = 1; i < argc; ++i)
+        {
+            if (strcmp(argv[i], "--measure-wakeups") == 0)
+            {
+                my_ui.set_wakeup_measurement(true);
+            }
+            else if (strcmp(argv[i], "--layout") == 0 &&
+                     i + 1 < argc)
+            {
+                /* the layout is watched and re-applied whenever the file is saved */
+                if (!my_ui.load_layout(argv[++i], true))
+                {
+                    startup_error = my_ui.get_layout_error();
+                }
+            }
+            else if (strcmp(argv[i], "--record") == 0 &&
+                     i + 1 < argc)
+            {
+                /* every field update goes into the log; see examples/replay */
+                const char * log_path = argv[++i];
+                if (!my_ui.start_recording(log_path))
+                {
+                    startup_error = std::string(log_path) + ": cannot create the update log";
+                }
+            }
+        }
+
+        if (startup_error.empty())
+        {
+            my_ui.run();
+        }
+    }
+
+    if (!startup_error.empty())
+    {
+        fprintf(stderr, "%s\n", startup_error.c_str());
+        return 1;
+    }
 
     return 0;
 }